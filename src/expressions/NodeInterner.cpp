@@ -0,0 +1,153 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#include <bit>
+#include <cstdint>
+#include <typeinfo>
+
+#include <boost/functional/hash.hpp>
+
+#include <antares/expressions/NodeInterner.h>
+#include <antares/expressions/nodes/ExpressionsNodes.h>
+
+namespace Antares::Expressions
+{
+using namespace Nodes;
+
+template<class T>
+static void combineTimedLeaf(std::size_t& seed, const T* node)
+{
+    boost::hash_combine(seed, node->value());
+    boost::hash_combine(seed, static_cast<unsigned>(node->timeIndex()));
+}
+
+std::size_t NodeInterner::ShallowHash::operator()(const Node* node) const
+{
+    std::size_t seed = typeid(*node).hash_code();
+    if (const auto* sum = dynamic_cast<const SumNode*>(node))
+    {
+        for (const Node* operand: sum->getOperands())
+        {
+            boost::hash_combine(seed, operand);
+        }
+    }
+    else if (const auto* binary = dynamic_cast<const BinaryNode*>(node))
+    {
+        boost::hash_combine(seed, binary->left());
+        boost::hash_combine(seed, binary->right());
+    }
+    else if (const auto* unary = dynamic_cast<const UnaryNode*>(node))
+    {
+        boost::hash_combine(seed, unary->child());
+    }
+    else if (const auto* literal = dynamic_cast<const LiteralNode*>(node))
+    {
+        // Bitwise, to tell 0 from -0
+        boost::hash_combine(seed, std::bit_cast<std::uint64_t>(literal->value()));
+    }
+    else if (const auto* parameter = dynamic_cast<const ParameterNode*>(node))
+    {
+        combineTimedLeaf(seed, parameter);
+    }
+    else if (const auto* variable = dynamic_cast<const VariableNode*>(node))
+    {
+        combineTimedLeaf(seed, variable);
+    }
+    else if (const auto* portField = dynamic_cast<const PortFieldNode*>(node))
+    {
+        boost::hash_combine(seed, PortFieldHash{}(*portField));
+    }
+    else if (const auto* portFieldSum = dynamic_cast<const PortFieldSumNode*>(node))
+    {
+        boost::hash_combine(seed, PortFieldHash{}(*portFieldSum));
+    }
+    else if (const auto* component = dynamic_cast<const ComponentNode*>(node))
+    {
+        boost::hash_combine(seed, component->getComponentId());
+        boost::hash_combine(seed, component->getComponentName());
+    }
+    return seed;
+}
+
+template<class T>
+static bool sameTimedLeaf(const T* node, const Node* other)
+{
+    const auto* otherNode = static_cast<const T*>(other);
+    return node->value() == otherNode->value() && node->timeIndex() == otherNode->timeIndex();
+}
+
+bool NodeInterner::ShallowEqual::operator()(const Node* left, const Node* right) const
+{
+    if (typeid(*left) != typeid(*right))
+    {
+        return false;
+    }
+    // Same dynamic type : static casts of right are safe
+    if (const auto* sum = dynamic_cast<const SumNode*>(left))
+    {
+        return sum->getOperands() == static_cast<const SumNode*>(right)->getOperands();
+    }
+    if (const auto* binary = dynamic_cast<const BinaryNode*>(left))
+    {
+        const auto* other = static_cast<const BinaryNode*>(right);
+        return binary->left() == other->left() && binary->right() == other->right();
+    }
+    if (const auto* unary = dynamic_cast<const UnaryNode*>(left))
+    {
+        return unary->child() == static_cast<const UnaryNode*>(right)->child();
+    }
+    if (const auto* literal = dynamic_cast<const LiteralNode*>(left))
+    {
+        return std::bit_cast<std::uint64_t>(literal->value())
+               == std::bit_cast<std::uint64_t>(static_cast<const LiteralNode*>(right)->value());
+    }
+    if (const auto* parameter = dynamic_cast<const ParameterNode*>(left))
+    {
+        return sameTimedLeaf(parameter, right);
+    }
+    if (const auto* variable = dynamic_cast<const VariableNode*>(left))
+    {
+        return sameTimedLeaf(variable, right);
+    }
+    if (const auto* portField = dynamic_cast<const PortFieldNode*>(left))
+    {
+        return *portField == *static_cast<const PortFieldNode*>(right);
+    }
+    if (const auto* portFieldSum = dynamic_cast<const PortFieldSumNode*>(left))
+    {
+        return *portFieldSum == *static_cast<const PortFieldSumNode*>(right);
+    }
+    if (const auto* component = dynamic_cast<const ComponentNode*>(left))
+    {
+        return *component == *static_cast<const ComponentNode*>(right);
+    }
+    return false;
+}
+
+Node* NodeInterner::intern(Node* candidate)
+{
+    return *nodes_.insert(candidate).first;
+}
+
+Registry<Node> makeSharingRegistry()
+{
+    return Registry<Node>(std::make_unique<NodeInterner>());
+}
+} // namespace Antares::Expressions
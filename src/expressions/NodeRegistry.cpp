@@ -7,6 +7,12 @@ namespace Antares::Expressions
 NodeRegistry::NodeRegistry(
   Antares::Expressions::Nodes::Node* node,
   Antares::Expressions::Registry<Antares::Expressions::Nodes::Node> registry):
+    node(node),
+    registry(std::make_shared<Registry<Nodes::Node>>(std::move(registry)))
+{
+}
+
+NodeRegistry::NodeRegistry(Nodes::Node* node, std::shared_ptr<Registry<Nodes::Node>> registry):
     node(node),
     registry(std::move(registry))
 {
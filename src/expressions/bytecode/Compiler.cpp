@@ -0,0 +1,391 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#include "antares/expressions/bytecode/Compiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <ranges>
+#include <stdexcept>
+
+#include <antares/expressions/nodes/ExpressionsNodes.h>
+#include <antares/expressions/visitors/LinearityVisitor.h>
+#include <antares/expressions/visitors/NodeVisitor.h>
+
+namespace Antares::Expressions::Bytecode
+{
+namespace
+{
+Code constant(double value)
+{
+    return {{{OpCode::CONSTANT, 0}}, {value}, 1};
+}
+
+bool isConstant(const Code& code, double& value)
+{
+    if (code.instructions.size() == 1 && code.instructions.front().op == OpCode::CONSTANT)
+    {
+        value = code.constants[code.instructions.front().operand];
+        return true;
+    }
+    return false;
+}
+
+void append(Code& code, const Code& other)
+{
+    const auto shift = static_cast<std::uint32_t>(code.constants.size());
+    for (auto instruction: other.instructions)
+    {
+        if (instruction.op == OpCode::CONSTANT)
+        {
+            instruction.operand += shift;
+        }
+        code.instructions.push_back(instruction);
+    }
+    code.constants.insert(code.constants.end(), other.constants.begin(), other.constants.end());
+}
+
+Code negate(Code code)
+{
+    if (double value; isConstant(code, value))
+    {
+        return constant(-value);
+    }
+    code.instructions.push_back({OpCode::NEGATE});
+    return code;
+}
+
+double apply(OpCode op, double left, double right)
+{
+    switch (op)
+    {
+    case OpCode::ADD:
+        return left + right;
+    case OpCode::SUBTRACT:
+        return left - right;
+    case OpCode::MULTIPLY:
+        return left * right;
+    default:
+        return left / right;
+    }
+}
+
+Code binary(OpCode op, Code left, const Code& right)
+{
+    double a;
+    double b;
+    if (isConstant(left, a) && isConstant(right, b))
+    {
+        // A division giving a non finite number is kept, to fail at evaluation as EvalVisitor
+        if (double folded = apply(op, a, b); op != OpCode::DIVIDE || std::isfinite(folded))
+        {
+            return constant(folded);
+        }
+    }
+    const unsigned int depth = std::max(left.stackDepth, right.stackDepth + 1);
+    append(left, right);
+    left.instructions.push_back({op});
+    left.stackDepth = depth;
+    return left;
+}
+
+// In the following, an empty code stands for 0
+
+/// Get if running the code may raise an error, i.e. if it contains a division
+bool mayFail(const Code& code)
+{
+    return std::ranges::any_of(code.instructions,
+                               [](const Instruction& i) { return i.op == OpCode::DIVIDE; });
+}
+
+Code add(Code left, const Code& right)
+{
+    if (left.empty())
+    {
+        return right;
+    }
+    if (right.empty())
+    {
+        return left;
+    }
+    return binary(OpCode::ADD, std::move(left), right);
+}
+
+Code subtract(Code left, const Code& right)
+{
+    if (right.empty())
+    {
+        return left;
+    }
+    if (left.empty())
+    {
+        return negate(right);
+    }
+    return binary(OpCode::SUBTRACT, std::move(left), right);
+}
+
+Code multiply(Code left, const Code& right)
+{
+    // A product by 0 is dropped, unless the other operand has a division to check
+    if ((left.empty() && !mayFail(right)) || (right.empty() && !mayFail(left)))
+    {
+        return {};
+    }
+    return binary(OpCode::MULTIPLY,
+                  left.empty() ? constant(0.) : std::move(left),
+                  right.empty() ? constant(0.) : right);
+}
+
+Code divide(Code left, const Code& right)
+{
+    // 0 divided by 0 must fail as EvalVisitor does : the division is always kept
+    return binary(OpCode::DIVIDE,
+                  left.empty() ? constant(0.) : std::move(left),
+                  right.empty() ? constant(0.) : right);
+}
+
+/**
+ * @brief Compiled form of a sub-expression : offset and coefficients by variable slot.
+ */
+struct Fragment
+{
+    Code offset;
+    std::map<std::uint32_t, Code> coefficients;
+};
+
+class CompilerVisitor: public Visitors::NodeVisitor<Fragment>
+{
+public:
+    explicit CompilerVisitor(Program& program):
+        program_(program)
+    {
+    }
+
+    std::string name() const override
+    {
+        return "CompilerVisitor";
+    }
+
+    Fragment visit(const Nodes::SumNode* node) override
+    {
+        Fragment sum;
+        for (auto* operand: node->getOperands())
+        {
+            auto fragment = dispatch(operand);
+            sum.offset = add(std::move(sum.offset), fragment.offset);
+            for (auto& [slot, coefficient]: fragment.coefficients)
+            {
+                sum.coefficients[slot] = add(std::move(sum.coefficients[slot]), coefficient);
+            }
+        }
+        return sum;
+    }
+
+    Fragment visit(const Nodes::SubtractionNode* node) override
+    {
+        return difference(node);
+    }
+
+    /// Compiled form of the left operand minus the right one
+    Fragment difference(const Nodes::BinaryNode* node)
+    {
+        auto left = dispatch(node->left());
+        auto right = dispatch(node->right());
+        left.offset = subtract(std::move(left.offset), right.offset);
+        for (auto& [slot, coefficient]: right.coefficients)
+        {
+            left.coefficients[slot] = subtract(std::move(left.coefficients[slot]), coefficient);
+        }
+        return left;
+    }
+
+    Fragment visit(const Nodes::MultiplicationNode* node) override
+    {
+        auto left = dispatch(node->left());
+        auto right = dispatch(node->right());
+        // The expression is linear : at least one of the operands is constant
+        auto& factor = left.coefficients.empty() ? left.offset : right.offset;
+        auto& scaled = left.coefficients.empty() ? right : left;
+
+        Fragment product;
+        product.offset = multiply(left.offset, right.offset);
+        for (auto& [slot, coefficient]: scaled.coefficients)
+        {
+            product.coefficients[slot] = multiply(std::move(coefficient), factor);
+        }
+        return product;
+    }
+
+    Fragment visit(const Nodes::DivisionNode* node) override
+    {
+        auto left = dispatch(node->left());
+        auto right = dispatch(node->right());
+        left.offset = divide(std::move(left.offset), right.offset);
+        for (auto& [slot, coefficient]: left.coefficients)
+        {
+            coefficient = divide(std::move(coefficient), right.offset);
+        }
+        return left;
+    }
+
+    Fragment visit(const Nodes::EqualNode*) override
+    {
+        throw std::invalid_argument("A compiled expression can't contain comparison operators.");
+    }
+
+    Fragment visit(const Nodes::LessThanOrEqualNode*) override
+    {
+        throw std::invalid_argument("A compiled expression can't contain comparison operators.");
+    }
+
+    Fragment visit(const Nodes::GreaterThanOrEqualNode*) override
+    {
+        throw std::invalid_argument("A compiled expression can't contain comparison operators.");
+    }
+
+    Fragment visit(const Nodes::NegationNode* node) override
+    {
+        auto fragment = dispatch(node->child());
+        fragment.offset = negate(std::move(fragment.offset));
+        for (auto& coefficient: fragment.coefficients | std::views::values)
+        {
+            coefficient = negate(std::move(coefficient));
+        }
+        return fragment;
+    }
+
+    Fragment visit(const Nodes::VariableNode* node) override
+    {
+        Fragment fragment;
+        fragment.coefficients[slot(node->value(), variableSlots_, program_.variables)] = constant(
+          1.);
+        return fragment;
+    }
+
+    Fragment visit(const Nodes::ParameterNode* node) override
+    {
+        const auto parameter = slot(node->value(), parameterSlots_, program_.parameters);
+        return {{{{OpCode::PARAMETER, parameter}}, {}, 1}, {}};
+    }
+
+    Fragment visit(const Nodes::LiteralNode* node) override
+    {
+        return {constant(node->value()), {}};
+    }
+
+    Fragment visit(const Nodes::PortFieldNode*) override
+    {
+        throw std::invalid_argument("CompilerVisitor cannot visit PortFieldNodes");
+    }
+
+    Fragment visit(const Nodes::PortFieldSumNode*) override
+    {
+        throw std::invalid_argument("CompilerVisitor cannot visit PortFieldSumNodes");
+    }
+
+    Fragment visit(const Nodes::ComponentVariableNode*) override
+    {
+        throw std::invalid_argument("CompilerVisitor cannot visit ComponentVariableNodes");
+    }
+
+    Fragment visit(const Nodes::ComponentParameterNode*) override
+    {
+        throw std::invalid_argument("CompilerVisitor cannot visit ComponentParameterNodes");
+    }
+
+private:
+    static std::uint32_t slot(const std::string& name,
+                              std::map<std::string, std::uint32_t>& slots,
+                              std::vector<std::string>& names)
+    {
+        auto [it, inserted] = slots.try_emplace(name, static_cast<std::uint32_t>(names.size()));
+        if (inserted)
+        {
+            names.push_back(name);
+        }
+        return it->second;
+    }
+
+    Program& program_;
+    std::map<std::string, std::uint32_t> parameterSlots_;
+    std::map<std::string, std::uint32_t> variableSlots_;
+};
+
+void checkLinearity(const Nodes::Node* node)
+{
+    Visitors::LinearityVisitor linearity;
+    if (linearity.dispatch(node) == Visitors::LinearStatus::NON_LINEAR)
+    {
+        throw std::invalid_argument("Only linear expressions can be compiled.");
+    }
+}
+
+void setFragment(Program& program, Fragment fragment)
+{
+    program.offset = std::move(fragment.offset);
+    program.coefficients.resize(program.variables.size());
+    for (auto& [slot, coefficient]: fragment.coefficients)
+    {
+        program.coefficients[slot] = std::move(coefficient);
+    }
+}
+} // namespace
+
+Program compile(const Nodes::Node* root)
+{
+    checkLinearity(root);
+
+    Program program;
+    CompilerVisitor compiler(program);
+    setFragment(program, compiler.dispatch(root));
+    return program;
+}
+
+ConstraintProgram compileConstraint(const Nodes::Node* root)
+{
+    ConstraintProgram constraint;
+    if (dynamic_cast<const Nodes::EqualNode*>(root))
+    {
+        constraint.comparison = Comparison::EQUAL;
+    }
+    else if (dynamic_cast<const Nodes::LessThanOrEqualNode*>(root))
+    {
+        constraint.comparison = Comparison::LESS_THAN_OR_EQUAL;
+    }
+    else if (dynamic_cast<const Nodes::GreaterThanOrEqualNode*>(root))
+    {
+        constraint.comparison = Comparison::GREATER_THAN_OR_EQUAL;
+    }
+    else
+    {
+        throw std::invalid_argument("Root node of a constraint must be a comparator.");
+    }
+
+    const auto* comparison = static_cast<const Nodes::ComparisonNode*>(root);
+    checkLinearity(comparison->left());
+    checkLinearity(comparison->right());
+
+    CompilerVisitor compiler(constraint.difference);
+    setFragment(constraint.difference, compiler.difference(comparison));
+    return constraint;
+}
+} // namespace Antares::Expressions::Bytecode
@@ -0,0 +1,224 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#include "antares/expressions/bytecode/Evaluator.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <antares/expressions/visitors/EvalVisitor.h>
+
+namespace Antares::Expressions::Bytecode
+{
+std::vector<ParameterValues> bindParameters(const std::vector<std::string>& names,
+                                            const std::map<std::string, double>& values)
+{
+    std::vector<ParameterValues> parameters;
+    parameters.reserve(names.size());
+    for (const auto& name: names)
+    {
+        parameters.push_back({&values.at(name), false});
+    }
+    return parameters;
+}
+
+Evaluator::Evaluator(std::vector<ParameterValues> parameters):
+    parameters_(std::move(parameters))
+{
+}
+
+namespace
+{
+template<class Operation>
+void applyOnRange(double* out,
+                  const double* left,
+                  bool leftUniform,
+                  const double* right,
+                  bool rightUniform,
+                  std::size_t size,
+                  Operation operation)
+{
+    // One loop per case, so that each of them can be vectorised
+    if (leftUniform)
+    {
+        const double a = *left;
+        for (std::size_t t = 0; t < size; ++t)
+        {
+            out[t] = operation(a, right[t]);
+        }
+    }
+    else if (rightUniform)
+    {
+        const double b = *right;
+        for (std::size_t t = 0; t < size; ++t)
+        {
+            out[t] = operation(left[t], b);
+        }
+    }
+    else
+    {
+        for (std::size_t t = 0; t < size; ++t)
+        {
+            out[t] = operation(left[t], right[t]);
+        }
+    }
+}
+
+void checkDivision(double result, double left, double right)
+{
+    if (!std::isfinite(result))
+    {
+        throw Visitors::EvalVisitorDivisionException(left, right, "is not a finite number");
+    }
+}
+} // namespace
+
+void Evaluator::binary(OpCode op, Register& left, const Register& right, std::size_t size)
+{
+    if (left.uniform && right.uniform)
+    {
+        const double a = left.value;
+        switch (op)
+        {
+        case OpCode::ADD:
+            left.value += right.value;
+            break;
+        case OpCode::SUBTRACT:
+            left.value -= right.value;
+            break;
+        case OpCode::MULTIPLY:
+            left.value *= right.value;
+            break;
+        default:
+            left.value /= right.value;
+            checkDivision(left.value, a, right.value);
+        }
+        return;
+    }
+
+    // The buffer of the left operand receives the result : it may be its own data
+    left.buffer.resize(size);
+    double* out = left.buffer.data();
+    const double* a = left.uniform ? &left.value : left.data;
+    const double* b = right.uniform ? &right.value : right.data;
+    switch (op)
+    {
+    case OpCode::ADD:
+        applyOnRange(out, a, left.uniform, b, right.uniform, size, std::plus<>());
+        break;
+    case OpCode::SUBTRACT:
+        applyOnRange(out, a, left.uniform, b, right.uniform, size, std::minus<>());
+        break;
+    case OpCode::MULTIPLY:
+        applyOnRange(out, a, left.uniform, b, right.uniform, size, std::multiplies<>());
+        break;
+    default:
+    {
+        // Operands are kept for the error message : the result can't overwrite them
+        std::vector<double> quotient(size);
+        applyOnRange(quotient.data(), a, left.uniform, b, right.uniform, size, std::divides<>());
+        for (std::size_t t = 0; t < size; ++t)
+        {
+            checkDivision(quotient[t], left.uniform ? *a : a[t], right.uniform ? *b : b[t]);
+        }
+        std::ranges::copy(quotient, out);
+    }
+    }
+    left.uniform = false;
+    left.data = out;
+}
+
+void Evaluator::run(const Code& code, unsigned int firstTimeStep, std::span<double> out)
+{
+    if (code.empty())
+    {
+        std::ranges::fill(out, 0.);
+        return;
+    }
+    if (stack_.size() < code.stackDepth)
+    {
+        stack_.resize(code.stackDepth);
+    }
+
+    const std::size_t size = out.size();
+    std::size_t top = 0;
+    for (const auto& instruction: code.instructions)
+    {
+        switch (instruction.op)
+        {
+        case OpCode::CONSTANT:
+        {
+            auto& value = stack_[top++];
+            value.uniform = true;
+            value.value = code.constants[instruction.operand];
+            break;
+        }
+        case OpCode::PARAMETER:
+        {
+            const auto& parameter = parameters_[instruction.operand];
+            auto& value = stack_[top++];
+            value.uniform = !parameter.timeDependent;
+            value.value = *parameter.values;
+            value.data = parameter.values + firstTimeStep;
+            break;
+        }
+        case OpCode::NEGATE:
+        {
+            auto& value = stack_[top - 1];
+            if (value.uniform)
+            {
+                value.value = -value.value;
+            }
+            else
+            {
+                value.buffer.resize(size);
+                std::transform(value.data,
+                               value.data + size,
+                               value.buffer.begin(),
+                               std::negate<>());
+                value.data = value.buffer.data();
+            }
+            break;
+        }
+        default:
+            --top;
+            binary(instruction.op, stack_[top - 1], stack_[top], size);
+        }
+    }
+
+    const auto& result = stack_.front();
+    if (result.uniform)
+    {
+        std::ranges::fill(out, result.value);
+    }
+    else
+    {
+        std::copy(result.data, result.data + size, out.begin());
+    }
+}
+
+double Evaluator::run(const Code& code, unsigned int timeStep)
+{
+    double value;
+    run(code, timeStep, {&value, 1});
+    return value;
+}
+} // namespace Antares::Expressions::Bytecode
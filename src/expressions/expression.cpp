@@ -0,0 +1,76 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#include <algorithm>
+
+#include <antares/expressions/expression.h>
+#include <antares/expressions/nodes/ExpressionsNodes.h>
+#include <antares/expressions/visitors/LinearityVisitor.h>
+#include <antares/expressions/visitors/TimeIndexVisitor.h>
+
+namespace Antares::Study::SystemModel
+{
+using namespace Expressions::Nodes;
+
+// Port fields and components get their time index once the system is built
+static bool hasUnresolvedNodes(const Node* node)
+{
+    if (dynamic_cast<const PortFieldNode*>(node) || dynamic_cast<const PortFieldSumNode*>(node)
+        || dynamic_cast<const ComponentNode*>(node))
+    {
+        return true;
+    }
+    if (auto* binary = dynamic_cast<const BinaryNode*>(node))
+    {
+        return hasUnresolvedNodes(binary->left()) || hasUnresolvedNodes(binary->right());
+    }
+    if (auto* unary = dynamic_cast<const UnaryNode*>(node))
+    {
+        return hasUnresolvedNodes(unary->child());
+    }
+    if (auto* sum = dynamic_cast<const SumNode*>(node))
+    {
+        return std::ranges::any_of(sum->getOperands(), hasUnresolvedNodes);
+    }
+    return false;
+}
+
+Expression::Expression(const std::string& value, Expressions::NodeRegistry root):
+    value_(value),
+    root_(std::move(root)),
+    empty_(false)
+{
+    if (!root_.node)
+    {
+        return;
+    }
+    Expressions::Visitors::LinearityVisitor linearityVisitor;
+    linearStatus_ = linearityVisitor.dispatch(root_.node);
+    if (hasUnresolvedNodes(root_.node))
+    {
+        timeIndex_.reset();
+        return;
+    }
+    Expressions::Visitors::TimeIndexVisitor timeIndexVisitor;
+    timeIndex_ = timeIndexVisitor.dispatch(root_.node);
+}
+
+} // namespace Antares::Study::SystemModel
@@ -0,0 +1,60 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#pragma once
+
+#include <unordered_set>
+
+#include <antares/expressions/Registry.hxx>
+#include <antares/expressions/nodes/Node.h>
+
+namespace Antares::Expressions
+{
+/**
+ * @brief Shares the structurally identical nodes of a registry (hash-consing).
+ *
+ * Nodes are compared shallowly : same type, same value, and same children, by address. Since
+ * children are themselves shared when created in the same registry, identical sub-trees are
+ * stored only once.
+ */
+class NodeInterner final: public Interner<Nodes::Node>
+{
+public:
+    Nodes::Node* intern(Nodes::Node* candidate) override;
+
+private:
+    struct ShallowHash
+    {
+        std::size_t operator()(const Nodes::Node* node) const;
+    };
+
+    struct ShallowEqual
+    {
+        bool operator()(const Nodes::Node* left, const Nodes::Node* right) const;
+    };
+
+    std::unordered_set<Nodes::Node*, ShallowHash, ShallowEqual> nodes_;
+};
+
+/**
+ * @brief Creates a registry in which structurally identical nodes are created only once.
+ */
+Registry<Nodes::Node> makeSharingRegistry();
+} // namespace Antares::Expressions
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include <antares/expressions/Registry.hxx>
 #include <antares/expressions/nodes/Node.h>
 
@@ -10,12 +12,15 @@ class NodeRegistry
 public:
     NodeRegistry() = default;
     NodeRegistry(Nodes::Node* node, Registry<Nodes::Node> registry);
+    // The nodes belong to a registry shared with other expressions, e.g. all the expressions of a
+    // library, so that their identical sub-trees are the same nodes
+    NodeRegistry(Nodes::Node* node, std::shared_ptr<Registry<Nodes::Node>> registry);
 
     // Shallow copy
     NodeRegistry(NodeRegistry&&) = default;
     NodeRegistry& operator=(NodeRegistry&&) = default;
 
     Nodes::Node* node;
-    Registry<Nodes::Node> registry;
+    std::shared_ptr<Registry<Nodes::Node>> registry;
 };
 } // namespace Antares::Expressions
@@ -20,35 +20,165 @@
 */
 #pragma once
 
+#include <algorithm>
 #include <concepts>
+#include <cstddef>
 #include <memory>
 #include <mutex>
+#include <new>
+#include <utility>
 #include <vector>
 
 namespace Antares::Expressions
 {
+/**
+ * @brief Finds, among the objects of a registry, the one structurally equal to a new object.
+ *
+ * Used by the registry to share identical objects (hash-consing) instead of storing duplicates.
+ */
+template<class Base>
+class Interner
+{
+public:
+    virtual ~Interner() = default;
+
+    /**
+     * @brief Returns the registered object equal to candidate, or registers and returns candidate.
+     */
+    virtual Base* intern(Base* candidate) = 0;
+};
+
 //  Template class to manage the memory allocation and registry for a base class
+//  Objects are allocated in blocks of memory (arena) and destroyed all together with the registry.
+//  When given an interner, structurally identical objects are created only once and shared.
 template<class Base>
 class Registry
 {
 public:
     Registry() = default;
-    Registry(Registry<Base>&&) = default;
-    Registry<Base>& operator=(Registry<Base>&&) = default;
+
+    explicit Registry(std::unique_ptr<Interner<Base>> interner):
+        interner_(std::move(interner))
+    {
+    }
+
+    Registry(Registry<Base>&& other) noexcept:
+        blocks_(std::move(other.blocks_)),
+        used_(std::exchange(other.used_, 0)),
+        registry_(std::move(other.registry_)),
+        interner_(std::move(other.interner_))
+    {
+        other.blocks_.clear();
+        other.registry_.clear();
+    }
+
+    Registry<Base>& operator=(Registry<Base>&& other) noexcept
+    {
+        if (this != &other)
+        {
+            clear();
+            blocks_ = std::move(other.blocks_);
+            used_ = std::exchange(other.used_, 0);
+            registry_ = std::move(other.registry_);
+            interner_ = std::move(other.interner_);
+            other.blocks_.clear();
+            other.registry_.clear();
+        }
+        return *this;
+    }
+
+    ~Registry()
+    {
+        clear();
+    }
 
     //  Method to create a new derived class object and add it to the registry
+    //  With an interner, an already registered object equal to the new one may be returned
     template<class Derived, class... Args>
     requires std::derived_from<Derived, Base>
     Derived* create(Args&&... args)
     {
-        auto created = std::make_unique<Derived>(std::forward<Args>(args)...);
-        registry_.push_back(std::move(created));
-        return dynamic_cast<Derived*>(
-          registry_.back().get()); //  Return the pointer to the newly created object
+        static_assert(alignof(Derived) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+
+        const auto mark = std::make_pair(blocks_.size(), used_);
+        void* memory = allocate(sizeof(Derived), alignof(Derived));
+        Derived* created = nullptr;
+        try
+        {
+            created = new (memory) Derived(std::forward<Args>(args)...);
+            if (interner_)
+            {
+                if (Base* existing = interner_->intern(created); existing != created)
+                {
+                    created->~Derived();
+                    release(mark);
+                    return dynamic_cast<Derived*>(existing);
+                }
+            }
+            registry_.push_back(created);
+        }
+        catch (...)
+        {
+            if (created)
+            {
+                created->~Derived();
+            }
+            release(mark);
+            throw;
+        }
+        return created; //  Return the pointer to the newly created object
+    }
+
+    //  Number of distinct objects held by the registry
+    std::size_t size() const
+    {
+        return registry_.size();
     }
 
 private:
-    std::vector<std::unique_ptr<Base>>
-      registry_; //  Registry to manage dynamically allocated objects
+    static constexpr std::size_t blockSize = 4096;
+
+    struct Block
+    {
+        std::unique_ptr<std::byte[]> data;
+        std::size_t size;
+    };
+
+    void* allocate(std::size_t size, std::size_t alignment)
+    {
+        std::size_t offset = (used_ + alignment - 1) / alignment * alignment;
+        if (blocks_.empty() || offset + size > blocks_.back().size)
+        {
+            const std::size_t newBlockSize = std::max(size, blockSize);
+            blocks_.push_back({std::make_unique<std::byte[]>(newBlockSize), newBlockSize});
+            offset = 0;
+        }
+        used_ = offset + size;
+        return blocks_.back().data.get() + offset;
+    }
+
+    //  Gives back the memory allocated since mark, i.e. by the last call to allocate
+    void release(std::pair<std::size_t, std::size_t> mark)
+    {
+        blocks_.resize(mark.first);
+        used_ = mark.second;
+    }
+
+    void clear()
+    {
+        // Objects may refer to previously created ones : destroy them in reverse order
+        for (auto it = registry_.rbegin(); it != registry_.rend(); ++it)
+        {
+            (*it)->~Base();
+        }
+        registry_.clear();
+        blocks_.clear();
+        used_ = 0;
+    }
+
+    std::vector<Block> blocks_; //  Memory blocks, objects are allocated in the last one
+    std::size_t used_ = 0;      //  Bytes used in the last block
+    std::vector<Base*> registry_; //  Registry to manage objects allocated in the blocks
+    std::unique_ptr<Interner<Base>> interner_;
 };
 } // namespace Antares::Expressions
@@ -0,0 +1,50 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#pragma once
+
+#include <antares/expressions/bytecode/Program.h>
+#include <antares/expressions/nodes/Node.h>
+
+namespace Antares::Expressions::Bytecode
+{
+/**
+ * @brief Lowers an expression into a Program.
+ *
+ * Parameters and variables are given a slot in order of first appearance, and constant
+ * sub-expressions made of literals only are folded.
+ *
+ * @param root The root of the expression.
+ * @return The compiled program.
+ * @throws std::invalid_argument If the expression is not linear, or contains comparisons,
+ * port fields or component nodes.
+ */
+Program compile(const Nodes::Node* root);
+
+/**
+ * @brief Lowers a constraint into a ConstraintProgram.
+ *
+ * @param root The comparison at the root of the constraint.
+ * @return The compiled constraint.
+ * @throws std::invalid_argument If the root is not a comparison, or if one of its sides can't
+ * be compiled.
+ */
+ConstraintProgram compileConstraint(const Nodes::Node* root);
+} // namespace Antares::Expressions::Bytecode
@@ -0,0 +1,97 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#pragma once
+
+#include <map>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <antares/expressions/bytecode/Program.h>
+
+namespace Antares::Expressions::Bytecode
+{
+/**
+ * @brief Values of the parameter bound to a slot.
+ */
+struct ParameterValues
+{
+    /// A single value, or one value per timestep if the parameter is time-dependent
+    const double* values = nullptr;
+    bool timeDependent = false;
+};
+
+/**
+ * @brief Binds parameter slots to scalar values.
+ *
+ * @param names The name of the parameter of each slot (see Program::parameters).
+ * @param values The values, by name. They must outlive the binding.
+ * @return The values of each slot.
+ * @throws std::out_of_range If a parameter is not found.
+ */
+std::vector<ParameterValues> bindParameters(const std::vector<std::string>& names,
+                                            const std::map<std::string, double>& values);
+
+/**
+ * @brief Runs compiled code over ranges of timesteps.
+ *
+ * Every instruction is applied to the whole range at once. Values which do not depend on
+ * time are kept as scalars as long as possible. The evaluator keeps its stack from one run
+ * to the next : it is meant to be reused, but not shared between threads.
+ */
+class Evaluator
+{
+public:
+    /**
+     * @brief Constructs an evaluator.
+     *
+     * @param parameters The values of each parameter slot of the codes to run.
+     */
+    explicit Evaluator(std::vector<ParameterValues> parameters);
+
+    /**
+     * @brief Evaluates a code for the timesteps [firstTimeStep, firstTimeStep + out.size()).
+     *
+     * @throws Visitors::EvalVisitorDivisionException If a division gives a non finite number.
+     */
+    void run(const Code& code, unsigned int firstTimeStep, std::span<double> out);
+
+    /**
+     * @brief Evaluates a code at a given timestep.
+     */
+    double run(const Code& code, unsigned int timeStep = 0);
+
+private:
+    struct Register
+    {
+        bool uniform = true;
+        double value = 0.;
+        /// Values of the range, if not uniform (either a parameter or buffer)
+        const double* data = nullptr;
+        std::vector<double> buffer;
+    };
+
+    void binary(OpCode op, Register& left, const Register& right, std::size_t size);
+
+    std::vector<ParameterValues> parameters_;
+    std::vector<Register> stack_;
+};
+} // namespace Antares::Expressions::Bytecode
@@ -0,0 +1,110 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Antares::Expressions::Bytecode
+{
+/**
+ * @brief Operations of the bytecode, run by a stack machine.
+ */
+enum class OpCode : std::uint8_t
+{
+    /// Push a constant, the operand is its index in Code::constants
+    CONSTANT,
+    /// Push the value of a parameter, the operand is its slot
+    PARAMETER,
+    /// Pop two values and push their sum
+    ADD,
+    /// Pop two values and push the first minus the second
+    SUBTRACT,
+    /// Pop two values and push their product
+    MULTIPLY,
+    /// Pop two values and push the first divided by the second
+    DIVIDE,
+    /// Pop one value and push its opposite
+    NEGATE
+};
+
+struct Instruction
+{
+    OpCode op;
+    std::uint32_t operand = 0;
+};
+
+/**
+ * @brief Compiled form of an expression which only depends on parameters.
+ *
+ * An empty code evaluates to 0.
+ */
+struct Code
+{
+    std::vector<Instruction> instructions;
+    std::vector<double> constants;
+    /// Maximum number of values on the stack while running the code
+    unsigned int stackDepth = 0;
+
+    bool empty() const
+    {
+        return instructions.empty();
+    }
+};
+
+/**
+ * @brief Compiled form of a linear expression.
+ *
+ * The expression is lowered into an offset and one coefficient per variable, each of them
+ * being a Code which only depends on the parameters. Parameters and variables are referred
+ * to by slots, i.e. their index in the `parameters` and `variables` tables.
+ */
+struct Program
+{
+    /// Name of the parameter of each slot
+    std::vector<std::string> parameters;
+    /// Name of the variable of each slot
+    std::vector<std::string> variables;
+
+    Code offset;
+    /// Coefficient of each variable, by slot
+    std::vector<Code> coefficients;
+};
+
+enum class Comparison : std::uint8_t
+{
+    EQUAL,
+    LESS_THAN_OR_EQUAL,
+    GREATER_THAN_OR_EQUAL
+};
+
+/**
+ * @brief Compiled form of a constraint `left <comparison> right`.
+ *
+ * The constraint is lowered into `left - right <comparison> 0`.
+ */
+struct ConstraintProgram
+{
+    Program difference;
+    Comparison comparison = Comparison::EQUAL;
+};
+} // namespace Antares::Expressions::Bytecode
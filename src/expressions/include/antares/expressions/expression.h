@@ -20,9 +20,12 @@
 */
 #pragma once
 
+#include <optional>
 #include <string>
 
 #include <antares/expressions/NodeRegistry.h>
+#include <antares/expressions/visitors/LinearStatus.h>
+#include <antares/expressions/visitors/TimeIndex.h>
 
 namespace Antares::Expressions::Nodes
 {
@@ -38,10 +41,19 @@ class Expression
 public:
     Expression() = default;
 
-    explicit Expression(const std::string& value, Expressions::NodeRegistry root):
+    /// The time index and the linearity of the expression are computed once, from its tree
+    explicit Expression(const std::string& value, Expressions::NodeRegistry root);
+
+    /// For an expression whose properties are already known, e.g. read from a cache
+    Expression(const std::string& value,
+               Expressions::NodeRegistry root,
+               std::optional<Expressions::Visitors::TimeIndex> timeIndex,
+               Expressions::Visitors::LinearStatus linearStatus):
         value_(value),
         root_(std::move(root)),
-        empty_(false)
+        empty_(false),
+        timeIndex_(timeIndex),
+        linearStatus_(linearStatus)
     {
     }
 
@@ -60,10 +72,25 @@ public:
         return empty_;
     }
 
+    /// Time and scenario variation, unknown until port fields and components are resolved
+    std::optional<Expressions::Visitors::TimeIndex> timeIndex() const
+    {
+        return timeIndex_;
+    }
+
+    Expressions::Visitors::LinearStatus linearStatus() const
+    {
+        return linearStatus_;
+    }
+
 private:
     std::string value_;
     Expressions::NodeRegistry root_;
     bool empty_ = true;
+    std::optional<Expressions::Visitors::TimeIndex>
+      timeIndex_ = Expressions::Visitors::TimeIndex::CONSTANT_IN_TIME_AND_SCENARIO;
+    Expressions::Visitors::LinearStatus
+      linearStatus_ = Expressions::Visitors::LinearStatus::CONSTANT;
 };
 
 } // namespace Antares::Study::SystemModel
@@ -46,6 +46,15 @@ public:
      */
     double getParameterValue(const std::string& key) const;
 
+    /**
+     * @brief Changes the value of an existing parameter.
+     *
+     * @param name The name of the parameter.
+     * @param value The new value of the parameter.
+     * @throws std::out_of_range If the parameter is not found.
+     */
+    void setParameterValue(const std::string& key, double value);
+
 private:
     /**
      * @brief A map storing parameter values.
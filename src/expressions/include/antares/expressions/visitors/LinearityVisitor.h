@@ -31,6 +31,8 @@ namespace Antares::Expressions::Visitors
 class LinearityVisitor: public NodeVisitor<LinearStatus>
 {
 public:
+    LinearityVisitor();
+
     std::string name() const override;
 
 private:
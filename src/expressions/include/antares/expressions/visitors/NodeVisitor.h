@@ -21,7 +21,9 @@
 #pragma once
 #include <functional>
 #include <optional>
+#include <type_traits>
 #include <typeindex>
+#include <unordered_map>
 #include <vector>
 
 #include <antares/expressions/IName.h>
@@ -109,6 +111,61 @@ public:
             throw InvalidNode("null");
         }
 
+        if constexpr (sizeof...(Args) == 0 && !std::is_void_v<R>)
+        {
+            if (memoize_)
+            {
+                return memoizedDispatch(node);
+            }
+        }
+        return dispatchToVisit(node, args...);
+    }
+
+protected:
+    /**
+     * @brief Keeps the result of each node visited during a traversal.
+     *
+     * A node shared by several parents (see NodeInterner) is then visited only once. Only valid
+     * for visitors whose result depends on the visited node alone.
+     */
+    void enableMemoization()
+    requires(sizeof...(Args) == 0 && !std::is_void_v<R>)
+    {
+        memoize_ = true;
+    }
+
+private:
+    R memoizedDispatch(const Nodes::Node* node)
+    {
+        if (auto it = memo_.find(node); it != memo_.end())
+        {
+            return it->second;
+        }
+
+        // Results are only kept until the end of the outermost dispatch: nodes may be destroyed
+        // and their addresses reused afterwards
+        struct TraversalScope
+        {
+            NodeVisitor& visitor;
+
+            ~TraversalScope()
+            {
+                if (--visitor.traversalDepth_ == 0)
+                {
+                    visitor.memo_.clear();
+                }
+            }
+        };
+
+        ++traversalDepth_;
+        TraversalScope scope{*this};
+        R result = dispatchToVisit(node);
+        memo_.emplace(node, result);
+        return result;
+    }
+
+    R dispatchToVisit(const Nodes::Node* node, Args... args)
+    {
         const static auto nodeVisitList = NodeVisitsProvider<R, Args...>::template NodesVisitList<
           Nodes::SumNode,
           Nodes::SubtractionNode,
@@ -137,6 +194,7 @@ public:
         }
     }
 
+public:
     /**
      * @brief Visits a SumNode and processes its children.
      *
@@ -288,5 +346,9 @@ private:
     // inclusion of <windows.h> (very bad idea in a header!) which conflict with antlr4 headers
     // (defines in the former become enums in the latter etc...)
     LogSink log_ = RedirectToAntaresLogs();
+
+    bool memoize_ = false;
+    unsigned traversalDepth_ = 0;
+    std::unordered_map<const Nodes::Node*, std::conditional_t<std::is_void_v<R>, bool, R>> memo_;
 };
 } // namespace Antares::Expressions::Visitors
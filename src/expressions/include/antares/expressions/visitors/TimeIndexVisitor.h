@@ -39,7 +39,7 @@ public:
      * @param context The context containing the time index for each node.
      */
     explicit TimeIndexVisitor(std::unordered_map<const Nodes::Node*, TimeIndex> context);
-    explicit TimeIndexVisitor() = default;
+    explicit TimeIndexVisitor();
 
     std::string name() const override;
 
@@ -26,6 +26,8 @@ namespace Antares::Expressions::Visitors
 CloneVisitor::CloneVisitor(Registry<Nodes::Node>& registry):
     registry_(registry)
 {
+    // Shared sub-trees are cloned once, and stay shared in the clone
+    enableMemoization();
 }
 
 Nodes::Node* CloneVisitor::visit(const Nodes::SumNode* node)
@@ -86,7 +88,8 @@ Nodes::Node* CloneVisitor::visit(const Nodes::VariableNode* variableNode)
 
 Nodes::Node* CloneVisitor::visit(const Nodes::ParameterNode* parameterNode)
 {
-    return registry_.create<Nodes::ParameterNode>(parameterNode->value());
+    return registry_.create<Nodes::ParameterNode>(parameterNode->value(),
+                                                  parameterNode->timeIndex());
 }
 
 Nodes::Node* CloneVisitor::visit(const Nodes::LiteralNode* literalNode)
@@ -38,7 +38,7 @@ double EvalVisitor::visit(const Nodes::SumNode* node)
     auto operands = node->getOperands();
     return std::accumulate(std::begin(operands),
                            std::end(operands),
-                           0,
+                           0.,
                            [this](double sum, Nodes::Node* operand)
                            { return sum + dispatch(operand); });
 }
@@ -18,4 +18,9 @@ double EvaluationContext::getParameterValue(const std::string& key) const
 {
     return parameters_.at(key);
 }
+
+void EvaluationContext::setParameterValue(const std::string& key, double value)
+{
+    parameters_.at(key) = value;
+}
 } // namespace Antares::Expressions::Visitors
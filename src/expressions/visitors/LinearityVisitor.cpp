@@ -109,6 +109,11 @@ LinearStatus LinearityVisitor::visit([[maybe_unused]] const Nodes::ComponentPara
     return LinearStatus::CONSTANT;
 }
 
+LinearityVisitor::LinearityVisitor()
+{
+    enableMemoization();
+}
+
 std::string LinearityVisitor::name() const
 {
     return "LinearityVisitor";
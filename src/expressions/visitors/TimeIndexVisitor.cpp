@@ -114,6 +114,12 @@ TimeIndex TimeIndexVisitor::visit(const Nodes::ComponentParameterNode* component
 TimeIndexVisitor::TimeIndexVisitor(std::unordered_map<const Nodes::Node*, TimeIndex> context):
     context_(std::move(context))
 {
+    enableMemoization();
+}
+
+TimeIndexVisitor::TimeIndexVisitor()
+{
+    enableMemoization();
 }
 
 std::string TimeIndexVisitor::name() const
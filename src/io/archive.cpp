@@ -0,0 +1,353 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#include "antares/io/archive.h"
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <fstream>
+#include <memory>
+#include <ranges>
+#include <shared_mutex>
+#include <stdexcept>
+
+#include <antares/logs/logs.h>
+
+extern "C"
+{
+#include <mz.h>
+#include <mz_strm.h>
+#include <mz_zip.h>
+#include <mz_zip_rw.h>
+}
+
+namespace fs = std::filesystem;
+
+namespace Antares::IO
+{
+namespace
+{
+std::string normalizeEntryName(std::string name)
+{
+    std::ranges::replace(name, '\\', '/');
+    while (name.ends_with('/'))
+    {
+        name.pop_back();
+    }
+    return name;
+}
+
+void addParentFolders(std::unordered_set<std::string>& folders, const std::string& path)
+{
+    for (auto slash = path.rfind('/'); slash != std::string::npos;
+         slash = path.rfind('/', slash - 1))
+    {
+        if (!folders.insert(path.substr(0, slash)).second || slash == 0)
+        {
+            break;
+        }
+    }
+}
+} // namespace
+
+ZipArchive::ZipArchive(const fs::path& filename):
+    filename_(filename)
+{
+    void* reader = acquireReader();
+    if (!reader)
+    {
+        throw std::runtime_error("I/O error: " + filename.string()
+                                 + ": impossible to open the archive");
+    }
+
+    void* zip = nullptr;
+    mz_zip_reader_get_zip_handle(reader, &zip);
+
+    std::vector<std::pair<std::string, Entry>> files;
+    std::vector<std::string> folders;
+    for (int32_t err = mz_zip_goto_first_entry(zip); err == MZ_OK;
+         err = mz_zip_goto_next_entry(zip))
+    {
+        mz_zip_file* info = nullptr;
+        if (mz_zip_entry_get_info(zip, &info) != MZ_OK || !info->filename)
+        {
+            continue;
+        }
+        auto name = normalizeEntryName(info->filename);
+        if (mz_zip_entry_is_dir(zip) == MZ_OK)
+        {
+            folders.push_back(std::move(name));
+        }
+        else
+        {
+            files.emplace_back(std::move(name),
+                               Entry{mz_zip_get_entry(zip),
+                                     static_cast<uint64_t>(info->uncompressed_size)});
+        }
+    }
+    releaseReader(reader);
+
+    // The study may be stored in a folder of the archive: the shallowest
+    // `study.antares` gives its root
+    std::string root;
+    size_t rootDepth = std::string::npos;
+    for (const auto& name: files | std::views::keys)
+    {
+        if (name == "study.antares" || name.ends_with("/study.antares"))
+        {
+            auto depth = static_cast<size_t>(std::ranges::count(name, '/'));
+            if (depth < rootDepth)
+            {
+                rootDepth = depth;
+                root = name.substr(0, name.size() - std::string_view("study.antares").size());
+            }
+        }
+    }
+
+    for (auto& [name, entry]: files)
+    {
+        if (name.starts_with(root))
+        {
+            auto path = name.substr(root.size());
+            addParentFolders(folders_, path);
+            files_.try_emplace(std::move(path), entry);
+        }
+    }
+    for (const auto& name: folders)
+    {
+        if (name.size() > root.size() && name.starts_with(root))
+        {
+            auto path = name.substr(root.size());
+            addParentFolders(folders_, path);
+            folders_.insert(std::move(path));
+        }
+    }
+    folders_.insert(""); // the root itself
+
+    logs.info() << "  Archive " << filename.string() << ": " << files_.size() << " files";
+}
+
+ZipArchive::~ZipArchive()
+{
+    for (void* reader: readers_)
+    {
+        mz_zip_reader_close(reader);
+        mz_zip_reader_delete(&reader);
+    }
+}
+
+void* ZipArchive::acquireReader() const
+{
+    {
+        std::lock_guard lock(readersMutex_);
+        if (!readers_.empty())
+        {
+            void* reader = readers_.back();
+            readers_.pop_back();
+            return reader;
+        }
+    }
+
+    // minizip-ng readers are not thread-safe: one more is opened for each
+    // thread reading at the same time
+    void* reader = mz_zip_reader_create();
+    if (reader && mz_zip_reader_open_file(reader, filename_.string().c_str()) != MZ_OK)
+    {
+        mz_zip_reader_delete(&reader);
+        reader = nullptr;
+    }
+    return reader;
+}
+
+void ZipArchive::releaseReader(void* reader) const
+{
+    std::lock_guard lock(readersMutex_);
+    readers_.push_back(reader);
+}
+
+bool ZipArchive::containsFile(const std::string& path) const
+{
+    return files_.contains(path);
+}
+
+bool ZipArchive::contains(const std::string& path) const
+{
+    return files_.contains(path) || folders_.contains(path);
+}
+
+uint64_t ZipArchive::fileSize(const std::string& path) const
+{
+    auto it = files_.find(path);
+    return it != files_.end() ? it->second.size : 0;
+}
+
+bool ZipArchive::read(const std::string& path, std::string& content) const
+{
+    auto it = files_.find(path);
+    if (it == files_.end())
+    {
+        return false;
+    }
+
+    void* reader = acquireReader();
+    if (!reader)
+    {
+        logs.error() << "I/O error: " << filename_.string() << ": impossible to open the archive";
+        return false;
+    }
+
+    void* zip = nullptr;
+    mz_zip_reader_get_zip_handle(reader, &zip);
+
+    bool ok = mz_zip_goto_entry(zip, it->second.position) == MZ_OK
+              && mz_zip_entry_read_open(zip, 0, nullptr) == MZ_OK;
+    if (ok)
+    {
+        content.resize(it->second.size);
+        uint64_t done = 0;
+        while (done < content.size())
+        {
+            auto length = static_cast<int32_t>(
+              std::min<uint64_t>(content.size() - done, INT32_MAX));
+            int32_t count = mz_zip_entry_read(zip, content.data() + done, length);
+            if (count <= 0)
+            {
+                ok = false;
+                break;
+            }
+            done += static_cast<uint64_t>(count);
+        }
+        mz_zip_entry_close(zip);
+    }
+    releaseReader(reader);
+
+    if (!ok)
+    {
+        logs.error() << "I/O error: " << filename_.string() << ": impossible to read " << path;
+    }
+    return ok;
+}
+
+namespace
+{
+struct MountedArchive
+{
+    fs::path mountPoint;
+    std::unique_ptr<ZipArchive> archive;
+};
+
+std::vector<MountedArchive> gMountedArchives;
+std::shared_mutex gMountedArchivesMutex;
+// Avoid any lookup when no archive is mounted, which is the usual case
+std::atomic<bool> gHasMountedArchives = false;
+
+// The archive providing a path, and the path inside this archive
+// The caller must hold gMountedArchivesMutex
+std::pair<const ZipArchive*, std::string> locate(const fs::path& path)
+{
+    auto normalized = fs::absolute(path).lexically_normal();
+    for (const auto& [mountPoint, archive]: gMountedArchives)
+    {
+        auto relative = normalized.lexically_relative(mountPoint);
+        if (relative.empty() || *relative.begin() == "..")
+        {
+            continue;
+        }
+        auto name = relative.generic_string();
+        return {archive.get(), name == "." ? std::string() : normalizeEntryName(name)};
+    }
+    return {nullptr, {}};
+}
+} // namespace
+
+void mountArchive(const fs::path& archive, const fs::path& mountPoint)
+{
+    auto zip = std::make_unique<ZipArchive>(archive);
+    auto folder = fs::absolute(mountPoint).lexically_normal();
+    fs::create_directories(folder);
+
+    std::unique_lock lock(gMountedArchivesMutex);
+    gMountedArchives.push_back({folder, std::move(zip)});
+    gHasMountedArchives = true;
+}
+
+void unmountArchives()
+{
+    std::unique_lock lock(gMountedArchivesMutex);
+    gMountedArchives.clear();
+    gHasMountedArchives = false;
+}
+
+bool isArchivedFile(const fs::path& path)
+{
+    if (!gHasMountedArchives)
+    {
+        return false;
+    }
+    std::shared_lock lock(gMountedArchivesMutex);
+    auto [archive, name] = locate(path);
+    return archive && archive->containsFile(name);
+}
+
+bool readArchivedFile(const fs::path& path, std::string& content)
+{
+    if (!gHasMountedArchives)
+    {
+        return false;
+    }
+    std::shared_lock lock(gMountedArchivesMutex);
+    auto [archive, name] = locate(path);
+    return archive && archive->read(name, content);
+}
+
+bool readFileContent(const fs::path& path, std::string& content)
+{
+    if (isArchivedFile(path))
+    {
+        return readArchivedFile(path, content);
+    }
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+    {
+        return false;
+    }
+    content.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(content.data(), static_cast<std::streamsize>(content.size()));
+    return static_cast<bool>(file);
+}
+
+bool exists(const fs::path& path)
+{
+    if (gHasMountedArchives)
+    {
+        std::shared_lock lock(gMountedArchivesMutex);
+        if (auto [archive, name] = locate(path); archive && archive->contains(name))
+        {
+            return true;
+        }
+    }
+    return fs::exists(path);
+}
+
+} // namespace Antares::IO
@@ -144,7 +144,8 @@ bool fileSetContent(const std::string& filename, const std::string& content)
                 continue;
             }
         }
-        if (content.size() != out.write(content))
+        // Explicit size : the content may be binary, with null characters
+        if (content.size() != out.write(content.data(), content.size()))
         {
             continue; // not enough disk space
         }
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#ifndef __LIBS_ANTARES_IO_ARCHIVE_H__
+#define __LIBS_ANTARES_IO_ARCHIVE_H__
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Antares::IO
+{
+/*!
+** \brief Read-only zip archive
+**
+** Entries may be read from several threads at the same time: each thread
+** uses its own reader, so entries are decompressed in parallel.
+**
+** If the archive contains a single study folder (i.e. `study.antares` is not
+** at the root of the archive), paths are relative to this folder.
+*/
+class ZipArchive final
+{
+public:
+    //! Open an archive, throws on failure
+    explicit ZipArchive(const std::filesystem::path& filename);
+    ~ZipArchive();
+
+    ZipArchive(const ZipArchive&) = delete;
+    ZipArchive& operator=(const ZipArchive&) = delete;
+
+    //! Get if a file exists in the archive
+    bool containsFile(const std::string& path) const;
+    //! Get if a file or a folder exists in the archive
+    bool contains(const std::string& path) const;
+
+    //! Size of a file once decompressed
+    uint64_t fileSize(const std::string& path) const;
+
+    /*!
+    ** \brief Decompress a file
+    **
+    ** \return True if the file exists and could be read
+    */
+    bool read(const std::string& path, std::string& content) const;
+
+private:
+    struct Entry
+    {
+        //! Position of the entry in the central directory
+        int64_t position;
+        uint64_t size;
+    };
+
+    void* acquireReader() const;
+    void releaseReader(void* reader) const;
+
+    std::filesystem::path filename_;
+    std::unordered_map<std::string, Entry> files_;
+    std::unordered_set<std::string> folders_;
+
+    //! Readers not currently in use
+    mutable std::vector<void*> readers_;
+    mutable std::mutex readersMutex_;
+};
+
+/*!
+** \brief Make the content of an archive visible under a folder
+**
+** The files of the archive take precedence over the ones on disk in this folder.
+** Files which are not in the archive (e.g. outputs and logs) are read from and
+** written to the disk as usual. The folder is created if needed.
+*/
+void mountArchive(const std::filesystem::path& archive, const std::filesystem::path& mountPoint);
+
+//! Remove all mounted archives
+void unmountArchives();
+
+//! Get if a path is a file provided by a mounted archive
+bool isArchivedFile(const std::filesystem::path& path);
+
+/*!
+** \brief Read a file provided by a mounted archive
+**
+** \return True if the file belongs to a mounted archive and could be read
+*/
+bool readArchivedFile(const std::filesystem::path& path, std::string& content);
+
+/*!
+** \brief Read a file, from a mounted archive or from the disk
+**
+** \return True if the file could be read
+*/
+bool readFileContent(const std::filesystem::path& path, std::string& content);
+
+/*!
+** \brief Get if a file or folder exists, in a mounted archive or on the disk
+*/
+bool exists(const std::filesystem::path& path);
+
+} // namespace Antares::IO
+
+#endif // __LIBS_ANTARES_IO_ARCHIVE_H__
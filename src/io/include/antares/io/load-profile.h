@@ -0,0 +1,84 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#ifndef __LIBS_ANTARES_IO_LOAD_PROFILE_H__
+#define __LIBS_ANTARES_IO_LOAD_PROFILE_H__
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+namespace Antares::Statistics
+{
+/*!
+** \brief Start a new profile of the study loading
+**
+** Files are grouped by category, given by their first three folders
+** relative to \p studyFolder (e.g. `input/bindingconstraints`, `input/thermal/prepro`).
+*/
+void LoadProfileReset(const std::filesystem::path& studyFolder);
+
+/*!
+** \brief Notify that a file has been loaded
+**
+** \param bytes Size of the file
+** \param wait Time spent waiting for the content of the file
+** \param parse Time spent parsing the content
+*/
+void LoadProfileAddFile(const std::string& filename,
+                        uint64_t bytes,
+                        std::chrono::nanoseconds wait,
+                        std::chrono::nanoseconds parse);
+
+/*!
+** \brief Notify that a loading phase has ended
+**
+** Phases with the same name are accumulated.
+*/
+void LoadProfileAddPhase(const std::string& name, std::chrono::nanoseconds duration);
+
+/*!
+** \brief Get the profile as a text report
+**
+** \param slowestFiles Number of files to list, the slowest first
+*/
+std::string LoadProfileReport(unsigned slowestFiles = 20);
+
+/*!
+** \brief Measure a loading phase for the lifetime of the object
+*/
+class LoadPhase final
+{
+public:
+    explicit LoadPhase(std::string name);
+    ~LoadPhase();
+
+    LoadPhase(const LoadPhase&) = delete;
+    LoadPhase& operator=(const LoadPhase&) = delete;
+
+private:
+    std::string name_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace Antares::Statistics
+
+#endif // __LIBS_ANTARES_IO_LOAD_PROFILE_H__
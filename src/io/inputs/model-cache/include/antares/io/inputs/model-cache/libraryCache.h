@@ -0,0 +1,61 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <antares/study/system-model/library.h>
+
+namespace Antares::IO::Inputs::ModelCache
+{
+
+/**
+ * Version of the cache format. It must be increased with any change of the format, or of the way
+ * libraries are converted from yaml : caches of other versions are ignored.
+ */
+constexpr std::uint32_t FORMAT_VERSION = 1;
+
+/// Hash of the content of a library file (64 bits FNV-1a), the same across runs and platforms
+std::uint64_t hashContent(std::string_view content);
+
+/**
+ * @brief Binary form of a converted library, with its expression trees and their time index and
+ * linearity.
+ *
+ * @param library The library, converted from a file whose content has the hash contentHash.
+ * @throws std::invalid_argument If a model has ports, which are not stored.
+ */
+std::string serialize(const Study::SystemModel::Library& library, std::uint64_t contentHash);
+
+/**
+ * @brief Library stored by serialize.
+ *
+ * @return Nothing if data is not a cache of this version for a content of this hash, or is
+ * corrupted.
+ */
+std::optional<Study::SystemModel::Library> deserialize(std::string_view data,
+                                                       std::uint64_t contentHash);
+
+} // namespace Antares::IO::Inputs::ModelCache
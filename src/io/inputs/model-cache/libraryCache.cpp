@@ -0,0 +1,679 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#include "antares/io/inputs/model-cache/libraryCache.h"
+
+#include <cstring>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <antares/expressions/NodeInterner.h>
+#include <antares/expressions/nodes/ExpressionsNodes.h>
+#include <antares/expressions/visitors/NodeVisitor.h>
+#include <antares/study/system-model/model.h>
+
+namespace Antares::IO::Inputs::ModelCache
+{
+
+namespace SM = Study::SystemModel;
+using namespace Expressions::Nodes;
+using Expressions::Visitors::LinearStatus;
+using Expressions::Visitors::TimeIndex;
+
+namespace
+{
+constexpr char MAGIC[8] = {'A', 'N', 'T', 'S', 'M', 'L', 'I', 'B'};
+
+/// Kind of the nodes in the cache, never to be reordered
+enum class NodeKind : std::uint8_t
+{
+    LITERAL,
+    PARAMETER,
+    VARIABLE,
+    SUM,
+    SUBTRACTION,
+    MULTIPLICATION,
+    DIVISION,
+    NEGATION,
+    EQUAL,
+    LESS_THAN_OR_EQUAL,
+    GREATER_THAN_OR_EQUAL,
+    PORT_FIELD,
+    PORT_FIELD_SUM,
+    COMPONENT_VARIABLE,
+    COMPONENT_PARAMETER
+};
+
+/// The cache is shorter than announced, or refers to missing nodes
+class CorruptedCache
+{
+};
+
+class Writer
+{
+public:
+    template<class T>
+    requires std::is_arithmetic_v<T> || std::is_enum_v<T>
+    void write(T value)
+    {
+        const auto* bytes = reinterpret_cast<const char*>(&value);
+        data_.append(bytes, sizeof(T));
+    }
+
+    void write(const std::string& value)
+    {
+        write(static_cast<std::uint32_t>(value.size()));
+        data_.append(value);
+    }
+
+    void writeBytes(const char* bytes, std::size_t size)
+    {
+        data_.append(bytes, size);
+    }
+
+    std::string& data()
+    {
+        return data_;
+    }
+
+private:
+    std::string data_;
+};
+
+class Reader
+{
+public:
+    explicit Reader(std::string_view data):
+        data_(data)
+    {
+    }
+
+    template<class T>
+    requires std::is_arithmetic_v<T> || std::is_enum_v<T>
+    T read()
+    {
+        T value;
+        std::memcpy(&value, take(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    std::string readString()
+    {
+        const auto size = read<std::uint32_t>();
+        return std::string(take(size), size);
+    }
+
+    /// Number of elements to come, each one taking at least a byte
+    std::uint32_t readCount()
+    {
+        const auto count = read<std::uint32_t>();
+        if (count > data_.size() - position_)
+        {
+            throw CorruptedCache();
+        }
+        return count;
+    }
+
+    bool readBool()
+    {
+        return read<std::uint8_t>() != 0;
+    }
+
+    const char* take(std::size_t size)
+    {
+        if (size > data_.size() - position_)
+        {
+            throw CorruptedCache();
+        }
+        const char* bytes = data_.data() + position_;
+        position_ += size;
+        return bytes;
+    }
+
+    bool atEnd() const
+    {
+        return position_ == data_.size();
+    }
+
+private:
+    std::string_view data_;
+    std::size_t position_ = 0;
+};
+
+/**
+ * Writes the nodes of an expression in a table, children first. Shared sub-trees are written
+ * once, nodes refer to their children by their index in the table.
+ */
+class NodeWriter: public Expressions::Visitors::NodeVisitor<std::uint32_t>
+{
+public:
+    NodeWriter()
+    {
+        enableMemoization();
+    }
+
+    std::string name() const override
+    {
+        return "NodeWriter";
+    }
+
+    /// Table of the nodes of the tree of root, which is the last one
+    std::string table(const Node* root)
+    {
+        table_.data().clear();
+        count_ = 0;
+        dispatch(root);
+        Writer out;
+        out.write(count_);
+        out.writeBytes(table_.data().data(), table_.data().size());
+        return std::move(out.data());
+    }
+
+private:
+    std::uint32_t binary(NodeKind kind, const BinaryNode* node)
+    {
+        const auto left = dispatch(node->left());
+        const auto right = dispatch(node->right());
+        table_.write(kind);
+        table_.write(left);
+        table_.write(right);
+        return count_++;
+    }
+
+    template<class T>
+    std::uint32_t leaf(NodeKind kind, const T* node)
+    {
+        table_.write(kind);
+        table_.write(node->value());
+        table_.write(node->timeIndex());
+        return count_++;
+    }
+
+    std::uint32_t visit(const SumNode* node) override
+    {
+        std::vector<std::uint32_t> operands;
+        operands.reserve(node->size());
+        for (const auto* operand: node->getOperands())
+        {
+            operands.push_back(dispatch(operand));
+        }
+        table_.write(NodeKind::SUM);
+        table_.write(static_cast<std::uint32_t>(operands.size()));
+        for (auto operand: operands)
+        {
+            table_.write(operand);
+        }
+        return count_++;
+    }
+
+    std::uint32_t visit(const SubtractionNode* node) override
+    {
+        return binary(NodeKind::SUBTRACTION, node);
+    }
+
+    std::uint32_t visit(const MultiplicationNode* node) override
+    {
+        return binary(NodeKind::MULTIPLICATION, node);
+    }
+
+    std::uint32_t visit(const DivisionNode* node) override
+    {
+        return binary(NodeKind::DIVISION, node);
+    }
+
+    std::uint32_t visit(const EqualNode* node) override
+    {
+        return binary(NodeKind::EQUAL, node);
+    }
+
+    std::uint32_t visit(const LessThanOrEqualNode* node) override
+    {
+        return binary(NodeKind::LESS_THAN_OR_EQUAL, node);
+    }
+
+    std::uint32_t visit(const GreaterThanOrEqualNode* node) override
+    {
+        return binary(NodeKind::GREATER_THAN_OR_EQUAL, node);
+    }
+
+    std::uint32_t visit(const NegationNode* node) override
+    {
+        const auto child = dispatch(node->child());
+        table_.write(NodeKind::NEGATION);
+        table_.write(child);
+        return count_++;
+    }
+
+    std::uint32_t visit(const VariableNode* node) override
+    {
+        return leaf(NodeKind::VARIABLE, node);
+    }
+
+    std::uint32_t visit(const ParameterNode* node) override
+    {
+        return leaf(NodeKind::PARAMETER, node);
+    }
+
+    std::uint32_t visit(const LiteralNode* node) override
+    {
+        table_.write(NodeKind::LITERAL);
+        table_.write(node->value());
+        return count_++;
+    }
+
+    std::uint32_t visit(const PortFieldNode* node) override
+    {
+        table_.write(NodeKind::PORT_FIELD);
+        table_.write(node->getPortName());
+        table_.write(node->getFieldName());
+        return count_++;
+    }
+
+    std::uint32_t visit(const PortFieldSumNode* node) override
+    {
+        table_.write(NodeKind::PORT_FIELD_SUM);
+        table_.write(node->getPortName());
+        table_.write(node->getFieldName());
+        return count_++;
+    }
+
+    std::uint32_t visit(const ComponentVariableNode* node) override
+    {
+        table_.write(NodeKind::COMPONENT_VARIABLE);
+        table_.write(node->getComponentId());
+        table_.write(node->getComponentName());
+        return count_++;
+    }
+
+    std::uint32_t visit(const ComponentParameterNode* node) override
+    {
+        table_.write(NodeKind::COMPONENT_PARAMETER);
+        table_.write(node->getComponentId());
+        table_.write(node->getComponentName());
+        return count_++;
+    }
+
+    Writer table_;
+    std::uint32_t count_ = 0;
+};
+
+// The nodes of all the expressions of a library are created in the same sharing registry
+using SharedRegistry = std::shared_ptr<Expressions::Registry<Node>>;
+
+Expressions::NodeRegistry readNodes(Reader& in, const SharedRegistry& registry)
+{
+    const auto count = in.readCount();
+    if (count == 0)
+    {
+        return {};
+    }
+
+    std::vector<Node*> nodes;
+    nodes.reserve(count);
+    auto child = [&in, &nodes]
+    {
+        const auto index = in.read<std::uint32_t>();
+        if (index >= nodes.size())
+        {
+            throw CorruptedCache();
+        }
+        return nodes[index];
+    };
+
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        Node* node = nullptr;
+        switch (in.read<NodeKind>())
+        {
+        case NodeKind::LITERAL:
+            node = registry->create<LiteralNode>(in.read<double>());
+            break;
+        case NodeKind::PARAMETER:
+        {
+            auto id = in.readString();
+            node = registry->create<ParameterNode>(id, in.read<TimeIndex>());
+            break;
+        }
+        case NodeKind::VARIABLE:
+        {
+            auto id = in.readString();
+            node = registry->create<VariableNode>(id, in.read<TimeIndex>());
+            break;
+        }
+        case NodeKind::SUM:
+        {
+            std::vector<Node*> operands(in.readCount());
+            for (auto& operand: operands)
+            {
+                operand = child();
+            }
+            node = registry->create<SumNode>(std::move(operands));
+            break;
+        }
+        case NodeKind::SUBTRACTION:
+        {
+            auto* left = child();
+            node = registry->create<SubtractionNode>(left, child());
+            break;
+        }
+        case NodeKind::MULTIPLICATION:
+        {
+            auto* left = child();
+            node = registry->create<MultiplicationNode>(left, child());
+            break;
+        }
+        case NodeKind::DIVISION:
+        {
+            auto* left = child();
+            node = registry->create<DivisionNode>(left, child());
+            break;
+        }
+        case NodeKind::EQUAL:
+        {
+            auto* left = child();
+            node = registry->create<EqualNode>(left, child());
+            break;
+        }
+        case NodeKind::LESS_THAN_OR_EQUAL:
+        {
+            auto* left = child();
+            node = registry->create<LessThanOrEqualNode>(left, child());
+            break;
+        }
+        case NodeKind::GREATER_THAN_OR_EQUAL:
+        {
+            auto* left = child();
+            node = registry->create<GreaterThanOrEqualNode>(left, child());
+            break;
+        }
+        case NodeKind::NEGATION:
+            node = registry->create<NegationNode>(child());
+            break;
+        case NodeKind::PORT_FIELD:
+        {
+            auto port = in.readString();
+            node = registry->create<PortFieldNode>(port, in.readString());
+            break;
+        }
+        case NodeKind::PORT_FIELD_SUM:
+        {
+            auto port = in.readString();
+            node = registry->create<PortFieldSumNode>(port, in.readString());
+            break;
+        }
+        case NodeKind::COMPONENT_VARIABLE:
+        {
+            auto component = in.readString();
+            node = registry->create<ComponentVariableNode>(component, in.readString());
+            break;
+        }
+        case NodeKind::COMPONENT_PARAMETER:
+        {
+            auto component = in.readString();
+            node = registry->create<ComponentParameterNode>(component, in.readString());
+            break;
+        }
+        default:
+            throw CorruptedCache();
+        }
+        nodes.push_back(node);
+    }
+    return Expressions::NodeRegistry(nodes.back(), registry);
+}
+
+void writeExpression(Writer& out, NodeWriter& nodeWriter, const SM::Expression& expression)
+{
+    out.write(static_cast<std::uint8_t>(expression.Empty()));
+    if (expression.Empty())
+    {
+        return;
+    }
+    out.write(expression.Value());
+    const auto timeIndex = expression.timeIndex();
+    out.write(static_cast<std::uint8_t>(timeIndex.has_value()));
+    out.write(timeIndex.value_or(TimeIndex::CONSTANT_IN_TIME_AND_SCENARIO));
+    out.write(expression.linearStatus());
+    if (!expression.RootNode())
+    {
+        out.write(std::uint32_t{0});
+        return;
+    }
+    const auto table = nodeWriter.table(expression.RootNode());
+    out.writeBytes(table.data(), table.size());
+}
+
+SM::Expression readExpression(Reader& in, const SharedRegistry& registry)
+{
+    if (in.readBool())
+    {
+        return {};
+    }
+    auto value = in.readString();
+    const bool hasTimeIndex = in.readBool();
+    const auto timeIndex = in.read<TimeIndex>();
+    const auto linearStatus = in.read<LinearStatus>();
+    return SM::Expression(value,
+                          readNodes(in, registry),
+                          hasTimeIndex ? std::optional(timeIndex) : std::nullopt,
+                          linearStatus);
+}
+
+void writeModel(Writer& out, NodeWriter& nodeWriter, const SM::Model& model)
+{
+    if (!model.Ports().empty())
+    {
+        throw std::invalid_argument("The ports of model '" + model.Id()
+                                    + "' can't be stored in a cache");
+    }
+    out.write(model.Id());
+    writeExpression(out, nodeWriter, model.Objective());
+
+    out.write(static_cast<std::uint32_t>(model.Parameters().size()));
+    for (const auto& [id, parameter]: model.Parameters())
+    {
+        out.write(id);
+        out.write(static_cast<std::uint8_t>(parameter.isTimeDependent()));
+        out.write(static_cast<std::uint8_t>(parameter.isScenarioDependent()));
+    }
+
+    out.write(static_cast<std::uint32_t>(model.Variables().size()));
+    for (const auto& [id, variable]: model.Variables())
+    {
+        out.write(id);
+        writeExpression(out, nodeWriter, variable.LowerBound());
+        writeExpression(out, nodeWriter, variable.UpperBound());
+        out.write(variable.Type());
+        out.write(static_cast<std::uint8_t>(variable.isTimeDependent()));
+        out.write(static_cast<std::uint8_t>(variable.IsScenarioDependent()));
+    }
+
+    out.write(static_cast<std::uint32_t>(model.getConstraints().size()));
+    for (const auto& [id, constraint]: model.getConstraints())
+    {
+        out.write(id);
+        writeExpression(out, nodeWriter, constraint.expression());
+    }
+}
+
+SM::Model readModel(Reader& in, const SharedRegistry& registry)
+{
+    SM::ModelBuilder builder;
+    builder.withId(in.readString());
+    builder.withObjective(readExpression(in, registry));
+
+    std::vector<SM::Parameter> parameters;
+    const auto nbParameters = in.readCount();
+    for (std::uint32_t i = 0; i < nbParameters; ++i)
+    {
+        auto id = in.readString();
+        const auto timeDependent = SM::fromBool<SM::TimeDependent>(in.readBool());
+        parameters.emplace_back(std::move(id),
+                                timeDependent,
+                                SM::fromBool<SM::ScenarioDependent>(in.readBool()));
+    }
+
+    std::vector<SM::Variable> variables;
+    const auto nbVariables = in.readCount();
+    for (std::uint32_t i = 0; i < nbVariables; ++i)
+    {
+        auto id = in.readString();
+        auto lowerBound = readExpression(in, registry);
+        auto upperBound = readExpression(in, registry);
+        const auto type = in.read<SM::ValueType>();
+        const auto timeDependent = SM::fromBool<SM::TimeDependent>(in.readBool());
+        variables.emplace_back(std::move(id),
+                               std::move(lowerBound),
+                               std::move(upperBound),
+                               type,
+                               timeDependent,
+                               SM::fromBool<SM::ScenarioDependent>(in.readBool()));
+    }
+
+    std::vector<SM::Constraint> constraints;
+    const auto nbConstraints = in.readCount();
+    for (std::uint32_t i = 0; i < nbConstraints; ++i)
+    {
+        auto id = in.readString();
+        constraints.emplace_back(std::move(id), readExpression(in, registry));
+    }
+
+    return builder.withParameters(std::move(parameters))
+      .withVariables(std::move(variables))
+      .withConstraints(std::move(constraints))
+      .build();
+}
+
+} // namespace
+
+std::uint64_t hashContent(std::string_view content)
+{
+    std::uint64_t hash = 14695981039346656037ull;
+    for (char c: content)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::string serialize(const SM::Library& library, std::uint64_t contentHash)
+{
+    Writer out;
+    out.writeBytes(MAGIC, sizeof(MAGIC));
+    out.write(FORMAT_VERSION);
+    out.write(contentHash);
+
+    out.write(library.Id());
+    out.write(library.Description());
+
+    out.write(static_cast<std::uint32_t>(library.PortTypes().size()));
+    for (const auto& portType: library.PortTypes() | std::views::values)
+    {
+        out.write(portType.Id());
+        out.write(portType.Description());
+        out.write(static_cast<std::uint32_t>(portType.Fields().size()));
+        for (const auto& field: portType.Fields())
+        {
+            out.write(field.Id());
+        }
+    }
+
+    NodeWriter nodeWriter;
+    out.write(static_cast<std::uint32_t>(library.Models().size()));
+    for (const auto& model: library.Models() | std::views::values)
+    {
+        writeModel(out, nodeWriter, model);
+    }
+
+    // Checksum of all the above, against files damaged on disk
+    out.write(hashContent(out.data()));
+    return std::move(out.data());
+}
+
+std::optional<SM::Library> deserialize(std::string_view data, std::uint64_t contentHash)
+{
+    constexpr auto checksumSize = sizeof(std::uint64_t);
+    if (data.size() < checksumSize)
+    {
+        return std::nullopt;
+    }
+    std::uint64_t checksum;
+    std::memcpy(&checksum, data.data() + data.size() - checksumSize, checksumSize);
+    data.remove_suffix(checksumSize);
+    if (checksum != hashContent(data))
+    {
+        return std::nullopt;
+    }
+
+    Reader in(data);
+    try
+    {
+        if (std::memcmp(in.take(sizeof(MAGIC)), MAGIC, sizeof(MAGIC)) != 0
+            || in.read<std::uint32_t>() != FORMAT_VERSION
+            || in.read<std::uint64_t>() != contentHash)
+        {
+            return std::nullopt;
+        }
+
+        SM::LibraryBuilder builder;
+        builder.withId(in.readString());
+        builder.withDescription(in.readString());
+
+        std::vector<SM::PortType> portTypes;
+        const auto nbPortTypes = in.readCount();
+        for (std::uint32_t i = 0; i < nbPortTypes; ++i)
+        {
+            auto id = in.readString();
+            auto description = in.readString();
+            std::vector<SM::PortField> fields;
+            const auto nbFields = in.readCount();
+            for (std::uint32_t j = 0; j < nbFields; ++j)
+            {
+                fields.emplace_back(in.readString());
+            }
+            portTypes.emplace_back(id, description, std::move(fields));
+        }
+
+        std::vector<SM::Model> models;
+        const auto registry = std::make_shared<Expressions::Registry<Node>>(
+          Expressions::makeSharingRegistry());
+        const auto nbModels = in.readCount();
+        for (std::uint32_t i = 0; i < nbModels; ++i)
+        {
+            models.push_back(readModel(in, registry));
+        }
+
+        if (!in.atEnd())
+        {
+            return std::nullopt;
+        }
+        return builder.withPortTypes(std::move(portTypes)).withModels(std::move(models)).build();
+    }
+    catch (const CorruptedCache&)
+    {
+        return std::nullopt;
+    }
+}
+
+} // namespace Antares::IO::Inputs::ModelCache
@@ -19,6 +19,7 @@
  * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
  */
 
+#include <antares/expressions/NodeInterner.h>
 #include <antares/expressions/nodes/ExpressionsNodes.h>
 #include <antares/io/inputs/model-converter/convertorVisitor.h>
 
@@ -69,6 +70,36 @@ private:
     const YmlModel::Model& model_;
 };
 
+/// An expression parsed by ANTLR, the tree lives as long as its parser
+struct ExpressionCache::ParsedExpression
+{
+    explicit ParsedExpression(const std::string& exprStr):
+        input(exprStr),
+        lexer(&input),
+        tokens(&lexer),
+        parser(&tokens),
+        tree(parser.expr())
+    {
+    }
+
+    antlr4::ANTLRInputStream input;
+    ExprLexer lexer;
+    antlr4::CommonTokenStream tokens;
+    ExprParser parser;
+    ExprParser::ExprContext* tree;
+};
+
+// Repeated sub-expressions are created once in a sharing registry
+static Expressions::NodeRegistry convertTree(
+  ExprParser::ExprContext* tree,
+  const YmlModel::Model& model,
+  std::shared_ptr<Expressions::Registry<Node>> registry)
+{
+    ConvertorVisitor visitor(*registry, model);
+    auto root = std::any_cast<Node*>(visitor.visit(tree));
+    return Expressions::NodeRegistry(root, std::move(registry));
+}
+
 Expressions::NodeRegistry convertExpressionToNode(const std::string& exprStr,
                                                   const YmlModel::Model& model)
 {
@@ -81,11 +112,32 @@ Expressions::NodeRegistry convertExpressionToNode(const std::string& exprStr,
     antlr4::CommonTokenStream tokens(&lexer);
     ExprParser parser(&tokens);
 
-    ExprParser::ExprContext* tree = parser.expr();
-    Expressions::Registry<Node> registry;
-    ConvertorVisitor visitor(registry, model);
-    auto root = std::any_cast<Node*>(visitor.visit(tree));
-    return Expressions::NodeRegistry(root, std::move(registry));
+    return convertTree(parser.expr(),
+                       model,
+                       std::make_shared<Expressions::Registry<Node>>(
+                         Expressions::makeSharingRegistry()));
+}
+
+ExpressionCache::ExpressionCache():
+    registry_(std::make_shared<Expressions::Registry<Node>>(Expressions::makeSharingRegistry()))
+{
+}
+
+ExpressionCache::~ExpressionCache() = default;
+
+Expressions::NodeRegistry ExpressionCache::convert(const std::string& exprStr,
+                                                   const YmlModel::Model& model)
+{
+    if (exprStr.empty())
+    {
+        return {};
+    }
+    auto it = parsed_.find(exprStr);
+    if (it == parsed_.end())
+    {
+        it = parsed_.emplace(exprStr, std::make_unique<ParsedExpression>(exprStr)).first;
+    }
+    return convertTree(it->second->tree, model, registry_);
 }
 
 ConvertorVisitor::ConvertorVisitor(Expressions::Registry<Node>& registry,
@@ -21,6 +21,10 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+#include <unordered_map>
+
 #include <ExprVisitor.h>
 
 #include <antares/expressions/NodeRegistry.h>
@@ -31,4 +35,24 @@ namespace Antares::IO::Inputs::ModelConverter
 
 Expressions::NodeRegistry convertExpressionToNode(const std::string& exprStr,
                                                   const YmlModel::Model& model);
+
+/**
+ * Parse trees of expressions, by text. The models of a library repeat the same bounds and terms :
+ * each distinct text is parsed once, then converted for every model using it, as identifiers are
+ * resolved against the model. All the converted expressions share one registry, in which the
+ * identical sub-trees of different models are the same nodes.
+ */
+class ExpressionCache
+{
+public:
+    ExpressionCache();
+    ~ExpressionCache();
+
+    Expressions::NodeRegistry convert(const std::string& exprStr, const YmlModel::Model& model);
+
+private:
+    struct ParsedExpression;
+    std::unordered_map<std::string, std::unique_ptr<ParsedExpression>> parsed_;
+    std::shared_ptr<Expressions::Registry<Expressions::Nodes::Node>> registry_;
+};
 } // namespace Antares::IO::Inputs::ModelConverter
@@ -115,7 +115,8 @@ Antares::Study::SystemModel::ValueType convertType(Antares::IO::Inputs::YmlModel
  * \param model The YmlModel::Model object containing ports.
  * \return A vector of SystemModel::Port objects.
  */
-std::vector<Antares::Study::SystemModel::Variable> convertVariables(const YmlModel::Model& model)
+std::vector<Antares::Study::SystemModel::Variable> convertVariables(const YmlModel::Model& model,
+                                                                    ExpressionCache& cache)
 {
     namespace SM = Antares::Study::SystemModel;
 
@@ -123,10 +124,8 @@ std::vector<Antares::Study::SystemModel::Variable> convertVariables(const YmlMod
     variables.reserve(model.variables.size());
     for (const auto& variable: model.variables)
     {
-        SM::Expression lb(variable.lower_bound,
-                          convertExpressionToNode(variable.lower_bound, model));
-        SM::Expression ub(variable.upper_bound,
-                          convertExpressionToNode(variable.upper_bound, model));
+        SM::Expression lb(variable.lower_bound, cache.convert(variable.lower_bound, model));
+        SM::Expression ub(variable.upper_bound, cache.convert(variable.upper_bound, model));
         variables.emplace_back(variable.id,
                                std::move(lb),
                                std::move(ub),
@@ -151,13 +150,14 @@ std::vector<Antares::Study::SystemModel::Port> convertPorts(
 }
 
 std::vector<Antares::Study::SystemModel::Constraint> convertConstraints(
-  const Antares::IO::Inputs::YmlModel::Model& model)
+  const Antares::IO::Inputs::YmlModel::Model& model,
+  ExpressionCache& cache)
 {
     std::vector<Antares::Study::SystemModel::Constraint> constraints;
     constraints.reserve(model.constraints.size());
     for (const auto& constraint: model.constraints)
     {
-        auto nodeRegistry = convertExpressionToNode(constraint.expression, model);
+        auto nodeRegistry = cache.convert(constraint.expression, model);
         constraints.emplace_back(constraint.id,
                                  Antares::Study::SystemModel::Expression{constraint.expression,
                                                                          std::move(nodeRegistry)});
@@ -176,16 +176,19 @@ std::vector<Antares::Study::SystemModel::Model> convertModels(
 {
     std::vector<Antares::Study::SystemModel::Model> models;
     models.reserve(library.models.size());
+    ExpressionCache cache;
     for (const auto& model: library.models)
     {
         Antares::Study::SystemModel::ModelBuilder modelBuilder;
         std::vector<Antares::Study::SystemModel::Parameter> parameters = convertParameters(model);
-        std::vector<Antares::Study::SystemModel::Variable> variables = convertVariables(model);
+        std::vector<Antares::Study::SystemModel::Variable> variables = convertVariables(model,
+                                                                                       cache);
         std::vector<Antares::Study::SystemModel::Port> ports = convertPorts(model);
         std::vector<Antares::Study::SystemModel::Constraint> constraints = convertConstraints(
-          model);
+          model,
+          cache);
 
-        auto nodeObjective = convertExpressionToNode(model.objective, model);
+        auto nodeObjective = cache.convert(model.objective, model);
 
         auto modelObj = modelBuilder.withId(model.id)
                           .withObjective(
@@ -21,14 +21,31 @@
 
 #include "antares/io/inputs/yml-system/parser.h"
 
+#include <istream>
+#include <streambuf>
+
 #include "antares/io/inputs/yml-system/system.h"
 
 #include "decoders.hxx"
+#include "systemEventHandler.h"
 
 namespace Antares::IO::Inputs::YmlSystem
 {
 
-System Parser::parse(const std::string& content)
+namespace
+{
+// Reads the content in place, where an istringstream would copy it
+class MemoryBuffer: public std::streambuf
+{
+public:
+    explicit MemoryBuffer(const std::string& content)
+    {
+        char* begin = const_cast<char*>(content.data());
+        setg(begin, begin, begin + content.size());
+    }
+};
+
+System parseDocument(const std::string& content)
 {
     YAML::Node root = YAML::Load(content);
 
@@ -36,5 +53,27 @@ System Parser::parse(const std::string& content)
 
     return system;
 }
+} // namespace
+
+System Parser::parse(const std::string& content)
+{
+    MemoryBuffer buffer(content);
+    std::istream stream(&buffer);
+    YAML::Parser parser(stream);
+    SystemEventHandler handler;
+    try
+    {
+        if (!parser.HandleNextDocument(handler))
+        {
+            throw YAML::ParserException(YAML::Mark::null_mark(), "empty system file");
+        }
+    }
+    catch (const SystemEventHandler::AliasFound&)
+    {
+        // Aliases need the whole document to be resolved
+        return parseDocument(content);
+    }
+    return std::move(handler.system());
+}
 
 } // namespace Antares::IO::Inputs::YmlSystem
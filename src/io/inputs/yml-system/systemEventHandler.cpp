@@ -0,0 +1,363 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#include "systemEventHandler.h"
+
+#include <cctype>
+#include <charconv>
+
+#include "yaml-cpp/yaml.h"
+
+namespace Antares::IO::Inputs::YmlSystem
+{
+
+namespace
+{
+// Keys already read in a map, the first occurrence of a key wins like with YAML::Node lookups
+enum Key : unsigned
+{
+    SYSTEM = 1 << 0,
+    ID = 1 << 1,
+    LIBRARIES = 1 << 2,
+    COMPONENTS = 1 << 3,
+    MODEL = 1 << 4,
+    SCENARIO_GROUP = 1 << 5,
+    PARAMETERS = 1 << 6,
+    TYPE = 1 << 7,
+    VALUE = 1 << 8
+};
+
+unsigned keyOf(const std::string& key)
+{
+    if (key == "system")
+    {
+        return SYSTEM;
+    }
+    if (key == "id")
+    {
+        return ID;
+    }
+    if (key == "model-libraries")
+    {
+        return LIBRARIES;
+    }
+    if (key == "components")
+    {
+        return COMPONENTS;
+    }
+    if (key == "model")
+    {
+        return MODEL;
+    }
+    if (key == "scenario-group")
+    {
+        return SCENARIO_GROUP;
+    }
+    if (key == "parameters")
+    {
+        return PARAMETERS;
+    }
+    if (key == "type")
+    {
+        return TYPE;
+    }
+    if (key == "value")
+    {
+        return VALUE;
+    }
+    return 0;
+}
+
+[[noreturn]] void throwAt(const YAML::Mark& mark, const std::string& message)
+{
+    throw YAML::ParserException(mark, message);
+}
+
+double toDouble(const YAML::Mark& mark, const std::string& value)
+{
+    // Plain decimal numbers are the common case, anything else goes through yaml-cpp
+    if (!value.empty() && std::isdigit(static_cast<unsigned char>(value.back())))
+    {
+        double result;
+        const char* end = value.data() + value.size();
+        auto [ptr, ec] = std::from_chars(value.data(), end, result);
+        if (ec == std::errc() && ptr == end)
+        {
+            return result;
+        }
+    }
+    try
+    {
+        return YAML::Node(value).as<double>();
+    }
+    catch (const YAML::BadConversion&)
+    {
+        throwAt(mark, "bad conversion of '" + value + "' to a number");
+    }
+}
+
+} // namespace
+
+System& SystemEventHandler::system()
+{
+    return system_;
+}
+
+void SystemEventHandler::OnDocumentStart(const YAML::Mark& mark)
+{
+    frames_.assign(1, Frame{.state = State::DOCUMENT, .mark = mark});
+}
+
+void SystemEventHandler::OnDocumentEnd()
+{
+    if (!systemFound_)
+    {
+        throwAt(frames_.front().mark, "missing key 'system'");
+    }
+}
+
+void SystemEventHandler::OnNull(const YAML::Mark& mark, YAML::anchor_t)
+{
+    onValue(mark, Event::NULL_VALUE, nullptr);
+}
+
+void SystemEventHandler::OnAlias(const YAML::Mark&, YAML::anchor_t)
+{
+    throw AliasFound();
+}
+
+void SystemEventHandler::OnScalar(const YAML::Mark& mark,
+                                  const std::string&,
+                                  YAML::anchor_t,
+                                  const std::string& value)
+{
+    onValue(mark, Event::SCALAR, &value);
+}
+
+void SystemEventHandler::OnSequenceStart(const YAML::Mark& mark,
+                                         const std::string&,
+                                         YAML::anchor_t,
+                                         YAML::EmitterStyle::value)
+{
+    onCollectionStart(mark, Event::SEQUENCE);
+}
+
+void SystemEventHandler::OnSequenceEnd()
+{
+    onCollectionEnd();
+}
+
+void SystemEventHandler::OnMapStart(const YAML::Mark& mark,
+                                    const std::string&,
+                                    YAML::anchor_t,
+                                    YAML::EmitterStyle::value)
+{
+    onCollectionStart(mark, Event::MAP);
+}
+
+void SystemEventHandler::OnMapEnd()
+{
+    onCollectionEnd();
+}
+
+void SystemEventHandler::onCollectionStart(const YAML::Mark& mark, Event event)
+{
+    const State state = onValue(mark, event, nullptr);
+    frames_.push_back(Frame{.state = state, .mark = mark});
+}
+
+void SystemEventHandler::onCollectionEnd()
+{
+    const Frame& frame = frames_.back();
+    auto require = [&frame](unsigned key, const char* name)
+    {
+        if (!(frame.found & key))
+        {
+            throwAt(frame.mark, std::string("missing key '") + name + "'");
+        }
+    };
+
+    switch (frame.state)
+    {
+    case State::SYSTEM:
+        require(ID, "id");
+        break;
+    case State::COMPONENT:
+        require(ID, "id");
+        require(MODEL, "model");
+        require(SCENARIO_GROUP, "scenario-group");
+        break;
+    case State::PARAMETER:
+        require(ID, "id");
+        require(TYPE, "type");
+        require(VALUE, "value");
+        break;
+    default:
+        break;
+    }
+    frames_.pop_back();
+}
+
+SystemEventHandler::State SystemEventHandler::onValue(const YAML::Mark& mark,
+                                                      Event event,
+                                                      const std::string* scalar)
+{
+    Frame& frame = frames_.back();
+    const bool isMap = frame.state == State::ROOT || frame.state == State::SYSTEM
+                       || frame.state == State::COMPONENT || frame.state == State::PARAMETER;
+
+    if (isMap)
+    {
+        frame.expectKey = !frame.expectKey;
+        if (!frame.expectKey)
+        {
+            // Null and complex keys match nothing
+            frame.key = scalar ? *scalar : std::string();
+            return State::SKIP;
+        }
+    }
+
+    auto expect = [&mark, event](Event expected, const std::string& what)
+    {
+        if (event != expected)
+        {
+            throwAt(mark, "expected a " + what);
+        }
+    };
+    // Like YAML::Node::as<std::string>, null values are read as "null"
+    auto asString = [event, scalar]()
+    {
+        return event == Event::NULL_VALUE ? std::string("null") : *scalar;
+    };
+    auto readScalar = [&](std::string& field)
+    {
+        frame.found |= keyOf(frame.key);
+        if (event != Event::NULL_VALUE)
+        {
+            expect(Event::SCALAR, "scalar for '" + frame.key + "'");
+        }
+        field = asString();
+        return State::SKIP;
+    };
+
+    switch (frame.state)
+    {
+    case State::DOCUMENT:
+        expect(Event::MAP, "map");
+        return State::ROOT;
+    case State::LIBRARIES:
+        if (event != Event::NULL_VALUE)
+        {
+            expect(Event::SCALAR, "library name");
+        }
+        system_.libraries.push_back(asString());
+        return State::SKIP;
+    case State::COMPONENTS:
+        expect(Event::MAP, "component");
+        system_.components.emplace_back();
+        return State::COMPONENT;
+    case State::PARAMETERS:
+        expect(Event::MAP, "parameter");
+        system_.components.back().parameters.emplace_back();
+        return State::PARAMETER;
+    case State::SKIP:
+        return State::SKIP;
+    default:
+        break;
+    }
+
+    // Value of a key of interest, read once
+    const unsigned key = keyOf(frame.key);
+    if (frame.found & key)
+    {
+        return State::SKIP;
+    }
+
+    if (frame.state == State::ROOT)
+    {
+        if (key == SYSTEM)
+        {
+            frame.found |= key;
+            systemFound_ = true;
+            expect(Event::MAP, "map for 'system'");
+            return State::SYSTEM;
+        }
+        return State::SKIP;
+    }
+
+    if (frame.state == State::SYSTEM)
+    {
+        switch (key)
+        {
+        case ID:
+            return readScalar(system_.id);
+        case LIBRARIES:
+            // Anything else than a sequence means no library
+            frame.found |= key;
+            return event == Event::SEQUENCE ? State::LIBRARIES : State::SKIP;
+        case COMPONENTS:
+            frame.found |= key;
+            return event == Event::SEQUENCE ? State::COMPONENTS : State::SKIP;
+        default:
+            return State::SKIP;
+        }
+    }
+
+    if (frame.state == State::COMPONENT)
+    {
+        Component& component = system_.components.back();
+        switch (key)
+        {
+        case ID:
+            return readScalar(component.id);
+        case MODEL:
+            return readScalar(component.model);
+        case SCENARIO_GROUP:
+            return readScalar(component.scenarioGroup);
+        case PARAMETERS:
+            frame.found |= key;
+            return event == Event::SEQUENCE ? State::PARAMETERS : State::SKIP;
+        default:
+            return State::SKIP;
+        }
+    }
+
+    // State::PARAMETER
+    Parameter& parameter = system_.components.back().parameters.back();
+    switch (key)
+    {
+    case ID:
+        return readScalar(parameter.id);
+    case TYPE:
+        return readScalar(parameter.type);
+    case VALUE:
+    {
+        std::string value;
+        readScalar(value);
+        parameter.value = toDouble(mark, value);
+        return State::SKIP;
+    }
+    default:
+        return State::SKIP;
+    }
+}
+
+} // namespace Antares::IO::Inputs::YmlSystem
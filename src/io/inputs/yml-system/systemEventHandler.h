@@ -0,0 +1,113 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "antares/io/inputs/yml-system/system.h"
+
+#include "yaml-cpp/eventhandler.h"
+#include "yaml-cpp/mark.h"
+
+namespace Antares::IO::Inputs::YmlSystem
+{
+
+/**
+ * @brief Builds a System from the events of the yaml parser, without loading the whole document.
+ *
+ * It accepts the documents the decoders of decoders.hxx accept, and throws a YAML::Exception on
+ * the same errors. Aliases are not resolved : AliasFound is thrown on the first one.
+ */
+class SystemEventHandler final: public YAML::EventHandler
+{
+public:
+    struct AliasFound
+    {
+    };
+
+    System& system();
+
+    void OnDocumentStart(const YAML::Mark&) override;
+    void OnDocumentEnd() override;
+    void OnNull(const YAML::Mark& mark, YAML::anchor_t) override;
+    void OnAlias(const YAML::Mark&, YAML::anchor_t) override;
+    void OnScalar(const YAML::Mark& mark,
+                  const std::string&,
+                  YAML::anchor_t,
+                  const std::string& value) override;
+    void OnSequenceStart(const YAML::Mark& mark,
+                         const std::string&,
+                         YAML::anchor_t,
+                         YAML::EmitterStyle::value) override;
+    void OnSequenceEnd() override;
+    void OnMapStart(const YAML::Mark& mark,
+                    const std::string&,
+                    YAML::anchor_t,
+                    YAML::EmitterStyle::value) override;
+    void OnMapEnd() override;
+
+private:
+    enum class State
+    {
+        DOCUMENT,
+        ROOT,
+        SYSTEM,
+        LIBRARIES,
+        COMPONENTS,
+        COMPONENT,
+        PARAMETERS,
+        PARAMETER,
+        // Content of no interest
+        SKIP
+    };
+
+    enum class Event
+    {
+        NULL_VALUE,
+        SCALAR,
+        SEQUENCE,
+        MAP
+    };
+
+    struct Frame
+    {
+        State state;
+        YAML::Mark mark;
+        // For maps : whether the next event is a key, and the last key
+        bool expectKey = true;
+        std::string key = {};
+        // Required keys found so far
+        unsigned found = 0;
+    };
+
+    // Returns the state of the collection starting with event, for a value of the current frame
+    State onValue(const YAML::Mark& mark, Event event, const std::string* scalar);
+    void onCollectionStart(const YAML::Mark& mark, Event event);
+    void onCollectionEnd();
+
+    System system_;
+    bool systemFound_ = false;
+    std::vector<Frame> frames_;
+};
+
+} // namespace Antares::IO::Inputs::YmlSystem
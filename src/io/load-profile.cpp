@@ -0,0 +1,231 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#include "antares/io/load-profile.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace Antares::Statistics
+{
+namespace
+{
+using Duration = std::chrono::nanoseconds;
+
+struct FileRecord
+{
+    std::string filename;
+    uint64_t bytes;
+    Duration wait;
+    Duration parse;
+
+    Duration total() const
+    {
+        return wait + parse;
+    }
+};
+
+struct CategoryTotal
+{
+    uint64_t files = 0;
+    uint64_t bytes = 0;
+    Duration wait{0};
+    Duration parse{0};
+};
+
+struct PhaseTotal
+{
+    uint64_t count = 0;
+    Duration duration{0};
+};
+
+//! Number of files kept for the list of the slowest ones
+constexpr size_t slowestFilesKept = 200;
+
+struct Profile
+{
+    std::mutex mutex;
+    fs::path studyFolder;
+    std::map<std::string, CategoryTotal> categories;
+    //! Phases, in the order of their first occurrence
+    std::vector<std::pair<std::string, PhaseTotal>> phases;
+    //! The slowest files, as a min-heap on their total time
+    std::vector<FileRecord> slowest;
+};
+
+Profile& profile()
+{
+    static Profile instance;
+    return instance;
+}
+
+bool isSlower(const FileRecord& a, const FileRecord& b)
+{
+    return a.total() > b.total();
+}
+
+// The first three folders of the file, relative to the study
+std::string categoryOf(const std::string& filename, const fs::path& studyFolder)
+{
+    auto relative = fs::path(filename).lexically_normal().lexically_relative(studyFolder);
+    if (relative.empty() || *relative.begin() == "..")
+    {
+        return "(outside the study)";
+    }
+
+    std::string category;
+    unsigned depth = 0;
+    for (auto it = relative.begin(); depth < 3 && std::next(it) != relative.end(); ++it, ++depth)
+    {
+        if (!category.empty())
+        {
+            category += '/';
+        }
+        category += it->string();
+    }
+    return category.empty() ? "." : category;
+}
+
+double toMs(Duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+double toMB(uint64_t bytes)
+{
+    return static_cast<double>(bytes) / (1024. * 1024.);
+}
+} // namespace
+
+void LoadProfileReset(const fs::path& studyFolder)
+{
+    auto& p = profile();
+    std::lock_guard lock(p.mutex);
+    p.studyFolder = fs::absolute(studyFolder).lexically_normal();
+    p.categories.clear();
+    p.phases.clear();
+    p.slowest.clear();
+}
+
+void LoadProfileAddFile(const std::string& filename,
+                        uint64_t bytes,
+                        Duration wait,
+                        Duration parse)
+{
+    auto& p = profile();
+    std::lock_guard lock(p.mutex);
+
+    auto& category = p.categories[categoryOf(filename, p.studyFolder)];
+    ++category.files;
+    category.bytes += bytes;
+    category.wait += wait;
+    category.parse += parse;
+
+    FileRecord record{filename, bytes, wait, parse};
+    if (p.slowest.size() < slowestFilesKept)
+    {
+        p.slowest.push_back(std::move(record));
+        std::ranges::push_heap(p.slowest, isSlower);
+    }
+    else if (isSlower(record, p.slowest.front()))
+    {
+        std::ranges::pop_heap(p.slowest, isSlower);
+        p.slowest.back() = std::move(record);
+        std::ranges::push_heap(p.slowest, isSlower);
+    }
+}
+
+void LoadProfileAddPhase(const std::string& name, Duration duration)
+{
+    auto& p = profile();
+    std::lock_guard lock(p.mutex);
+
+    auto it = std::ranges::find(p.phases, name, &std::pair<std::string, PhaseTotal>::first);
+    if (it == p.phases.end())
+    {
+        it = p.phases.insert(p.phases.end(), {name, PhaseTotal()});
+    }
+    ++it->second.count;
+    it->second.duration += duration;
+}
+
+std::string LoadProfileReport(unsigned slowestFiles)
+{
+    auto& p = profile();
+    std::lock_guard lock(p.mutex);
+
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(1);
+
+    out << "Study loading\n\n";
+    out << std::left << std::setw(48) << "Phase" << std::right << std::setw(10) << "count"
+        << std::setw(14) << "time (ms)" << '\n';
+    for (const auto& [name, phase]: p.phases)
+    {
+        out << std::left << std::setw(48) << name << std::right << std::setw(10) << phase.count
+            << std::setw(14) << toMs(phase.duration) << '\n';
+    }
+
+    out << '\n';
+    out << std::left << std::setw(48) << "Category" << std::right << std::setw(10) << "files"
+        << std::setw(14) << "size (MB)" << std::setw(14) << "wait (ms)" << std::setw(14)
+        << "parse (ms)" << '\n';
+    for (const auto& [name, category]: p.categories)
+    {
+        out << std::left << std::setw(48) << name << std::right << std::setw(10) << category.files
+            << std::setw(14) << toMB(category.bytes) << std::setw(14) << toMs(category.wait)
+            << std::setw(14) << toMs(category.parse) << '\n';
+    }
+
+    auto slowest = p.slowest;
+    std::ranges::sort(slowest, isSlower);
+    slowest.resize(std::min<size_t>(slowest.size(), slowestFiles));
+
+    out << "\nSlowest files\n";
+    out << std::setw(14) << "wait (ms)" << std::setw(14) << "parse (ms)" << std::setw(14)
+        << "size (MB)" << "  file\n";
+    for (const auto& file: slowest)
+    {
+        out << std::setw(14) << toMs(file.wait) << std::setw(14) << toMs(file.parse)
+            << std::setw(14) << toMB(file.bytes) << "  " << file.filename << '\n';
+    }
+    return out.str();
+}
+
+LoadPhase::LoadPhase(std::string name):
+    name_(std::move(name)),
+    start_(std::chrono::steady_clock::now())
+{
+}
+
+LoadPhase::~LoadPhase()
+{
+    LoadProfileAddPhase(name_, std::chrono::steady_clock::now() - start_);
+}
+
+} // namespace Antares::Statistics
@@ -0,0 +1,74 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#ifndef __ANTARES_LIBS_ARRAY_MATRIX_CONTENT_POOL_H__
+#define __ANTARES_LIBS_ARRAY_MATRIX_CONTENT_POOL_H__
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "matrix.h"
+
+namespace Antares
+{
+/*!
+** \brief Content-addressed pool of matrices, used to de-duplicate identical data
+**
+** Each registered matrix is hashed. When a matrix with the same dimensions and
+** the same content has already been registered, the columns are shared between
+** both matrices (copy-on-write, see Matrix::shareColumnsWith()).
+**
+** The pool only keeps references to the registered matrices : it must not
+** outlive them, and the matrices must not be modified while the pool is alive.
+*/
+class MatrixContentPool final
+{
+public:
+    struct Report
+    {
+        //! Number of matrices registered into the pool
+        uint64_t matrices = 0;
+        //! Number of matrices now sharing their columns with another one
+        uint64_t shared = 0;
+        //! Amount of memory no longer allocated thanks to the sharing
+        uint64_t bytesSaved = 0;
+    };
+
+    /*!
+    ** \brief Register a matrix, sharing its columns with an identical one if any
+    **
+    ** \return True if the columns are now shared with another matrix
+    */
+    bool deduplicate(Matrix<double>& m);
+
+    const Report& report() const;
+
+private:
+    static uint64_t hash(const Matrix<double>& m);
+    static bool sameContent(const Matrix<double>& a, const Matrix<double>& b);
+
+    std::unordered_multimap<uint64_t, Matrix<double>*> pMatrices;
+    Report pReport;
+};
+
+} // namespace Antares
+
+#endif // __ANTARES_LIBS_ARRAY_MATRIX_CONTENT_POOL_H__
@@ -22,7 +22,9 @@
 #define __ANTARES_LIBS_ARRAY_MATRIX_H__
 
 #include <cassert>
+#include <memory>
 #include <set>
+#include <vector>
 
 #include <yuni/yuni.h>
 #include <yuni/io/file.h>
@@ -32,6 +34,15 @@
 
 namespace Antares
 {
+/*!
+** \brief Load the content of a file into a buffer, from a mounted study archive if any
+**
+** \param hardLimit Maximum size of the file (bytes)
+*/
+Yuni::IO::Error MatrixLoadFileToBuffer(Yuni::Clob& buffer,
+                                       const AnyString& filename,
+                                       uint64_t hardLimit);
+
 /*!
 ** \brief A n-by-n matrix
 **
@@ -222,7 +233,7 @@ public:
     virtual Yuni::IO::Error loadFromFileToBuffer(BufferType& buffer,
                                                  const AnyString& filename) const
     {
-        return Yuni::IO::File::LoadFromFile(buffer, filename, filesizeHardLimit);
+        return MatrixLoadFileToBuffer(buffer, filename, filesizeHardLimit);
     }
 
     template<class PredicateT>
@@ -404,6 +415,29 @@ public:
     */
     void markAsModified() const;
 
+    /*!
+    ** \brief Share the columns of an identical matrix instead of holding a copy
+    **
+    ** Both matrices must have the same dimensions and the same content. The
+    ** columns are shared until one of the matrices is modified, at which point
+    ** the modified matrix gets its own copy (copy-on-write).
+    ** Shared matrices must not be modified concurrently from several threads.
+    */
+    void shareColumnsWith(MatrixType& rhs);
+
+    /*!
+    ** \brief Get if the columns are shared with at least another matrix
+    */
+    bool hasSharedColumns() const;
+
+    /*!
+    ** \brief Make sure the columns are owned by this matrix (copy-on-write)
+    **
+    ** All modifiers call this method, as well as the non-const accessors.
+    ** It must be called explicitly only when writing through `entry`.
+    */
+    void detach();
+
     /*!
     ** \brief Get if the matrix is empty
     **
@@ -446,6 +480,14 @@ public:
     //! Just-in-time informations
     mutable JIT::Informations* jit;
 
+private:
+    //! Columns owned jointly by several matrices with identical content
+    struct SharedColumns;
+    //! Shared storage of the columns (copy-on-write), null if the columns are owned
+    std::shared_ptr<SharedColumns> pSharedColumns;
+
+public:
+
     struct PredicateIdentity
     {
         template<class U = Type>
@@ -457,6 +499,23 @@ public:
 
     void saveToBuffer(std::string& data, uint precision = 6) const;
 
+    /*!
+    ** \brief Save the matrix into a buffer, in a binary format
+    **
+    ** The raw values are stored column by column, after a small header holding the
+    ** dimensions and the precision of the text format (used by `loadFromBinaryBuffer`
+    ** to convert the buffer back to text). Much faster than `saveToBuffer`.
+    */
+    void saveToBinaryBuffer(std::string& data, uint precision = 6) const;
+
+    /*!
+    ** \brief Load the matrix from a buffer written by `saveToBinaryBuffer`
+    **
+    ** \param precision If not null, the precision stored in the buffer
+    ** \return False if the buffer is not a valid binary matrix of this type
+    */
+    bool loadFromBinaryBuffer(const std::string& data, uint* precision = nullptr);
+
     template<class PredicateT>
     void saveToBuffer(std::string& data,
                       uint precision,
@@ -506,6 +565,11 @@ private:
     */
     void reverseRows(uint column, uint start, uint end);
 
+    /*!
+    ** \brief Release the memory of all columns (or drop the reference to the shared ones)
+    */
+    void releaseColumns();
+
 }; // class Matrix
 
 template<class T>
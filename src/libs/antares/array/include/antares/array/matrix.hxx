@@ -21,13 +21,17 @@
 #ifndef __ANTARES_LIBS_ARRAY_MATRIX_HXX__
 #define __ANTARES_LIBS_ARRAY_MATRIX_HXX__
 
+#include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <utility>
 
 #include <yuni/yuni.h>
 #include <yuni/core/string.h>
 
+#include <antares/io/load-profile.h>
 #include <antares/io/statistics.h>
 #include <antares/logs/logs.h>
 
@@ -198,6 +202,20 @@ public:
 
 } // anonymous namespace
 
+template<class T, class ReadWriteT>
+struct Matrix<T, ReadWriteT>::SharedColumns final
+{
+    ~SharedColumns()
+    {
+        for (auto& column: columns)
+        {
+            Antares::Memory::Release(column);
+        }
+    }
+
+    std::vector<ColumnType> columns;
+};
+
 template<class T, class ReadWriteT>
 inline Matrix<T, ReadWriteT>::Matrix():
     width(0),
@@ -280,18 +298,84 @@ Matrix<T, ReadWriteT>::~Matrix()
     delete jit;
 
     if (entry)
+    {
+        releaseColumns();
+        delete[] entry;
+    }
+}
+
+template<class T, class ReadWriteT>
+void Matrix<T, ReadWriteT>::releaseColumns()
+{
+    if (pSharedColumns)
+    {
+        // The columns belong to the shared storage
+        pSharedColumns.reset();
+        return;
+    }
+    for (uint i = 0; i != width; ++i)
+    {
+        Antares::Memory::Release(entry[i]);
+    }
+}
+
+template<class T, class ReadWriteT>
+void Matrix<T, ReadWriteT>::detach()
+{
+    if (!pSharedColumns)
+    {
+        return;
+    }
+    if (pSharedColumns.use_count() == 1)
+    {
+        // Last owner : the columns can be taken back without any copy
+        pSharedColumns->columns.clear();
+    }
+    else
     {
         for (uint i = 0; i != width; ++i)
         {
-            Antares::Memory::Release(entry[i]);
+            const T* shared = entry[i];
+            Antares::Memory::Allocate<T>(entry[i], height);
+            memcpy(entry[i], shared, sizeof(T) * height);
         }
-        delete[] entry;
     }
+    pSharedColumns.reset();
+}
+
+template<class T, class ReadWriteT>
+void Matrix<T, ReadWriteT>::shareColumnsWith(Matrix<T, ReadWriteT>& rhs)
+{
+    assert(width == rhs.width and height == rhs.height and "Matrices with different sizes");
+    if (this == &rhs or empty() or (pSharedColumns and pSharedColumns == rhs.pSharedColumns))
+    {
+        return;
+    }
+
+    if (!rhs.pSharedColumns)
+    {
+        rhs.pSharedColumns = std::make_shared<SharedColumns>();
+        rhs.pSharedColumns->columns.assign(rhs.entry, rhs.entry + rhs.width);
+    }
+
+    releaseColumns();
+    for (uint i = 0; i != width; ++i)
+    {
+        entry[i] = rhs.entry[i];
+    }
+    pSharedColumns = rhs.pSharedColumns;
+}
+
+template<class T, class ReadWriteT>
+inline bool Matrix<T, ReadWriteT>::hasSharedColumns() const
+{
+    return pSharedColumns != nullptr;
 }
 
 template<class T, class ReadWriteT>
 inline void Matrix<T, ReadWriteT>::zero()
 {
+    detach();
     for (uint i = 0; i != width; ++i)
     {
         ColumnType& column = entry[i];
@@ -304,6 +388,7 @@ void Matrix<T, ReadWriteT>::averageTimeseries(bool roundValues)
 {
     if (width > 1)
     {
+        detach();
         ColumnType& first = entry[0];
 
         // add the values of each timeseries to the first one
@@ -347,6 +432,7 @@ void Matrix<T, ReadWriteT>::averageTimeseries(bool roundValues)
 template<class T, class ReadWriteT>
 void Matrix<T, ReadWriteT>::fill(const T& v)
 {
+    detach();
     for (uint i = 0; i != width; ++i)
     {
         ColumnType& column = entry[i];
@@ -361,6 +447,7 @@ void Matrix<T, ReadWriteT>::fill(const T& v)
 template<class T, class ReadWriteT>
 inline void Matrix<T, ReadWriteT>::fillUnit()
 {
+    detach();
     for (uint i = 0; i != width; ++i)
     {
         ColumnType& column = entry[i];
@@ -468,6 +555,7 @@ template<class U>
 void Matrix<T, ReadWriteT>::pasteToColumn(uint x, const U* data)
 {
     assert(x < width and "Invalid column index (bigger than `this->width`)");
+    detach();
     ColumnType& column = entry[x];
 
     // if the two types are strictly equal, we can perform some major
@@ -492,6 +580,7 @@ template<class T, class ReadWriteT>
 void Matrix<T, ReadWriteT>::fillColumn(uint x, const T& value)
 {
     assert(x < width and "Invalid column index (bigger than `this->width`)");
+    detach();
     ColumnType& column = entry[x];
 
     for (uint y = 0; y != height; ++y)
@@ -506,6 +595,7 @@ template<class T, class ReadWriteT>
 inline void Matrix<T, ReadWriteT>::columnToZero(uint x)
 {
     assert(x < width and "Invalid column index (bigger than `this->width`)");
+    detach();
     ColumnType& column = entry[x];
 
     (void)::memset((void*)column, 0, sizeof(T) * height);
@@ -533,10 +623,7 @@ void Matrix<T, ReadWriteT>::clear()
 {
     if (entry)
     {
-        for (uint i = 0; i != width; ++i)
-        {
-            Antares::Memory::Release(entry[i]);
-        }
+        releaseColumns();
         delete[] entry;
         entry = nullptr;
     }
@@ -571,10 +658,7 @@ void Matrix<T, ReadWriteT>::resize(uint w, uint h, bool fixedSize)
         {
             if (entry)
             {
-                for (uint i = 0; i != width; ++i)
-                {
-                    Antares::Memory::Release(entry[i]);
-                }
+                releaseColumns();
                 delete[] entry;
             }
             if (!w and !h)
@@ -600,6 +684,11 @@ void Matrix<T, ReadWriteT>::resize(uint w, uint h, bool fixedSize)
             }
         }
     }
+    else
+    {
+        // The content is about to be overwritten by the caller
+        detach();
+    }
 
     // JIT Update
     if (JIT::enabled and not jit and fixedSize)
@@ -1040,13 +1129,22 @@ bool Matrix<T, ReadWriteT>::internalLoadCSVFile(const AnyString& filename,
         buffer = new BufferType();
     }
 
+    using Clock = std::chrono::steady_clock;
+    const auto readStart = Clock::now();
+
     switch (loadFromFileToBuffer(*buffer, filename))
     {
     case Yuni::IO::errNone:
     {
+        const auto parseStart = Clock::now();
+
         // Empty files
         if (buffer->empty())
         {
+            Statistics::LoadProfileAddFile(filename.to<std::string>(),
+                                           0,
+                                           parseStart - readStart,
+                                           Clock::duration::zero());
             if (maxHeight and minWidth)
             {
                 reset((minWidth != 0 ? minWidth : 1),
@@ -1072,6 +1170,10 @@ bool Matrix<T, ReadWriteT>::internalLoadCSVFile(const AnyString& filename,
                                 maxHeight,
                                 (options & optFixedSize),
                                 options);
+        Statistics::LoadProfileAddFile(filename.to<std::string>(),
+                                       buffer->size() - 1,
+                                       parseStart - readStart,
+                                       Clock::now() - parseStart);
 
         // Mark as modified
         if (0 != (options & optMarkAsModified))
@@ -1235,6 +1337,80 @@ void Matrix<T, ReadWriteT>::saveToBuffer(std::string& data, uint precision) cons
     this->saveToBuffer(data, precision, false, identity, true);
 }
 
+namespace MatrixBinaryFormat
+{
+//! Leading bytes of a binary matrix buffer
+constexpr char magic[8] = {'A', 'N', 'T', 'S', 'M', 'T', 'X', '1'};
+
+struct Header
+{
+    uint32_t width;
+    uint32_t height;
+    uint32_t precision;
+    uint32_t sizeOfValue;
+};
+} // namespace MatrixBinaryFormat
+
+template<class T, class ReadWriteT>
+void Matrix<T, ReadWriteT>::saveToBinaryBuffer(std::string& data, uint precision) const
+{
+    using namespace MatrixBinaryFormat;
+
+    const Header header{width, height, precision, static_cast<uint32_t>(sizeof(T))};
+    const size_t columnSize = sizeof(T) * height;
+
+    data.resize(sizeof(magic) + sizeof(Header) + columnSize * width);
+    char* p = data.data();
+    std::memcpy(p, magic, sizeof(magic));
+    p += sizeof(magic);
+    std::memcpy(p, &header, sizeof(Header));
+    p += sizeof(Header);
+    for (uint x = 0; x != width; ++x, p += columnSize)
+    {
+        std::memcpy(p, entry[x], columnSize);
+    }
+}
+
+template<class T, class ReadWriteT>
+bool Matrix<T, ReadWriteT>::loadFromBinaryBuffer(const std::string& data, uint* precision)
+{
+    using namespace MatrixBinaryFormat;
+
+    Header header;
+    if (data.size() < sizeof(magic) + sizeof(Header)
+        || std::memcmp(data.data(), magic, sizeof(magic)) != 0)
+    {
+        return false;
+    }
+    std::memcpy(&header, data.data() + sizeof(magic), sizeof(Header));
+
+    // The dimensions are read from the buffer : the size they give must not overflow
+    constexpr size_t headerSize = sizeof(magic) + sizeof(Header);
+    if (header.width != 0 && header.height > (SIZE_MAX - headerSize) / sizeof(T) / header.width)
+    {
+        return false;
+    }
+    const size_t columnSize = sizeof(T) * header.height;
+    if (header.sizeOfValue != sizeof(T)
+        || data.size() != headerSize + columnSize * header.width)
+    {
+        return false;
+    }
+
+    resize(header.width, header.height);
+    detach();
+    const char* p = data.data() + sizeof(magic) + sizeof(Header);
+    for (uint x = 0; x != width; ++x, p += columnSize)
+    {
+        std::memcpy(entry[x], p, columnSize);
+    }
+    if (precision)
+    {
+        *precision = header.precision;
+    }
+    return true;
+}
+
 template<class T, class ReadWriteT>
 bool Matrix<T, ReadWriteT>::openFile(Yuni::IO::File::Stream& file, const AnyString& filename) const
 {
@@ -1323,6 +1499,7 @@ void Matrix<T, ReadWriteT>::resizeWithoutDataLost(uint x, uint y, const T& defVa
     {
         if (x <= width and y <= height) // shrinking
         {
+            detach();
             for (uint i = x; i < width; ++i)
             {
                 Antares::Memory::Release(entry[i]);
@@ -1397,6 +1574,7 @@ void Matrix<T, ReadWriteT>::multiplyAllEntriesBy(const U& c)
 
     if (!Utils::isZero(c))
     {
+        detach();
         for (uint x = 0; x != width; ++x)
         {
             ColumnType& column = entry[x];
@@ -1418,6 +1596,7 @@ template<class U>
 void Matrix<T, ReadWriteT>::multiplyColumnBy(uint x, const U& c)
 {
     assert(x < width and "Invalid column index (bigger than `this->width`)");
+    detach();
     ColumnType& column = entry[x];
     for (uint y = 0; y != height; ++y)
     {
@@ -1431,6 +1610,7 @@ void Matrix<T, ReadWriteT>::divideColumnBy(uint x, const U& c)
 {
     assert(x < width and "Invalid column index (bigger than `this->width`)");
     assert(c != (T)0 && "Dividing by zero");
+    detach();
     ColumnType& column = entry[x];
     for (uint y = 0; y != height; ++y)
     {
@@ -1441,6 +1621,7 @@ void Matrix<T, ReadWriteT>::divideColumnBy(uint x, const U& c)
 template<class T, class ReadWriteT>
 void Matrix<T, ReadWriteT>::roundAllEntries()
 {
+    detach();
     for (uint x = 0; x != width; ++x)
     {
         ColumnType& col = entry[x];
@@ -1454,6 +1635,7 @@ void Matrix<T, ReadWriteT>::roundAllEntries()
 template<class T, class ReadWriteT>
 void Matrix<T, ReadWriteT>::makeAllEntriesAbsolute()
 {
+    detach();
     for (uint x = 0; x != width; ++x)
     {
         ColumnType& col = entry[x];
@@ -1574,6 +1756,7 @@ void Matrix<T, ReadWriteT>::swap(Matrix<T, ReadWriteT>& rhs) noexcept
     swap(this->height, rhs.height);
     swap(this->entry, rhs.entry);
     swap(this->jit, rhs.jit);
+    swap(this->pSharedColumns, rhs.pSharedColumns);
 }
 
 template<class T, class ReadWriteT>
@@ -1599,6 +1782,7 @@ inline Matrix<T, ReadWriteT>& Matrix<T, ReadWriteT>::operator=(Matrix<T, ReadWri
     {
         entry = rhs.entry;
     }
+    pSharedColumns = std::move(rhs.pSharedColumns);
     // Prevent spurious de-allocation from rhs's destructor
     rhs.entry = nullptr;
     return *this;
@@ -1698,6 +1882,7 @@ void Matrix<T, ReadWriteT>::reverseRows(uint column, uint start, uint end)
         return;
     }
 
+    detach();
     // The values of the selected column
     auto& values = entry[column];
     // temporary value
@@ -1747,6 +1932,7 @@ inline typename Matrix<T, ReadWriteT>::ColumnType& Matrix<T, ReadWriteT>::operat
 {
     assert(column < width);
     assert(Memory::RawPointer(entry[column]));
+    detach();
     return entry[column];
 }
 
@@ -1763,6 +1949,7 @@ inline typename Matrix<T, ReadWriteT>::ColumnType& Matrix<T, ReadWriteT>::column
 {
     assert(n < width);
     assert(Memory::RawPointer(entry[n]));
+    detach();
     return entry[n];
 }
 
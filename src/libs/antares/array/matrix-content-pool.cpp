@@ -0,0 +1,101 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#include "antares/array/matrix-content-pool.h"
+
+#include <cstring>
+#include <string_view>
+
+namespace Antares
+{
+bool MatrixContentPool::deduplicate(Matrix<double>& m)
+{
+    // Matrices loaded on demand have no content yet
+    if (m.empty() or m.jit)
+    {
+        return false;
+    }
+
+    ++pReport.matrices;
+    const uint64_t key = hash(m);
+    auto [first, last] = pMatrices.equal_range(key);
+    for (auto it = first; it != last; ++it)
+    {
+        Matrix<double>& original = *(it->second);
+        if (sameContent(original, m))
+        {
+            if (!m.hasSharedColumns())
+            {
+                pReport.bytesSaved += sizeof(double) * m.width * m.height;
+            }
+            m.shareColumnsWith(original);
+            ++pReport.shared;
+            return true;
+        }
+    }
+    pMatrices.emplace(key, &m);
+    return false;
+}
+
+const MatrixContentPool::Report& MatrixContentPool::report() const
+{
+    return pReport;
+}
+
+uint64_t MatrixContentPool::hash(const Matrix<double>& m)
+{
+    // FNV-1a over the column hashes
+    uint64_t h = 14695981039346656037ULL;
+    auto combine = [&h](uint64_t value)
+    {
+        h ^= value;
+        h *= 1099511628211ULL;
+    };
+
+    combine(m.width);
+    combine(m.height);
+    for (uint x = 0; x != m.width; ++x)
+    {
+        const std::string_view raw(reinterpret_cast<const char*>(m.entry[x]),
+                                   sizeof(double) * m.height);
+        combine(std::hash<std::string_view>{}(raw));
+    }
+    return h;
+}
+
+bool MatrixContentPool::sameContent(const Matrix<double>& a, const Matrix<double>& b)
+{
+    if (a.width != b.width or a.height != b.height)
+    {
+        return false;
+    }
+    for (uint x = 0; x != a.width; ++x)
+    {
+        if (a.entry[x] != b.entry[x]
+            and std::memcmp(a.entry[x], b.entry[x], sizeof(double) * a.height) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace Antares
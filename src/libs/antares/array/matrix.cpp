@@ -23,6 +23,8 @@
 
 #include <cstdlib>
 
+#include <antares/io/archive.h>
+
 using namespace Yuni;
 
 namespace Antares
@@ -33,6 +35,29 @@ enum
                    + sizeof(void*) * 2 // entry, jit
 };
 
+Yuni::IO::Error MatrixLoadFileToBuffer(Yuni::Clob& buffer,
+                                       const AnyString& filename,
+                                       uint64_t hardLimit)
+{
+    std::filesystem::path path = filename.to<std::string>();
+    if (!IO::isArchivedFile(path))
+    {
+        return Yuni::IO::File::LoadFromFile(buffer, filename, hardLimit);
+    }
+
+    std::string content;
+    if (!IO::readArchivedFile(path, content))
+    {
+        return Yuni::IO::errReadFailed;
+    }
+    if (content.size() > hardLimit)
+    {
+        return Yuni::IO::errMemoryLimit;
+    }
+    buffer.assign(content.data(), static_cast<uint>(content.size()));
+    return Yuni::IO::errNone;
+}
+
 int MatrixTestForPositiveValues(const char* msg, const Matrix<>* m)
 {
     uint x = 0;
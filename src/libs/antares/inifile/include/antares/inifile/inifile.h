@@ -20,7 +20,12 @@
 */
 #pragma once
 
+#include <filesystem>
+#include <memory>
 #include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 #include <yuni/yuni.h>
 #include <yuni/core/string.h>
@@ -157,6 +162,10 @@ public:
         //! The next section
         Section* next = nullptr;
 
+    private:
+        //! Index of the properties by key (the first one wins when a key is duplicated)
+        std::unordered_map<std::string_view, Property*> index_;
+
     }; // class Section
 
 public:
@@ -200,6 +209,26 @@ public:
 
     bool readStream(std::istream& in_stream);
 
+    /*!
+    ** \brief Parse the content of an INI file already in memory
+    **
+    ** Lines are handled as views on \p content, without any intermediate copy.
+    */
+    bool readString(std::string_view content);
+
+    /*!
+    ** \brief Load several independent INI files concurrently
+    **
+    ** \param filenames Files to load
+    ** \param nbThreads Maximum number of threads reading the files
+    ** \return One INI structure per file, in the same order, or null if the
+    **   file could not be read
+    */
+    static std::vector<std::unique_ptr<IniFile>> OpenAll(
+      const std::vector<std::filesystem::path>& filenames,
+      unsigned int nbThreads,
+      bool warnings = true);
+
     /*!
     ** \brief Save the entire INI into a file
     */
@@ -321,6 +350,9 @@ private:
     */
     std::string filename_;
 
+    //! Index of the sections by name (the first one wins when a name is duplicated)
+    std::unordered_map<std::string_view, Section*> sectionIndex_;
+
 }; // class IniFile
 
 } // namespace Antares
@@ -65,6 +65,7 @@ IniFile::Property* IniFile::Section::add(const AnyString& key, const U& value)
         lastProperty->next = p;
     }
     lastProperty = p;
+    index_.try_emplace(std::string_view(p->key.c_str(), p->key.size()), p);
     return p;
 }
 
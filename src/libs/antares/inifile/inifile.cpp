@@ -21,13 +21,18 @@
 
 #include "antares/inifile/inifile.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
 #include <sstream>
+#include <thread>
 #include <utility>
 
-#include <boost/algorithm/string.hpp>
-
+#include <antares/io/archive.h>
+#include <antares/io/load-profile.h>
 #include <antares/io/statistics.h>
 #include <antares/logs/logs.h>
 
@@ -120,6 +125,7 @@ IniFile::Section* IniFile::add(IniFile::Section* s)
         lastSection->next = s;
         lastSection = s;
     }
+    sectionIndex_.try_emplace(std::string_view(s->name.c_str(), s->name.size()), s);
     return s;
 }
 
@@ -138,6 +144,7 @@ void IniFile::clear()
         firstSection = nullptr;
         lastSection = nullptr;
     }
+    sectionIndex_.clear();
 }
 
 uint IniFile::Section::size() const
@@ -156,56 +163,78 @@ uint IniFile::Section::size() const
     return count;
 }
 
-static bool isStartingSection(std::string line)
+namespace
+{
+// Same set of blanks as std::isspace in the "C" locale
+constexpr std::string_view blanks = " \t\n\v\f\r";
+
+std::string_view trimLeft(std::string_view text)
 {
-    boost::trim(line);
-    return line.starts_with("[") && line.ends_with("]");
+    auto first = text.find_first_not_of(blanks);
+    return first == std::string_view::npos ? std::string_view() : text.substr(first);
 }
 
-static std::string getSectionName(const std::string& line)
+std::string_view trim(std::string_view text)
 {
-    std::vector<std::string> splitLine;
-    boost::split(splitLine, line, boost::is_any_of("[]"));
-    return splitLine[1];
+    text = trimLeft(text);
+    return text.substr(0, text.find_last_not_of(blanks) + 1);
 }
 
-static bool isProperty(std::string_view line)
+bool isStartingSection(std::string_view line)
 {
-    return std::ranges::count(line, '=') == 1;
+    line = trim(line);
+    return line.starts_with('[') && line.ends_with(']');
+}
+
+std::string_view getSectionName(std::string_view line)
+{
+    auto first = line.find('[') + 1;
+    auto last = line.find_first_of("[]", first);
+    return line.substr(first, last - first);
 }
 
-static IniFile::Property getProperty(std::string line)
+bool isProperty(std::string_view line)
 {
-    boost::trim(line);
-    std::vector<std::string> splitLine;
-    boost::split(splitLine, line, boost::is_any_of("="));
+    return std::ranges::count(line, '=') == 1;
+}
 
-    return IniFile::Property(splitLine[0], splitLine[1]);
+bool isComment(std::string_view line)
+{
+    line = trimLeft(line);
+    return line.starts_with('#') || line.starts_with(';');
 }
 
-static bool isComment(std::string line)
+bool isEmpty(std::string_view line)
 {
-    boost::trim_left(line);
-    return line.starts_with("#") || line.starts_with(";");
+    return trimLeft(line).empty();
 }
 
-bool isEmpty(std::string line)
+AnyString toAnyString(std::string_view text)
 {
-    boost::trim(line);
-    return line.empty();
+    return AnyString(text.data(), static_cast<uint>(text.size()));
 }
+} // namespace
 
 bool IniFile::readStream(std::istream& in_stream)
 {
-    std::string line;
+    std::string content(std::istreambuf_iterator<char>(in_stream), {});
+    return readString(content);
+}
+
+bool IniFile::readString(std::string_view content)
+{
     IniFile::Section* currentSection(nullptr);
     uint64_t read = 0;
-    while (std::getline(in_stream, line))
+    while (!content.empty())
     {
+        auto endOfLine = content.find('\n');
+        auto line = content.substr(0, endOfLine);
+        content.remove_prefix(endOfLine == std::string_view::npos ? content.size() : endOfLine + 1);
+
         read += line.size();
         if (isStartingSection(line))
         {
-            currentSection = addSection(getSectionName(line));
+            currentSection = addSection(toAnyString(getSectionName(line)));
             continue;
         }
 
@@ -214,7 +243,10 @@ bool IniFile::readStream(std::istream& in_stream)
             // Note : if a property not in a section, it's simply skipped
             if (currentSection)
             {
-                currentSection->add(getProperty(line));
+                auto equal = line.find('=');
+                // Both the key and the value are trimmed by the property itself
+                currentSection->add(toAnyString(line.substr(0, equal)),
+                                    toAnyString(line.substr(equal + 1)));
             }
             continue;
         }
@@ -224,7 +256,7 @@ bool IniFile::readStream(std::istream& in_stream)
             continue;
         }
 
-        logs.error() << "INI content : unknown format for line '" << line << "'";
+        logs.error() << "INI content : unknown format for line '" << toAnyString(line) << "'";
         return false;
     }
     if (read)
@@ -246,13 +278,22 @@ bool IniFile::open(const fs::path& filename, bool warnings)
     clear();
     filename_ = filename.string(); // storing filename for further use
 
-    if (std::ifstream file(filename); file.is_open())
+    // The whole file is read at once (possibly from a mounted study archive),
+    // then parsed in place
+    using Clock = std::chrono::steady_clock;
+    const auto readStart = Clock::now();
+    if (std::string content; IO::readFileContent(filename, content))
     {
-        if (!readStream(file))
+        const auto parseStart = Clock::now();
+        if (!readString(content))
         {
             logs.error() << "Invalid INI file : " << filename;
             return false;
         }
+        Statistics::LoadProfileAddFile(filename_,
+                                       content.size(),
+                                       parseStart - readStart,
+                                       Clock::now() - parseStart);
         return true;
     }
 
@@ -263,6 +304,45 @@ bool IniFile::open(const fs::path& filename, bool warnings)
     return false;
 }
 
+std::vector<std::unique_ptr<IniFile>> IniFile::OpenAll(const std::vector<fs::path>& filenames,
+                                                      unsigned int nbThreads,
+                                                      bool warnings)
+{
+    std::vector<std::unique_ptr<IniFile>> result(filenames.size());
+    std::atomic<size_t> nextFile = 0;
+
+    auto worker = [&]()
+    {
+        for (size_t i = nextFile++; i < filenames.size(); i = nextFile++)
+        {
+            // An exception escaping a thread would terminate the program : the file
+            // is reported as unreadable instead
+            try
+            {
+                if (auto ini = std::make_unique<IniFile>(); ini->open(filenames[i], warnings))
+                {
+                    result[i] = std::move(ini);
+                }
+            }
+            catch (const std::exception& e)
+            {
+                logs.error() << "I/O error: " << filenames[i] << ": " << e.what();
+            }
+        }
+    };
+
+    const size_t nbWorkers = std::min<size_t>(std::max(1u, nbThreads), filenames.size());
+    {
+        std::vector<std::jthread> threads;
+        for (size_t t = 1; t < nbWorkers; ++t)
+        {
+            threads.emplace_back(worker);
+        }
+        worker();
+    }
+    return result;
+}
+
 void IniFile::saveToStream(std::ostream& stream_out, uint64_t& written) const
 {
     each([&stream_out, &written](const IniFile::Section& s)
@@ -302,50 +382,26 @@ bool IniFile::save(const AnyString& filename) const
 
 IniFile::Property* IniFile::Section::find(const AnyString& key)
 {
-    for (auto* property = firstProperty; property; property = property->next)
-    {
-        if (property->key == key)
-        {
-            return property;
-        }
-    }
-    return nullptr;
+    auto it = index_.find(std::string_view(key.c_str(), key.size()));
+    return it != index_.end() ? it->second : nullptr;
 }
 
 const IniFile::Property* IniFile::Section::find(const AnyString& key) const
 {
-    for (auto* property = firstProperty; property; property = property->next)
-    {
-        if (property->key == key)
-        {
-            return property;
-        }
-    }
-    return nullptr;
+    auto it = index_.find(std::string_view(key.c_str(), key.size()));
+    return it != index_.end() ? it->second : nullptr;
 }
 
 IniFile::Section* IniFile::find(const AnyString& name)
 {
-    for (auto* section = firstSection; section; section = section->next)
-    {
-        if (section->name == name)
-        {
-            return section;
-        }
-    }
-    return nullptr;
+    auto it = sectionIndex_.find(std::string_view(name.c_str(), name.size()));
+    return it != sectionIndex_.end() ? it->second : nullptr;
 }
 
 const IniFile::Section* IniFile::find(const AnyString& name) const
 {
-    for (auto* section = firstSection; section; section = section->next)
-    {
-        if (section->name == name)
-        {
-            return section;
-        }
-    }
-    return nullptr;
+    auto it = sectionIndex_.find(std::string_view(name.c_str(), name.size()));
+    return it != sectionIndex_.end() ? it->second : nullptr;
 }
 
 } // namespace Antares
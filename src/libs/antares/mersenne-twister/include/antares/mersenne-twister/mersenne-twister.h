@@ -21,6 +21,9 @@
 #ifndef __LIB_ANTARES_RANDOM_MERSENNE_H__
 #define __LIB_ANTARES_RANDOM_MERSENNE_H__
 
+#include <cstddef>
+#include <cstdint>
+
 #include <yuni/yuni.h>
 #include <yuni/core/math/random/distribution.h>
 
@@ -72,6 +75,13 @@ public:
     void reset();
     //! Reset the generator with a custom seed
     void reset(uint seed);
+    /*!
+    ** \brief Reset the generator from an array of 32-bit words
+    **
+    ** This is the `init_by_array` initialization of the reference implementation :
+    ** every word of the key contributes to the initial state.
+    */
+    void reset(const uint32_t* key, std::size_t length);
     //@}
 
     //! \name Generator
@@ -83,6 +93,23 @@ public:
     **   break the global design
     */
     Value next() const;
+
+    /*!
+    ** \brief Generate \p count random numbers at once
+    **
+    ** The numbers are exactly the ones that \p count successive calls to `next()`
+    ** would have returned, but they are produced a whole block of the internal
+    ** state at a time, in a loop the compiler can vectorize.
+    */
+    void generate(Value* values, std::size_t count) const;
+
+    /*!
+    ** \brief Skip \p count random numbers
+    **
+    ** Same as \p count calls to `next()` whose results would be ignored, without
+    ** computing the numbers themselves.
+    */
+    void discard(std::size_t count) const;
     //@}
 
     //! \name Bounds
@@ -102,6 +129,11 @@ private:
         periodM = 397,
     };
 
+    //! Generate the next periodN words of the state vector
+    void twist() const;
+    //! Convert a word of the state vector into a random number
+    static Value temper(uint32_t y);
+
     //! State vector
     mutable uint32_t mt[periodN];
     //
@@ -109,6 +141,25 @@ private:
 
 }; // class MersenneTwister
 
+inline MersenneTwister::Value MersenneTwister::temper(uint32_t y)
+{
+    y ^= (y >> 11);
+    y ^= (y << 7) & 0x9d2c5680UL;
+    y ^= (y << 15) & 0xefc60000UL;
+    y ^= (y >> 18);
+
+    return y * (1.0 / 4294967295.0);
+}
+
+inline MersenneTwister::Value MersenneTwister::next() const
+{
+    if (mti >= periodN)
+    {
+        twist();
+    }
+    return temper(mt[mti++]);
+}
+
 } // namespace Antares
 
 #endif // __LIB_ANTARES_RANDOM_MERSENNE_H__
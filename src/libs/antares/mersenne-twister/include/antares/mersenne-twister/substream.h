@@ -0,0 +1,46 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#ifndef __LIB_ANTARES_RANDOM_SUBSTREAM_H__
+#define __LIB_ANTARES_RANDOM_SUBSTREAM_H__
+
+#include <string_view>
+
+#include "mersenne-twister.h"
+
+namespace Antares
+{
+/*!
+** \brief Get an independent random stream, identified by a seed, a name and an index
+**
+** The generator is initialized from the whole key (the seed, every byte of the name
+** and the index), so that two different keys never get the same initial state.
+** It allows independent entities (a thermal cluster, a link...) to draw their own
+** random numbers, whatever the order or the thread in which they are processed.
+**
+** \param seed The seed set by the user for the whole family (e.g. seed-tsgen-thermal)
+** \param name A stable name of the entity (e.g. "area/cluster")
+** \param index A secondary index (e.g. the year of the refresh)
+*/
+MersenneTwister MakeSubstream(uint seed, std::string_view name, uint index);
+
+} // namespace Antares
+
+#endif // __LIB_ANTARES_RANDOM_SUBSTREAM_H__
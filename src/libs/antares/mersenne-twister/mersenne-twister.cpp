@@ -32,6 +32,7 @@
 
 #include "antares/mersenne-twister/mersenne-twister.h"
 
+#include <algorithm>
 #include <cassert>
 
 #define MATRIX_A 0x9908b0dfUL   // constant vector a
@@ -68,49 +69,106 @@ void MersenneTwister::reset(uint seed)
     }
 }
 
-MersenneTwister::Value MersenneTwister::next() const
+void MersenneTwister::reset(const uint32_t* key, std::size_t length)
+{
+    assert((key || !length) && "invalid key");
+    reset(19650218UL);
+
+    int i = 1;
+    std::size_t j = 0;
+    for (std::size_t k = (periodN > length ? periodN : length); k; --k)
+    {
+        mt[i] = (mt[i] ^ ((mt[i - 1] ^ (mt[i - 1] >> 30)) * 1664525UL))
+                + (length ? key[j] : 0) + (uint32_t)j; // non linear
+        if (++i >= periodN)
+        {
+            mt[0] = mt[periodN - 1];
+            i = 1;
+        }
+        if (++j >= length)
+        {
+            j = 0;
+        }
+    }
+    for (int k = periodN - 1; k; --k)
+    {
+        mt[i] = (mt[i] ^ ((mt[i - 1] ^ (mt[i - 1] >> 30)) * 1566083941UL)) - i; // non linear
+        if (++i >= periodN)
+        {
+            mt[0] = mt[periodN - 1];
+            i = 1;
+        }
+    }
+    mt[0] = 0x80000000UL; // MSB is 1; assuring non-zero initial array
+}
+
+void MersenneTwister::twist() const
 {
     uint32_t y;
     static const uint32_t mag01[2] = {0x0UL, MATRIX_A};
 
     // mag01[x] = x * MATRIX_A  for x=0,1
-    if (mti >= periodN) // generate N words at one time
+    if (mti == periodN + 1)
     {
-        if (mti == periodN + 1)
-        {
-            // if init_genrand() has not been called,
-            // a default initial seed is used
-            /// reset(5489UL);
-            assert("Mersenne Twister should already been initialized !");
-        }
+        // if init_genrand() has not been called,
+        // a default initial seed is used
+        /// reset(5489UL);
+        assert("Mersenne Twister should already been initialized !");
+    }
 
-        int kk;
-        for (kk = 0; kk < periodN - periodM; ++kk)
+    int kk;
+    for (kk = 0; kk < periodN - periodM; ++kk)
+    {
+        y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
+        mt[kk] = mt[kk + periodM] ^ (y >> 1) ^ mag01[y & 0x1UL];
+    }
+
+    for (; kk < periodN - 1; ++kk)
+    {
+        y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
+        mt[kk] = mt[kk + (periodM - periodN)] ^ (y >> 1) ^ mag01[y & 0x1UL];
+    }
+
+    y = (mt[periodN - 1] & UPPER_MASK) | (mt[0] & LOWER_MASK);
+    mt[periodN - 1] = mt[periodM - 1] ^ (y >> 1) ^ mag01[y & 0x1UL];
+    mti = 0;
+}
+
+void MersenneTwister::generate(Value* values, std::size_t count) const
+{
+    while (count)
+    {
+        if (mti >= periodN)
         {
-            y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
-            mt[kk] = mt[kk + periodM] ^ (y >> 1) ^ mag01[y & 0x1UL];
+            twist();
         }
 
-        for (; kk < periodN - 1; ++kk)
+        // Tempering all the remaining words of the current block
+        auto length = std::min<std::size_t>(count, periodN - mti);
+        const uint32_t* words = mt + mti;
+        for (std::size_t i = 0; i != length; ++i)
         {
-            y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
-            mt[kk] = mt[kk + (periodM - periodN)] ^ (y >> 1) ^ mag01[y & 0x1UL];
+            values[i] = temper(words[i]);
         }
 
-        y = (mt[periodN - 1] & UPPER_MASK) | (mt[0] & LOWER_MASK);
-        mt[periodN - 1] = mt[periodM - 1] ^ (y >> 1) ^ mag01[y & 0x1UL];
-        mti = 0;
+        mti += (int32_t)length;
+        values += length;
+        count -= length;
     }
+}
 
-    y = mt[mti++];
-
-    /* Tempering */
-    y ^= (y >> 11);
-    y ^= (y << 7) & 0x9d2c5680UL;
-    y ^= (y << 15) & 0xefc60000UL;
-    y ^= (y >> 18);
-
-    return y * (1.0 / 4294967295.0);
+void MersenneTwister::discard(std::size_t count) const
+{
+    while (count)
+    {
+        if (mti >= periodN)
+        {
+            twist();
+        }
+        auto length = std::min<std::size_t>(count, periodN - mti);
+        mti += (int32_t)length;
+        count -= length;
+    }
 }
 
 MersenneTwister::Value MersenneTwister::min()
@@ -0,0 +1,58 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#include "antares/mersenne-twister/substream.h"
+
+#include <vector>
+
+namespace Antares
+{
+MersenneTwister MakeSubstream(uint seed, std::string_view name, uint index)
+{
+    // The bytes of the name are packed in little-endian order, so that the key
+    // (and therefore the stream) does not depend on the platform
+    std::vector<uint32_t> key;
+    key.reserve(3 + (name.size() + 3) / 4);
+    key.push_back(seed);
+    key.push_back(index);
+    key.push_back(static_cast<uint32_t>(name.size()));
+
+    uint32_t word = 0;
+    for (std::size_t i = 0; i != name.size(); ++i)
+    {
+        word |= static_cast<uint32_t>(static_cast<unsigned char>(name[i])) << (8 * (i % 4));
+        if (i % 4 == 3)
+        {
+            key.push_back(word);
+            word = 0;
+        }
+    }
+    if (name.size() % 4)
+    {
+        key.push_back(word);
+    }
+
+    MersenneTwister random;
+    random.reset(key.data(), key.size());
+    return random;
+}
+
+} // namespace Antares
@@ -0,0 +1,158 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#include "antares/series/column-cache.h"
+
+#include <stdexcept>
+
+namespace Antares::Data
+{
+ColumnStore::ColumnStore(std::filesystem::path path):
+    path_(std::move(path))
+{
+    file_.open(path_, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file_.is_open())
+    {
+        throw std::runtime_error("Impossible to create the time-series store " + path_.string());
+    }
+}
+
+ColumnStore::~ColumnStore()
+{
+    file_.close();
+    std::error_code ec;
+    std::filesystem::remove(path_, ec);
+}
+
+ColumnStore::Block ColumnStore::append(const Matrix<double>& m)
+{
+    Block block{.offset = size_, .width = m.width, .height = m.height};
+
+    file_.seekp(static_cast<std::streamoff>(size_));
+    const auto columnSize = static_cast<std::streamsize>(sizeof(double) * m.height);
+    for (uint32_t x = 0; x != m.width; ++x)
+    {
+        file_.write(reinterpret_cast<const char*>(m.entry[x]), columnSize);
+    }
+    if (!file_)
+    {
+        throw std::runtime_error("Error while writing the time-series store " + path_.string());
+    }
+    size_ += sizeof(double) * m.width * m.height;
+    return block;
+}
+
+void ColumnStore::readColumn(const Block& block, uint32_t column, double* out) const
+{
+    const uint64_t columnSize = sizeof(double) * block.height;
+    file_.seekg(static_cast<std::streamoff>(block.offset + column * columnSize));
+    file_.read(reinterpret_cast<char*>(out), static_cast<std::streamsize>(columnSize));
+    if (!file_)
+    {
+        throw std::runtime_error("Error while reading the time-series store " + path_.string());
+    }
+}
+
+const std::filesystem::path& ColumnStore::path() const
+{
+    return path_;
+}
+
+ColumnCache::ColumnCache(std::filesystem::path storePath, uint64_t budgetInBytes):
+    store_(std::move(storePath)),
+    budget_(budgetInBytes)
+{
+}
+
+ColumnStore::Block ColumnCache::store(const Matrix<double>& m)
+{
+    std::lock_guard lock(mutex_);
+    return store_.append(m);
+}
+
+const double* ColumnCache::get(const ColumnStore::Block& block, uint32_t column)
+{
+    assert(column < block.width);
+    const uint64_t key = block.offset + sizeof(double) * column * block.height;
+
+    std::lock_guard lock(mutex_);
+    if (auto it = entries_.find(key); it != entries_.end())
+    {
+        auto& entry = it->second;
+        lru_.splice(lru_.begin(), lru_, entry.lru);
+        entry.epoch = epoch_;
+        ++statistics_.hits;
+        return entry.data.get();
+    }
+
+    ++statistics_.misses;
+    Entry entry;
+    entry.data = std::make_unique<double[]>(block.height);
+    entry.bytes = sizeof(double) * block.height;
+    entry.epoch = epoch_;
+    store_.readColumn(block, column, entry.data.get());
+
+    lru_.push_front(key);
+    entry.lru = lru_.begin();
+    bytes_ += entry.bytes;
+    if (bytes_ > statistics_.peakBytes)
+    {
+        statistics_.peakBytes = bytes_;
+    }
+
+    const double* data = entry.data.get();
+    entries_.emplace(key, std::move(entry));
+    evict();
+    return data;
+}
+
+void ColumnCache::unpinAll()
+{
+    std::lock_guard lock(mutex_);
+    ++epoch_;
+    evict();
+}
+
+void ColumnCache::evict()
+{
+    // Pinned columns (read during the current epoch) are kept, even if the budget is exceeded.
+    // They all sit at the front of the LRU list, since reading a column moves it there.
+    while (bytes_ > budget_ && !lru_.empty())
+    {
+        auto entry = entries_.find(lru_.back());
+        if (entry->second.epoch == epoch_)
+        {
+            break;
+        }
+        bytes_ -= entry->second.bytes;
+        entries_.erase(entry);
+        lru_.pop_back();
+        ++statistics_.evictions;
+    }
+}
+
+ColumnCache::Statistics ColumnCache::statistics() const
+{
+    std::lock_guard lock(mutex_);
+    return statistics_;
+}
+
+} // namespace Antares::Data
@@ -0,0 +1,132 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#ifndef __ANTARES_LIBS_SERIES_COLUMN_CACHE_H__
+#define __ANTARES_LIBS_SERIES_COLUMN_CACHE_H__
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <antares/array/matrix.h>
+
+namespace Antares::Data
+{
+/*!
+** \brief Binary file holding time-series, so that columns can be read back one by one
+**
+** Matrices are appended column-major as raw doubles : reading a single column
+** only requires one seek. The file is removed when the store is destroyed.
+*/
+class ColumnStore final
+{
+public:
+    //! Location of a matrix in the store
+    struct Block
+    {
+        uint64_t offset = 0;
+        uint32_t width = 0;
+        uint32_t height = 0;
+    };
+
+    explicit ColumnStore(std::filesystem::path path);
+    ~ColumnStore();
+
+    ColumnStore(const ColumnStore&) = delete;
+    ColumnStore& operator=(const ColumnStore&) = delete;
+
+    //! Append the content of a matrix to the store
+    Block append(const Matrix<double>& m);
+
+    //! Read a single column of a block
+    void readColumn(const Block& block, uint32_t column, double* out) const;
+
+    const std::filesystem::path& path() const;
+
+private:
+    std::filesystem::path path_;
+    mutable std::fstream file_;
+    uint64_t size_ = 0;
+};
+
+/*!
+** \brief Memory-budgeted LRU cache of columns read on demand from a ColumnStore
+**
+** Columns returned by get() are pinned until the next call to unpinAll() : they
+** are never evicted while a set of MC years may still be reading them. When the
+** budget is exceeded, the least recently used unpinned columns are dropped.
+** All methods are thread-safe.
+*/
+class ColumnCache final
+{
+public:
+    struct Statistics
+    {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        //! Highest amount of memory used by the cached columns
+        uint64_t peakBytes = 0;
+    };
+
+    ColumnCache(std::filesystem::path storePath, uint64_t budgetInBytes);
+
+    //! Offload a matrix into the underlying store
+    ColumnStore::Block store(const Matrix<double>& m);
+
+    //! Get a column, reading it from the store if not already in memory
+    const double* get(const ColumnStore::Block& block, uint32_t column);
+
+    //! Release the columns pinned so far, and evict the cold ones if needed
+    void unpinAll();
+
+    Statistics statistics() const;
+
+private:
+    struct Entry
+    {
+        std::unique_ptr<double[]> data;
+        uint64_t bytes = 0;
+        std::list<uint64_t>::iterator lru;
+        uint64_t epoch = 0;
+    };
+
+    //! Drop the least recently used columns until the budget is respected
+    void evict();
+
+    ColumnStore store_;
+    const uint64_t budget_;
+    mutable std::mutex mutex_;
+    //! Columns indexed by their offset in the store
+    std::unordered_map<uint64_t, Entry> entries_;
+    //! Most recently used columns first
+    std::list<uint64_t> lru_;
+    uint64_t bytes_ = 0;
+    uint64_t epoch_ = 0;
+    Statistics statistics_;
+};
+
+} // namespace Antares::Data
+
+#endif // __ANTARES_LIBS_SERIES_COLUMN_CACHE_H__
@@ -22,11 +22,14 @@
 #define __ANTARES_LIBS_STUDY_PARTS_COMMON_TIMESERIES_H__
 
 #include <map>
+#include <memory>
 #include <optional>
 #include <string>
 
 #include <antares/array/matrix.h>
 
+#include "column-cache.h"
+
 namespace Antares::Data
 {
 /*!
@@ -100,6 +103,7 @@ public:
     void reset();
     void reset(uint32_t width, uint32_t height);
     uint32_t numberOfColumns() const;
+    uint32_t numberOfTimesteps() const;
     void unloadFromMemory() const;
     void roundAllEntries();
     void resize(uint32_t timeSeriesCount, uint32_t timestepCount);
@@ -109,10 +113,25 @@ public:
     bool forceReload(bool reload = false) const;
     void markAsModified() const;
 
+    /*!
+    ** \brief Move the data into the store of a column cache
+    **
+    ** `timeSeries` is emptied, and getColumn()/getCoefficient() read the columns
+    ** on demand through the cache. Any call to reset(), resize() or loadFromFile()
+    ** brings the series back to the regular in-memory mode.
+    */
+    void loadOnDemand(std::shared_ptr<ColumnCache> cache);
+    bool isLoadedOnDemand() const;
+
     TS timeSeries;
     TimeSeriesNumbers& timeseriesNumbers;
 
     static const std::vector<double> emptyColumn; ///< used in getColumn if timeSeries empty
+
+private:
+    //! Cache to read the columns from, when the data is loaded on demand
+    std::shared_ptr<ColumnCache> columnCache_;
+    ColumnStore::Block storedBlock_;
 };
 
 } // namespace Antares::Data
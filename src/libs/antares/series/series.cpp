@@ -113,6 +113,7 @@ TimeSeries::TimeSeries(TimeSeriesNumbers& tsNumbers):
 
 bool TimeSeries::loadFromFile(const std::filesystem::path& path, const bool average)
 {
+    columnCache_.reset();
     bool ret = true;
     Matrix<>::BufferType dataBuffer;
     ret = timeSeries.loadFromCSVFile(path.string(), 1, HOURS_PER_YEAR, &dataBuffer) && ret;
@@ -143,11 +144,15 @@ int TimeSeries::saveToFile(const std::string& filename, bool saveEvenIfAllZero)
 
 double TimeSeries::getCoefficient(uint32_t year, uint32_t timestep) const
 {
-    return timeSeries[getSeriesIndex(year)][timestep];
+    return getColumn(year)[timestep];
 }
 
 const double* TimeSeries::getColumn(uint32_t year) const
 {
+    if (columnCache_)
+    {
+        return columnCache_->get(storedBlock_, getSeriesIndex(year));
+    }
     return timeSeries[getSeriesIndex(year)];
 }
 
@@ -173,21 +178,29 @@ double* TimeSeries::operator[](uint32_t index)
 
 void TimeSeries::reset()
 {
+    columnCache_.reset();
     timeSeries.reset(1, HOURS_PER_YEAR);
 }
 
 void TimeSeries::reset(uint32_t width, uint32_t height)
 {
+    columnCache_.reset();
     timeSeries.reset(width, height);
 }
 
 uint32_t TimeSeries::numberOfColumns() const
 {
-    return timeSeries.width;
+    return columnCache_ ? storedBlock_.width : timeSeries.width;
+}
+
+uint32_t TimeSeries::numberOfTimesteps() const
+{
+    return columnCache_ ? storedBlock_.height : timeSeries.height;
 }
 
 void TimeSeries::resize(uint32_t timeSeriesCount, uint32_t timestepCount)
 {
+    columnCache_.reset();
     timeSeries.resize(timeSeriesCount, timestepCount);
 }
 
@@ -221,4 +234,16 @@ void TimeSeries::markAsModified() const
     timeSeries.markAsModified();
 }
 
+void TimeSeries::loadOnDemand(std::shared_ptr<ColumnCache> cache)
+{
+    storedBlock_ = cache->store(timeSeries);
+    columnCache_ = std::move(cache);
+    timeSeries.clear();
+}
+
+bool TimeSeries::isLoadedOnDemand() const
+{
+    return columnCache_ != nullptr;
+}
+
 } // namespace Antares::Data
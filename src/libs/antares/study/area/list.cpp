@@ -21,10 +21,13 @@
 
 #include <cassert>
 #include <fstream>
+#include <sstream>
 
 #include <yuni/io/file.h>
 
 #include <antares/inifile/inifile.h>
+#include <antares/io/archive.h>
+#include <antares/io/load-profile.h>
 #include <antares/logs/logs.h>
 #include <antares/study/area/scratchpad.h>
 #include "antares/antares/antares.h"
@@ -34,7 +37,7 @@
 #include "antares/study/parts/parts.h"
 #include "antares/utils/utils.h"
 
-#define SEP IO::Separator
+#define SEP Yuni::IO::Separator
 
 using namespace Yuni;
 
@@ -201,7 +204,7 @@ static bool AreaListSaveToFolderSingleArea(const Area& area,
 
     // A specific folder for general data
     buffer.clear() << folder << SEP << "input" << SEP << "areas" << SEP << area.id;
-    if (!IO::Directory::Create(buffer))
+    if (!Yuni::IO::Directory::Create(buffer))
     {
         logs.error() << "I/O Error: Impossible to create: " << buffer;
         ret = false;
@@ -540,12 +543,13 @@ Area* AreaListAddFromNames(AreaList& list, const AnyString& name, const AnyStrin
 
 bool AreaList::loadListFromFile(const fs::path& filename)
 {
-    std::ifstream file(filename);
-    if (!file.is_open())
+    std::string content;
+    if (!IO::readFileContent(filename, content))
     {
         logs.error() << "I/O error: " << filename << ": Impossible to open the file";
         return false;
     }
+    std::istringstream file(content);
 
     // Log entry
     logs.info() << "  Loading the area list from `" << filename << '`';
@@ -708,48 +712,48 @@ bool AreaList::saveToFolder(const AnyString& folder) const
 
     // Create the whole structure
     buffer.clear() << folder << SEP << "input" << SEP << "areas";
-    ret = IO::Directory::Create(buffer) && ret;
+    ret = Yuni::IO::Directory::Create(buffer) && ret;
 
     buffer.clear() << folder << SEP << "input" << SEP << "reserves";
-    ret = IO::Directory::Create(buffer) && ret;
+    ret = Yuni::IO::Directory::Create(buffer) && ret;
 
     buffer.clear() << folder << SEP << "input" << SEP << "bindingconstraints";
-    ret = IO::Directory::Create(buffer) && ret;
+    ret = Yuni::IO::Directory::Create(buffer) && ret;
 
     buffer.clear() << folder << SEP << "input" << SEP << "links";
-    ret = IO::Directory::Create(buffer) && ret;
+    ret = Yuni::IO::Directory::Create(buffer) && ret;
 
     buffer.clear() << folder << SEP << "input" << SEP << "load" << SEP << "series";
-    ret = IO::Directory::Create(buffer) && ret;
+    ret = Yuni::IO::Directory::Create(buffer) && ret;
     buffer.clear() << folder << SEP << "input" << SEP << "load" << SEP << "prepro";
-    ret = IO::Directory::Create(buffer) && ret;
+    ret = Yuni::IO::Directory::Create(buffer) && ret;
 
     buffer.clear() << folder << SEP << "input" << SEP << "solar" << SEP << "series";
-    ret = IO::Directory::Create(buffer) && ret;
+    ret = Yuni::IO::Directory::Create(buffer) && ret;
     buffer.clear() << folder << SEP << "input" << SEP << "solar" << SEP << "prepro";
-    ret = IO::Directory::Create(buffer) && ret;
+    ret = Yuni::IO::Directory::Create(buffer) && ret;
 
     buffer.clear() << folder << SEP << "input" << SEP << "wind" << SEP << "series";
-    ret = IO::Directory::Create(buffer) && ret;
+    ret = Yuni::IO::Directory::Create(buffer) && ret;
     buffer.clear() << folder << SEP << "input" << SEP << "wind" << SEP << "prepro";
-    ret = IO::Directory::Create(buffer) && ret;
+    ret = Yuni::IO::Directory::Create(buffer) && ret;
 
     buffer.clear() << folder << SEP << "input" << SEP << "hydro" << SEP << "series";
-    ret = IO::Directory::Create(buffer) && ret;
+    ret = Yuni::IO::Directory::Create(buffer) && ret;
     buffer.clear() << folder << SEP << "input" << SEP << "hydro" << SEP << "prepro";
-    ret = IO::Directory::Create(buffer) && ret;
+    ret = Yuni::IO::Directory::Create(buffer) && ret;
     buffer.clear() << folder << SEP << "input" << SEP << "hydro" << SEP << "allocation";
-    ret = IO::Directory::Create(buffer) && ret;
+    ret = Yuni::IO::Directory::Create(buffer) && ret;
     buffer.clear() << folder << SEP << "input" << SEP << "hydro" << SEP << "common" << SEP
                    << "capacity";
-    ret = IO::Directory::Create(buffer) && ret;
+    ret = Yuni::IO::Directory::Create(buffer) && ret;
 
     buffer.clear() << folder << SEP << "input" << SEP << "thermal" << SEP << "series";
-    ret = IO::Directory::Create(buffer) && ret;
+    ret = Yuni::IO::Directory::Create(buffer) && ret;
     buffer.clear() << folder << SEP << "input" << SEP << "thermal" << SEP << "prepro";
-    ret = IO::Directory::Create(buffer) && ret;
+    ret = Yuni::IO::Directory::Create(buffer) && ret;
     buffer.clear() << folder << SEP << "input" << SEP << "thermal" << SEP << "clusters";
-    ret = IO::Directory::Create(buffer) && ret;
+    ret = Yuni::IO::Directory::Create(buffer) && ret;
 
     // Write the list of areas to a flat file
     buffer.clear() << folder << SEP << "input" << SEP << "areas" << SEP << "list.txt";
@@ -998,6 +1002,9 @@ static bool AreaListLoadFromFolderSingleArea(Study& study,
         }
     }
 
+    // Only the time-series of a single area are in memory at once when read on demand
+    study.storeTimeSeriesOnDemand(area);
+
     // Thermal cluster list
     {
         fs::path preproPath = study.folderInput / "thermal" / "prepro";
@@ -1160,6 +1167,7 @@ bool AreaList::loadFromFolder(const StudyLoadOptions& options)
 
     // Load the list of all available areas
     {
+        Statistics::LoadPhase phase("areas: list");
         logs.info() << "Loading the list of areas...";
         fs::path areaListPath = pStudy.folderInput / "areas" / "list.txt";
         ret = loadListFromFile(areaListPath) && ret;
@@ -1167,6 +1175,7 @@ bool AreaList::loadFromFolder(const StudyLoadOptions& options)
 
     // Hydro
     {
+        Statistics::LoadPhase phase("areas: global hydro data");
         logs.info() << "Loading global hydro data...";
         fs::path hydroPath = pStudy.folderInput / "hydro";
         ret = PartHydro::LoadFromFolder(pStudy, hydroPath.string()) && ret;
@@ -1175,6 +1184,7 @@ bool AreaList::loadFromFolder(const StudyLoadOptions& options)
 
     // Thermal data, specific to areas
     {
+        Statistics::LoadPhase phase("areas: thermal clusters");
         logs.info() << "Loading thermal clusters...";
         fs::path thermalPath = pStudy.folderInput / "thermal";
         fs::path areaIniPath = thermalPath / "areas.ini";
@@ -1182,23 +1192,33 @@ bool AreaList::loadFromFolder(const StudyLoadOptions& options)
 
         // The cluster list must be loaded before the method ensureDataIsInitialized is called
         // in order to allocate data with all thermal clusters.
-        auto end = areas.end();
-        for (auto i = areas.begin(); i != end; ++i)
+        // The INI files of the areas are independent, they are parsed concurrently
+        std::vector<fs::path> listPaths;
+        listPaths.reserve(areas.size());
+        for (const auto& area: areas | std::views::values)
         {
-            Area& area = *(i->second);
-            fs::path areaPath = thermalPath / "clusters" / area.id.to<std::string>();
-            ret = area.thermal.list.loadFromFolder(pStudy, areaPath, &area) && ret;
-            ret = area.thermal.list.validateClusters(pStudy.parameters) && ret;
+            listPaths.push_back(thermalPath / "clusters" / area->id.to<std::string>() / "list.ini");
+        }
+        auto listInis = IniFile::OpenAll(listPaths, pStudy.getNumberOfConfiguredCores());
+
+        uint index = 0;
+        for (const auto& area: areas | std::views::values)
+        {
+            const auto& ini = listInis[index];
+            fs::path areaPath = listPaths[index++].parent_path();
+            ret = ini && area->thermal.list.loadFromIniFile(pStudy, areaPath, area, *ini) && ret;
+            ret = area->thermal.list.validateClusters(pStudy.parameters) && ret;
         }
     }
 
     // Short term storage data, specific to areas
     if (studyVersion >= StudyVersion(8, 6))
     {
+        Statistics::LoadPhase phase("areas: short-term storage clusters");
         logs.info() << "Loading short term storage clusters...";
         fs::path stsFolder = pStudy.folderInput / "st-storage";
 
-        if (fs::exists(stsFolder))
+        if (IO::exists(stsFolder))
         {
             for (const auto& area: areas | std::views::values)
             {
@@ -1219,6 +1239,7 @@ bool AreaList::loadFromFolder(const StudyLoadOptions& options)
     // Renewable data, specific to areas
     if (studyVersion >= StudyVersion(8, 1))
     {
+        Statistics::LoadPhase phase("areas: renewable clusters");
         // The cluster list must be loaded before the method ensureDataIsInitialized is called
         // in order to allocate data with all renewable clusters.
         fs::path renewClusterPath = pStudy.folderInput / "renewables" / "clusters";
@@ -1247,6 +1268,7 @@ bool AreaList::loadFromFolder(const StudyLoadOptions& options)
           logs.info() << options.logMessage;
 
           // Load a single area
+          Statistics::LoadPhase phase("areas: data of an area");
           ret = AreaListLoadFromFolderSingleArea(pStudy, this, area, buffer, options) && ret;
       });
 
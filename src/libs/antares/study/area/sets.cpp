@@ -20,6 +20,8 @@
 */
 #include "antares/study/sets.h"
 
+#include <antares/io/archive.h>
+
 namespace Antares::Data
 {
 Sets::Sets(const Sets& rhs):
@@ -170,7 +172,7 @@ bool Sets::loadFromFile(const std::filesystem::path& filename)
     clear();
 
     // Loading the INI file
-    if (!std::filesystem::exists(filename))
+    if (!IO::exists(filename))
     {
         // Error silently ignored
         return true;
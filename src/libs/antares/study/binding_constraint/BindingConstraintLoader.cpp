@@ -29,6 +29,7 @@
 
 #include "yuni/core/string/string.h"
 
+#include <antares/io/load-profile.h>
 #include <antares/utils/utils.h>
 #include "antares/study/binding_constraint/BindingConstraint.h"
 #include "antares/study/version.h"
@@ -284,6 +285,7 @@ bool BindingConstraintLoader::SeparateValue(const EnvForLoading& env,
 bool BindingConstraintLoader::loadTimeSeries(EnvForLoading& env,
                                              BindingConstraint* bindingConstraint)
 {
+    Statistics::LoadPhase phase("binding constraints: time-series");
     if (env.version >= StudyVersion(8, 7))
     {
         return loadTimeSeries(env, bindingConstraint->operatorType(), bindingConstraint);
@@ -204,16 +204,16 @@ bool BindingConstraintsRepository::loadFromFolder(Study& study,
     env.folder = folder;
 
     env.iniFilename = folder / "bindingconstraints.ini";
-    IniFile ini;
-    if (!ini.open(env.iniFilename))
+    auto ini = openIniFile(env.iniFilename);
+    if (!ini)
     {
         return false;
     }
 
     // For each section
-    if (ini.firstSection)
+    if (ini->firstSection)
     {
-        for (env.section = ini.firstSection; env.section; env.section = env.section->next)
+        for (env.section = ini->firstSection; env.section; env.section = env.section->next)
         {
             if (env.section->firstProperty)
             {
@@ -252,6 +252,33 @@ bool BindingConstraintsRepository::loadFromFolder(Study& study,
     return true;
 }
 
+void BindingConstraintsRepository::prefetchIniFile(const std::filesystem::path& folder)
+{
+    prefetchedIniFilename_ = folder / "bindingconstraints.ini";
+    prefetchedIni_ = std::async(std::launch::async,
+                                [filename = prefetchedIniFilename_]
+                                {
+                                    // Errors are reported by the synchronous attempt
+                                    auto ini = std::make_unique<IniFile>();
+                                    return ini->open(filename, false) ? std::move(ini) : nullptr;
+                                });
+}
+
+std::unique_ptr<IniFile> BindingConstraintsRepository::openIniFile(
+  const std::filesystem::path& filename)
+{
+    if (prefetchedIni_.valid() && prefetchedIniFilename_ == filename)
+    {
+        if (auto ini = prefetchedIni_.get())
+        {
+            return ini;
+        }
+    }
+
+    auto ini = std::make_unique<IniFile>();
+    return ini->open(filename) ? std::move(ini) : nullptr;
+}
+
 void BindingConstraintsRepository::changeConstraintsWeeklyToDaily()
 {
     each(
@@ -25,6 +25,7 @@
 #include <cstdlib>
 #include <ctime>
 
+#include <antares/io/archive.h>
 #include <antares/logs/logs.h>
 #include "antares/study/version.h"
 
@@ -207,10 +208,10 @@ StudyVersion StudyHeader::tryToFindTheVersion(const std::string& folder)
     fs::path abspath = fs::absolute(folder);
     abspath = abspath.lexically_normal();
 
-    if (fs::exists(abspath))
+    if (IO::exists(abspath))
     {
         abspath /= "study.antares";
-        if (fs::exists(abspath))
+        if (IO::exists(abspath))
         {
             // The raw version number
             std::string versionStr;
@@ -24,7 +24,9 @@
 
 #pragma once
 
+#include <filesystem>
 #include <functional>
+#include <future>
 #include <memory>
 
 #include "BindingConstraint.h"
@@ -114,6 +116,14 @@ public:
                                       const Data::StudyLoadOptions& options,
                                       const std::filesystem::path& folder);
 
+    /*!
+    ** \brief Start parsing the file `bindingconstraints.ini` of a folder in the background
+    **
+    ** The parsing does not depend on the areas, so it can be done while they are
+    ** loaded. The result is used by the next call to `loadFromFolder()` on the same folder.
+    */
+    void prefetchIniFile(const std::filesystem::path& folder);
+
     /*!
     ** \brief Save all binding constraints into a folder
     */
@@ -176,6 +186,13 @@ public:
 private:
     bool internalSaveToFolder(Data::BindingConstraintSaver::EnvForSaving& env) const;
 
+    //! The INI file of a folder, from the prefetched one if any
+    std::unique_ptr<IniFile> openIniFile(const std::filesystem::path& filename);
+
+    //! The INI file being parsed in the background, and its path
+    std::future<std::unique_ptr<IniFile>> prefetchedIni_;
+    std::filesystem::path prefetchedIniFilename_;
+
     //! All constraints
     Data::BindingConstraintsRepository::Vector constraints_;
 
@@ -56,6 +56,9 @@ public:
     //! Force the derated mode
     bool forceDerated;
 
+    //! Memory budget (MB) of the load/solar/wind time-series read on demand (0 to disable)
+    uint timeSeriesMemoryBudget = 0;
+
     //! No Timeseries import in the input
     // This option might be useful for running old studies without upgrading
     bool noTimeseriesImportIntoInput;
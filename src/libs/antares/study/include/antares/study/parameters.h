@@ -285,6 +285,16 @@ public:
     ** \see TimeSeries
     */
     uint timeSeriesToArchive;
+
+    //! Encoding of the archived time-series
+    enum class ArchiveFormat
+    {
+        //! Text matrices (.txt), as the input of a study
+        Text,
+        //! Raw binary matrices (.bin), converted back to text by antares-ts-generator
+        Binary
+    };
+    ArchiveFormat timeSeriesArchiveFormat = ArchiveFormat::Text;
     //@}
 
     //! \name Pre-Processor
@@ -408,6 +418,16 @@ public:
             Hourly
         };
         HydroPmax hydroPmax = HydroPmax::Daily;
+
+        //! Seeding of the availability time-series generators (thermal clusters and links)
+        enum class TsGenSeeding
+        {
+            //! One random stream shared by all clusters, drawn one cluster after the other
+            V1,
+            //! One independent random stream per cluster and per refresh, generated in parallel
+            V2
+        };
+        TsGenSeeding tsGenSeeding = TsGenSeeding::V1;
     };
 
     Compatibility compatibility;
@@ -533,6 +553,11 @@ bool StringToSimulationMode(SimulationMode& mode, Yuni::CString<20, false> text)
 
 const char* CompatibilityHydroPmaxToCString(const Parameters::Compatibility::HydroPmax);
 bool StringToCompatibilityHydroPmax(Parameters::Compatibility::HydroPmax&, const std::string& text);
+const char* CompatibilityTsGenSeedingToCString(const Parameters::Compatibility::TsGenSeeding);
+bool StringToCompatibilityTsGenSeeding(Parameters::Compatibility::TsGenSeeding&,
+                                       const std::string& text);
+const char* ArchiveFormatToCString(const Parameters::ArchiveFormat);
+bool StringToArchiveFormat(Parameters::ArchiveFormat&, const std::string& text);
 
 } // namespace Antares::Data
 
@@ -45,6 +45,16 @@ public:
     */
     bool loadFromFolder(Study& s, const std::filesystem::path& folder, Area* area);
 
+    /*!
+    ** \brief Load the thermal clusters from an already parsed `list.ini`
+    **
+    ** \param folder The folder of the area, containing the `list.ini` file
+    */
+    bool loadFromIniFile(Study& s,
+                         const std::filesystem::path& folder,
+                         Area* area,
+                         const IniFile& ini);
+
     //! \name Constructor & Destructor
     //@{
     /*!
@@ -312,6 +312,33 @@ public:
     */
     void performTransformationsBeforeLaunchingSimulation();
 
+    /*!
+    ** \brief Share the memory of identical input time-series between their owners
+    **
+    ** The matrices are hashed and identical ones (e.g. default modulation or
+    ** all-zero mingen) share a single copy-on-write buffer.
+    ** The amount of memory saved is written into the logs.
+    */
+    void shareIdenticalTimeSeries();
+
+    /*!
+    ** \brief Read the ready-made load, solar and wind time-series on demand
+    **
+    ** To be called before loading the areas. Their columns are moved into a binary
+    ** store in the cache folder as soon as each area is read, and only the columns
+    ** used by the running MC years are kept in memory, within the given budget
+    ** (see timeSeriesColumnCache).
+    */
+    void loadTimeSeriesOnDemand(uint64_t memoryBudget);
+
+    /*!
+    ** \brief Move the ready-made load, solar and wind time-series of an area into the store
+    **
+    ** Nothing is done if the time-series are not read on demand. The stored columns
+    ** can not be modified : the DSM values are added to the load beforehand.
+    */
+    void storeTimeSeriesOnDemand(Area& area);
+
     /*!
     ** \brief Initialize runtime informations required by the solver
     */
@@ -391,6 +418,19 @@ public:
     */
     unsigned getNumberOfCoresPerMode(unsigned nbLogicalCores, int ncMode);
 
+    /*!
+    ** \brief Number of logical cores of this machine to use, according to the
+    ** "Number of Cores" level
+    */
+    unsigned getNumberOfConfiguredCores();
+
+    /*!
+    ** \brief Number of cores left to each of the MC years run in parallel (at least 1)
+    **
+    ** The configured cores are shared evenly between the maxNbYearsInParallel years.
+    */
+    unsigned getNumberOfCoresPerParallelYear();
+
     /*!
     ** \brief Computes number of cores
     **
@@ -605,6 +645,9 @@ public:
     //! The queue service that runs every set of parallel years
     std::shared_ptr<Yuni::Job::QueueService> pQueueService;
 
+    //! Columns of the time-series read on demand (null if all time-series are in memory)
+    std::shared_ptr<ColumnCache> timeSeriesColumnCache;
+
 public:
     //! \name TS Generators
     //@{
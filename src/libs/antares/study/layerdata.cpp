@@ -27,6 +27,7 @@
 #include <yuni/core/string.h>
 
 #include <antares/inifile/inifile.h>
+#include <antares/io/archive.h>
 #include <antares/logs/logs.h>
 
 using namespace Yuni;
@@ -36,7 +37,7 @@ namespace Antares::Data
 void LayerData::loadLayers(const std::filesystem::path& filename)
 {
     IniFile ini;
-    if (std::ifstream(filename.c_str()).good() && ini.open(filename)) // check if file exists
+    if (IO::exists(filename.c_str()) && ini.open(filename)) // check if file exists
     {
         // The section
         if (auto* section = ini.find("layers"); section)
@@ -77,7 +78,7 @@ void LayerData::loadLayers(const std::filesystem::path& filename)
 
 bool LayerData::saveLayers(const AnyString& filename)
 {
-    if (IO::File::Stream file; file.openRW(filename))
+    if (Yuni::IO::File::Stream file; file.openRW(filename))
     {
         CString<256, true> data;
         data << "[layers]\n";
@@ -21,6 +21,8 @@
 #include <fstream>
 
 #include <antares/benchmarking/DurationCollector.h>
+#include <antares/io/archive.h>
+#include <antares/io/load-profile.h>
 #include "antares/study/scenario-builder/sets.h"
 #include "antares/study/study.h"
 #include "antares/study/ui-runtimeinfos.h"
@@ -175,13 +177,16 @@ bool Study::internalLoadFromFolder(const fs::path& path, const StudyLoadOptions&
     Statistics::LogsDumper statisticsDumper;
 
     // Check if the path is correct
-    if (!fs::exists(path))
+    if (!IO::exists(path))
     {
         logs.error()
           << path << ": The directory does not exist (or not enough privileges to read the folder)";
         return false;
     }
 
+    // Per file statistics, written to the output afterwards
+    Statistics::LoadProfileReset(path);
+
     // Initialize all internal paths
     relocate(path.string());
 
@@ -190,9 +195,12 @@ bool Study::internalLoadFromFolder(const fs::path& path, const StudyLoadOptions&
     this->bufferLoadingTS.reserve(2096);
     assert(this->bufferLoadingTS.capacity() > 0);
 
-    if (!internalLoadIni(path, options))
     {
-        return false;
+        Statistics::LoadPhase phase("settings");
+        if (!internalLoadIni(path, options))
+        {
+            return false;
+        }
     }
 
     // -------------------------
@@ -210,16 +218,38 @@ bool Study::internalLoadFromFolder(const fs::path& path, const StudyLoadOptions&
 
     // End logical core --------
 
+    // The binding constraints do not need to wait for the areas to parse their INI file
+    bindingConstraints.prefetchIniFile(folderInput / "bindingconstraints");
+
+    // The time-series read on demand are offloaded while the areas are loaded
+    if (usedByTheSolver && options.timeSeriesMemoryBudget)
+    {
+        loadTimeSeriesOnDemand(uint64_t(options.timeSeriesMemoryBudget) * 1024 * 1024);
+    }
+
     // Areas - Raw Data
-    bool ret = areas.loadFromFolder(options);
+    bool ret = true;
+    {
+        Statistics::LoadPhase phase("areas");
+        ret = areas.loadFromFolder(options) && ret;
+    }
 
     logs.info() << "Loading correlation matrices...";
     // Correlation matrices
-    ret = internalLoadCorrelationMatrices(options) && ret;
+    {
+        Statistics::LoadPhase phase("correlation matrices");
+        ret = internalLoadCorrelationMatrices(options) && ret;
+    }
     // Binding constraints
-    ret = internalLoadBindingConstraints(options) && ret;
+    {
+        Statistics::LoadPhase phase("binding constraints");
+        ret = internalLoadBindingConstraints(options) && ret;
+    }
     // Sets of areas & links
-    ret = internalLoadSets() && ret;
+    {
+        Statistics::LoadPhase phase("sets");
+        ret = internalLoadSets() && ret;
+    }
 
     parameterFiller(options);
     return ret;
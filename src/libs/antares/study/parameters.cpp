@@ -241,6 +241,63 @@ bool StringToCompatibilityHydroPmax(Parameters::Compatibility::HydroPmax& mode,
     return false;
 }
 
+const char* CompatibilityTsGenSeedingToCString(const Parameters::Compatibility::TsGenSeeding mode)
+{
+    switch (mode)
+    {
+    case Parameters::Compatibility::TsGenSeeding::V1:
+        return "v1";
+    case Parameters::Compatibility::TsGenSeeding::V2:
+        return "v2";
+    default:
+        return "Unknown";
+    }
+}
+
+bool StringToCompatibilityTsGenSeeding(Parameters::Compatibility::TsGenSeeding& mode,
+                                       const std::string& text)
+{
+    if (text == "v1")
+    {
+        mode = Parameters::Compatibility::TsGenSeeding::V1;
+        return true;
+    }
+    if (text == "v2")
+    {
+        mode = Parameters::Compatibility::TsGenSeeding::V2;
+        return true;
+    }
+    return false;
+}
+
+const char* ArchiveFormatToCString(const Parameters::ArchiveFormat format)
+{
+    switch (format)
+    {
+    case Parameters::ArchiveFormat::Text:
+        return "txt";
+    case Parameters::ArchiveFormat::Binary:
+        return "binary";
+    default:
+        return "Unknown";
+    }
+}
+
+bool StringToArchiveFormat(Parameters::ArchiveFormat& format, const std::string& text)
+{
+    if (text == "txt")
+    {
+        format = Parameters::ArchiveFormat::Text;
+        return true;
+    }
+    if (text == "binary")
+    {
+        format = Parameters::ArchiveFormat::Binary;
+        return true;
+    }
+    return false;
+}
+
 bool Parameters::economy() const
 {
     return mode == SimulationMode::Economy;
@@ -323,6 +380,7 @@ void Parameters::reset()
     refreshIntervalThermal = 100;
     // Archive
     timeSeriesToArchive = 0; // None
+    timeSeriesArchiveFormat = ArchiveFormat::Text;
     // Pre-Processor
     timeSeriesToGenerate = 0; // None
     // Import
@@ -649,6 +707,10 @@ static bool SGDIntLoadFamily_Output(Parameters& d,
     {
         return ConvertCStrToListTimeSeries(value, d.timeSeriesToArchive);
     }
+    if (key == "archives-format")
+    {
+        return StringToArchiveFormat(d.timeSeriesArchiveFormat, value);
+    }
     if (key == "storenewset")
     {
         return value.to<bool>(d.storeTimeseriesNumbers);
@@ -1101,6 +1163,10 @@ static bool SGDIntLoadFamily_Compatibility(Parameters& d,
     {
         return StringToCompatibilityHydroPmax(d.compatibility.hydroPmax, value);
     }
+    if (key == "tsgen-seeding")
+    {
+        return StringToCompatibilityTsGenSeeding(d.compatibility.tsGenSeeding, value);
+    }
 
     return false;
 }
@@ -1867,6 +1933,10 @@ void Parameters::saveToINI(IniFile& ini) const
             section->add("hydro-debug", hydroDebug);
         }
         ParametersSaveTimeSeries(section, "archives", timeSeriesToArchive);
+        if (timeSeriesArchiveFormat != ArchiveFormat::Text)
+        {
+            section->add("archives-format", ArchiveFormatToCString(timeSeriesArchiveFormat));
+        }
         ParametersSaveResultFormat(section, resultFormat);
     }
 
@@ -2029,6 +2099,8 @@ void Parameters::saveToINI(IniFile& ini) const
     {
         auto* section = ini.addSection("compatibility");
         section->add("hydro-pmax", CompatibilityHydroPmaxToCString(compatibility.hydroPmax));
+        section->add("tsgen-seeding",
+                     CompatibilityTsGenSeedingToCString(compatibility.tsGenSeeding));
     }
 }
 
@@ -21,6 +21,7 @@
 
 #include "antares/study/parts/hydro/allocation.h"
 
+#include <antares/io/archive.h>
 #include <antares/utils/utils.h>
 #include "antares/study/study.h"
 
@@ -169,7 +170,7 @@ bool HydroAllocation::loadFromFile(const AreaName& referencearea, const fs::path
     clear();
 
     IniFile ini;
-    if (!fs::exists(filename) || !ini.open(filename))
+    if (!IO::exists(filename) || !ini.open(filename))
     {
         pValues[referencearea] = 1.0;
         return true;
@@ -22,9 +22,11 @@
 
 #include <fstream>
 #include <iomanip>
+#include <sstream>
 
 #include <yuni/io/file.h>
 
+#include <antares/io/archive.h>
 #include <antares/logs/logs.h>
 #include "antares/antares/constants.h"
 
@@ -62,14 +64,13 @@ bool loadFile(const fs::path& path, std::vector<double>& vect)
 
     vect.reserve(HOURS_PER_YEAR);
 
-    std::ifstream file;
-    file.open(path);
-
-    if (!file.is_open())
+    std::string content;
+    if (!IO::readFileContent(path, content))
     {
         logs.debug() << "File not found: " << path;
         return true;
     }
+    std::istringstream file(content);
 
     unsigned int lineCount = 0;
     std::string line;
@@ -653,6 +653,8 @@ void ThermalCluster::checkAndCorrectAvailability()
             condition = rightpart > series.timeSeries.entry[x][y];
             if (condition)
             {
+                // Direct write through `entry`, the data may be shared with another cluster
+                series.timeSeries.detach();
                 series.timeSeries.entry[x][y] = rightpart;
                 report = true;
             }
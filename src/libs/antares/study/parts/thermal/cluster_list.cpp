@@ -92,9 +92,6 @@ bool ThermalClusterList::loadFromFolder(Study& study, const fs::path& folder, Ar
 {
     assert(area && "A parent area is required");
 
-    // logs
-    logs.info() << "Loading thermal configuration for the area " << area->name;
-
     // Open the ini file
     IniFile ini;
     if (!ini.open(folder / "list.ini"))
@@ -102,6 +99,19 @@ bool ThermalClusterList::loadFromFolder(Study& study, const fs::path& folder, Ar
         return false;
     }
 
+    return loadFromIniFile(study, folder, area, ini);
+}
+
+bool ThermalClusterList::loadFromIniFile(Study& study,
+                                         const fs::path& folder,
+                                         Area* area,
+                                         const IniFile& ini)
+{
+    assert(area && "A parent area is required");
+
+    // logs
+    logs.info() << "Loading thermal configuration for the area " << area->name;
+
     bool ret = true;
 
     if (!ini.firstSection)
@@ -28,6 +28,7 @@
 #include <yuni/io/directory.h>
 #include <yuni/io/file.h>
 
+#include <antares/io/archive.h>
 #include <antares/logs/logs.h>
 #include "antares/study/study.h"
 
@@ -35,7 +36,7 @@ using namespace Yuni;
 
 namespace fs = std::filesystem;
 
-#define SEP IO::Separator
+#define SEP Yuni::IO::Separator
 
 namespace Antares::Data
 {
@@ -52,7 +53,7 @@ void EconomicInputData::copyFrom(const EconomicInputData& rhs)
 bool EconomicInputData::saveToFolder(const AnyString& folder) const
 {
     bool ret = true;
-    if (IO::Directory::Create(folder))
+    if (Yuni::IO::Directory::Create(folder))
     {
         String buffer;
         buffer.clear() << folder << SEP << "fuelCost.txt";
@@ -73,7 +74,7 @@ bool EconomicInputData::loadFromFolder(Study& study, const fs::path& folder)
         Yuni::Clob dataBuffer;
 
         fs::path filename = folder / "fuelCost.txt";
-        if (fs::exists(filename))
+        if (IO::exists(filename))
         {
             ret = fuelcost.loadFromCSVFile(filename.string(),
                                            1,
@@ -88,7 +89,7 @@ bool EconomicInputData::loadFromFolder(Study& study, const fs::path& folder)
         }
 
         filename = folder / "CO2Cost.txt";
-        if (fs::exists(filename))
+        if (IO::exists(filename))
         {
             ret = co2cost.loadFromCSVFile(filename.string(),
                                           1,
@@ -21,6 +21,7 @@
 
 #include "antares/study/scenario-builder/sets.h"
 
+#include <antares/io/archive.h>
 #include <antares/logs/logs.h>
 #include "antares/study/study.h"
 
@@ -64,7 +65,7 @@ bool Sets::loadFromStudy(Study& study)
                                      / "scenariobuilder.dat";
     bool r = true;
     // If the source code below is changed, please change it in loadFromINIFile too
-    if (std::filesystem::exists(filename))
+    if (IO::exists(filename))
     {
         r = internalLoadFromINIFile(filename.string());
     }
@@ -152,7 +153,7 @@ bool Sets::internalSaveToIniFile(const AnyString& filename) const
     }
 
     // Open the file
-    IO::File::Stream file;
+    Yuni::IO::File::Stream file;
     if (not file.openRW(filename))
     {
         logs.error() << "Impossible to write " << filename;
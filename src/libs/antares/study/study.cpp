@@ -21,6 +21,7 @@
 
 #include "antares/study/study.h"
 
+#include <algorithm>
 #include <cassert>
 #include <climits>
 #include <cmath> // For use of floor(...) and ceil(...)
@@ -28,6 +29,7 @@
 #include <optional>
 #include <sstream> // std::ostringstream
 #include <thread>
+#include <utility>
 
 #include <yuni/yuni.h>
 #include <yuni/core/string.h>
@@ -36,6 +38,8 @@
 #include <yuni/datetime/timestamp.h>
 #include <yuni/io/file.h>
 
+#include <antares/array/matrix-content-pool.h>
+#include <antares/memory/memory.h>
 #include <antares/writer/writer_factory.h>
 #include "antares/antares/antares.h"
 #include "antares/study/area/constants.h"
@@ -215,6 +219,16 @@ unsigned Study::getNumberOfCoresPerMode(unsigned nbLogicalCores, int ncMode)
     return 0;
 }
 
+unsigned Study::getNumberOfConfiguredCores()
+{
+    return getNumberOfCoresPerMode(std::thread::hardware_concurrency(), parameters.nbCores.ncMode);
+}
+
+unsigned Study::getNumberOfCoresPerParallelYear()
+{
+    return std::max(1u, getNumberOfConfiguredCores() / std::max(1u, maxNbYearsInParallel));
+}
+
 void Study::getNumberOfCores(const bool forceParallel, const uint nbYearsParallelForced)
 {
     /*
@@ -223,8 +237,7 @@ void Study::getNumberOfCores(const bool forceParallel, const uint nbYearsParalle
             This number is limited by the smallest refresh span (if at least
             one type of time series is generated)
     */
-    unsigned nbLogicalCores = std::thread::hardware_concurrency();
-    maxNbYearsInParallel = getNumberOfCoresPerMode(nbLogicalCores, parameters.nbCores.ncMode);
+    maxNbYearsInParallel = getNumberOfConfiguredCores();
 
     // In case solver option '--force-parallel n' is used, previous computation is overridden.
     if (forceParallel)
@@ -378,6 +391,30 @@ bool Study::initializeRuntimeInfos()
     return runtime.loadFromStudy(*this);
 }
 
+static void addDSMValuesToLoad(Area& area)
+{
+    // Informations about time-series for the load
+    auto& matrix = area.load.series.timeSeries;
+    auto& dsmvalues = area.reserves[fhrDSM];
+
+    // Adding DSM values
+    for (uint timeSeries = 0; timeSeries < matrix.width; ++timeSeries)
+    {
+        auto& perHour = matrix[timeSeries];
+        for (uint h = 0; h < matrix.height; ++h)
+        {
+            perHour[h] += dsmvalues[h];
+            // MBO - 13/05/2014 - #20
+            // Starting v4.5 load can be negative
+            /*if (perHour[h] < 0.)
+            {
+                    logs.warning() << area.id << ", hour " << h << ": `load - dsm` can not be
+            negative. Reset to 0"; perHour[h] = 0.;
+            }*/
+        }
+    }
+}
+
 void Study::performTransformationsBeforeLaunchingSimulation()
 {
 // Those computations are also made from the TS-Generator (ts-generator/xcast/xcast.cpp)
@@ -398,27 +435,92 @@ void Study::performTransformationsBeforeLaunchingSimulation()
               area.filterYearByYear = (uint)filterAll;
           }
 
-          // Informations about time-series for the load
-          auto& matrix = area.load.series.timeSeries;
-          auto& dsmvalues = area.reserves[fhrDSM];
+          // A load read on demand already contains the DSM values, and has no columns in memory
+          addDSMValuesToLoad(area);
+      });
+}
+
+void Study::shareIdenticalTimeSeries()
+{
+    MatrixContentPool pool;
+
+    areas.each(
+      [&pool](Data::Area& area)
+      {
+          pool.deduplicate(area.load.series.timeSeries);
+          pool.deduplicate(area.solar.series.timeSeries);
+          pool.deduplicate(area.wind.series.timeSeries);
+
+          if (auto* hydro = area.hydro.series.get())
+          {
+              pool.deduplicate(hydro->ror.timeSeries);
+              pool.deduplicate(hydro->storage.timeSeries);
+              pool.deduplicate(hydro->mingen.timeSeries);
+              pool.deduplicate(hydro->maxHourlyGenPower.timeSeries);
+              pool.deduplicate(hydro->maxHourlyPumpPower.timeSeries);
+          }
 
-          // Adding DSM values
-          for (uint timeSeries = 0; timeSeries < matrix.width; ++timeSeries)
+          for (const auto& cluster: area.thermal.list.all())
           {
-              auto& perHour = matrix[timeSeries];
-              for (uint h = 0; h < matrix.height; ++h)
-              {
-                  perHour[h] += dsmvalues[h];
-                  // MBO - 13/05/2014 - #20
-                  // Starting v4.5 load can be negative
-                  /*if (perHour[h] < 0.)
-                  {
-                          logs.warning() << area.id << ", hour " << h << ": `load - dsm` can not be
-                  negative. Reset to 0"; perHour[h] = 0.;
-                  }*/
-              }
+              pool.deduplicate(cluster->series.timeSeries);
+              pool.deduplicate(cluster->modulation);
+          }
+
+          for (const auto& cluster: area.renewable.list.all())
+          {
+              pool.deduplicate(cluster->series.timeSeries);
+          }
+
+          for (auto& [_, link]: area.links)
+          {
+              pool.deduplicate(link->directCapacities.timeSeries);
+              pool.deduplicate(link->indirectCapacities.timeSeries);
           }
       });
+
+    const auto& report = pool.report();
+    if (report.shared)
+    {
+        logs.info() << "Identical time-series: " << report.shared << " out of " << report.matrices
+                    << " matrices share their data, "
+                    << (report.bytesSaved / (1024 * 1024)) << " MB saved";
+    }
+}
+
+void Study::loadTimeSeriesOnDemand(uint64_t memoryBudget)
+{
+    const fs::path storePath = fs::path(memory.cacheFolder().c_str())
+                               / ("antares-ts-" + std::to_string(memory.processID()) + ".bin");
+    timeSeriesColumnCache = std::make_shared<ColumnCache>(storePath, memoryBudget);
+
+    logs.info() << "Time-series: load, solar and wind columns read on demand from " << storePath
+                << " (" << (memoryBudget / (1024 * 1024)) << " MB in memory at most)";
+}
+
+void Study::storeTimeSeriesOnDemand(Area& area)
+{
+    if (!timeSeriesColumnCache)
+    {
+        return;
+    }
+
+    // The generated time-series are written at each refresh : they must stay in memory
+    auto readOnDemand = [this](const TimeSeries& series, TimeSeriesType type)
+    { return !(parameters.timeSeriesToGenerate & type) && series.numberOfColumns() > 1; };
+
+    if (readOnDemand(area.load.series, timeSeriesLoad))
+    {
+        addDSMValuesToLoad(area);
+        area.load.series.loadOnDemand(timeSeriesColumnCache);
+    }
+    if (readOnDemand(area.solar.series, timeSeriesSolar))
+    {
+        area.solar.series.loadOnDemand(timeSeriesColumnCache);
+    }
+    if (readOnDemand(area.wind.series, timeSeriesWind))
+    {
+        area.wind.series.loadOnDemand(timeSeriesColumnCache);
+    }
 }
 
 // This function is a helper. It should be completed when adding new formats
@@ -1426,7 +1528,8 @@ void Study::computePThetaInfForThermalClusters() const
         {
             for (uint k = 0; k < HOURS_PER_YEAR; k++)
             {
-                cluster->PthetaInf[k] = cluster->modulation[Data::thermalMinGenModulation][k]
+                cluster->PthetaInf[k] = std::as_const(cluster->modulation)
+                                          [Data::thermalMinGenModulation][k]
                                         * cluster->unitCount * cluster->nominalCapacity;
             }
         }
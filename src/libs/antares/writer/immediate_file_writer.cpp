@@ -53,7 +53,10 @@ static bool prepareDirectoryHierarchy(const fs::path& root,
         return true;
     }
 
-    return fs::create_directories(directory);
+    // The directory may be created meanwhile by another thread writing a sibling entry
+    std::error_code ec;
+    fs::create_directories(directory, ec);
+    return fs::is_directory(directory);
 }
 
 // Write to file immediately, creating directories if needed
@@ -0,0 +1,458 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#include <stdexcept>
+
+#include <antares/optimisation/linear-problem-api/bufferedLinearProblem.h>
+
+namespace Antares::Optimisation::LinearProblemApi
+{
+
+// Element of the target problem standing for a buffered one
+template<class Buffered, class T>
+static T* resolve(T* element)
+{
+    if (auto* buffered = dynamic_cast<Buffered*>(element))
+    {
+        return buffered->target();
+    }
+    return element;
+}
+
+BufferedVariable::BufferedVariable(BufferedLinearProblem& owner,
+                                   double lb,
+                                   double ub,
+                                   bool integer,
+                                   std::string name):
+    owner_(owner),
+    lb_(lb),
+    ub_(ub),
+    integer_(integer),
+    name_(std::move(name))
+{
+}
+
+void BufferedVariable::setLb(double lb)
+{
+    setBounds(lb, ub_);
+}
+
+void BufferedVariable::setUb(double ub)
+{
+    setBounds(lb_, ub);
+}
+
+void BufferedVariable::setBounds(double lb, double ub)
+{
+    lb_ = lb;
+    ub_ = ub;
+    if (target_)
+    {
+        owner_.defer([target = target_, lb, ub] { target->setBounds(lb, ub); });
+    }
+}
+
+double BufferedVariable::getLb() const
+{
+    return lb_;
+}
+
+double BufferedVariable::getUb() const
+{
+    return ub_;
+}
+
+bool BufferedVariable::isInteger() const
+{
+    return integer_;
+}
+
+const std::string& BufferedVariable::getName() const
+{
+    return name_;
+}
+
+IMipVariable* BufferedVariable::target() const
+{
+    return target_;
+}
+
+BufferedConstraint::BufferedConstraint(BufferedLinearProblem& owner,
+                                       double lb,
+                                       double ub,
+                                       std::string name):
+    owner_(owner),
+    lb_(lb),
+    ub_(ub),
+    name_(std::move(name))
+{
+}
+
+void BufferedConstraint::setLb(double lb)
+{
+    setBounds(lb, ub_);
+}
+
+void BufferedConstraint::setUb(double ub)
+{
+    setBounds(lb_, ub);
+}
+
+void BufferedConstraint::setBounds(double lb, double ub)
+{
+    lb_ = lb;
+    ub_ = ub;
+    if (target_)
+    {
+        owner_.defer([target = target_, lb, ub] { target->setBounds(lb, ub); });
+    }
+}
+
+double BufferedConstraint::getLb() const
+{
+    return lb_;
+}
+
+double BufferedConstraint::getUb() const
+{
+    return ub_;
+}
+
+const std::string& BufferedConstraint::getName() const
+{
+    return name_;
+}
+
+void BufferedConstraint::setCoefficient(IMipVariable* var, double coefficient)
+{
+    if (owner_.closed_)
+    {
+        target_->setCoefficient(resolve<BufferedVariable>(var), coefficient);
+        return;
+    }
+    auto& blocks = owner_.coefficients_;
+    // Single coefficients are gathered in a block with one variable and one coefficient per row
+    if (blocks.empty() || blocks.back().variables.size() != blocks.back().constraints.size()
+        || blocks.back().coefficients.size() != blocks.back().constraints.size())
+    {
+        blocks.emplace_back();
+    }
+    blocks.back().constraints.push_back(this);
+    blocks.back().variables.push_back(var);
+    blocks.back().coefficients.push_back(coefficient);
+}
+
+double BufferedConstraint::getCoefficient(IMipVariable* var)
+{
+    if (auto coefficient = owner_.pendingCoefficient(this, var))
+    {
+        return *coefficient;
+    }
+    auto* targetVar = resolve<BufferedVariable>(var);
+    return target_ && targetVar ? target_->getCoefficient(targetVar) : 0.;
+}
+
+IMipConstraint* BufferedConstraint::target() const
+{
+    return target_;
+}
+
+BufferedLinearProblem::BufferedLinearProblem(ILinearProblem& target):
+    target_(target)
+{
+}
+
+IMipVariable* BufferedLinearProblem::addNumVariable(double lb, double ub, const std::string& name)
+{
+    return addVariable(lb, ub, false, name);
+}
+
+std::vector<IMipVariable*> BufferedLinearProblem::addNumVariable(double lb,
+                                                                 double ub,
+                                                                 const std::string& name,
+                                                                 unsigned int number_new_variables)
+{
+    return addVariable(lb, ub, false, name, number_new_variables);
+}
+
+IMipVariable* BufferedLinearProblem::addIntVariable(double lb, double ub, const std::string& name)
+{
+    return addVariable(lb, ub, true, name);
+}
+
+std::vector<IMipVariable*> BufferedLinearProblem::addIntVariable(double lb,
+                                                                 double ub,
+                                                                 const std::string& name,
+                                                                 unsigned int number_new_variables)
+{
+    return addVariable(lb, ub, true, name, number_new_variables);
+}
+
+IMipVariable* BufferedLinearProblem::addVariable(double lb,
+                                                 double ub,
+                                                 bool integer,
+                                                 const std::string& name)
+{
+    auto& variable = variables_.emplace_back(
+      std::make_unique<BufferedVariable>(*this, lb, ub, integer, name));
+    variablesByName_.try_emplace(name, variable.get());
+    return variable.get();
+}
+
+std::vector<IMipVariable*> BufferedLinearProblem::addVariable(double lb,
+                                                              double ub,
+                                                              bool integer,
+                                                              const std::string& name,
+                                                              unsigned int number_new_variables)
+{
+    std::vector<IMipVariable*> new_variables;
+    new_variables.reserve(number_new_variables);
+    for (unsigned int i = 0; i < number_new_variables; i++)
+    {
+        new_variables.push_back(addVariable(lb, ub, integer, name + '_' + std::to_string(i)));
+    }
+    return new_variables;
+}
+
+IMipVariable* BufferedLinearProblem::getVariable(const std::string& name) const
+{
+    if (auto it = variablesByName_.find(name); it != variablesByName_.end())
+    {
+        return it->second;
+    }
+    return target_.getVariable(name);
+}
+
+int BufferedLinearProblem::variableCount() const
+{
+    return target_.variableCount() + static_cast<int>(variables_.size() - flushedVariables_);
+}
+
+IMipConstraint* BufferedLinearProblem::addConstraint(double lb, double ub, const std::string& name)
+{
+    auto& constraint = constraints_.emplace_back(
+      std::make_unique<BufferedConstraint>(*this, lb, ub, name));
+    constraintsByName_.try_emplace(name, constraint.get());
+    return constraint.get();
+}
+
+std::vector<IMipConstraint*> BufferedLinearProblem::addConstraint(
+  double lb,
+  double ub,
+  const std::string& name,
+  unsigned int number_new_constraints)
+{
+    std::vector<IMipConstraint*> new_constraints;
+    new_constraints.reserve(number_new_constraints);
+    for (unsigned int i = 0; i < number_new_constraints; i++)
+    {
+        new_constraints.push_back(addConstraint(lb, ub, name + '_' + std::to_string(i)));
+    }
+    return new_constraints;
+}
+
+IMipConstraint* BufferedLinearProblem::getConstraint(const std::string& name) const
+{
+    if (auto it = constraintsByName_.find(name); it != constraintsByName_.end())
+    {
+        return it->second;
+    }
+    return target_.getConstraint(name);
+}
+
+int BufferedLinearProblem::constraintCount() const
+{
+    return target_.constraintCount()
+           + static_cast<int>(constraints_.size() - flushedConstraints_);
+}
+
+void BufferedLinearProblem::setCoefficients(const std::vector<IMipConstraint*>& constraints,
+                                            const std::vector<IMipVariable*>& variables,
+                                            const std::vector<double>& coefficients)
+{
+    coefficients_.push_back({constraints, variables, coefficients});
+    if (closed_)
+    {
+        flush();
+    }
+}
+
+void BufferedLinearProblem::setObjectiveCoefficient(IMipVariable* var, double coefficient)
+{
+    if (closed_)
+    {
+        target_.setObjectiveCoefficient(resolve<BufferedVariable>(var), coefficient);
+        return;
+    }
+    objectiveVariables_.push_back(var);
+    objectiveCoefficients_.push_back(coefficient);
+}
+
+double BufferedLinearProblem::getObjectiveCoefficient(const IMipVariable* var) const
+{
+    for (std::size_t i = objectiveVariables_.size(); i-- > 0;)
+    {
+        if (objectiveVariables_[i] == var)
+        {
+            return objectiveCoefficients_[i];
+        }
+    }
+    const auto* targetVar = resolve<const BufferedVariable>(var);
+    return targetVar ? target_.getObjectiveCoefficient(targetVar) : 0.;
+}
+
+void BufferedLinearProblem::setObjectiveCoefficients(const std::vector<IMipVariable*>& variables,
+                                                     const std::vector<double>& coefficients)
+{
+    if (coefficients.size() != variables.size() && coefficients.size() != 1)
+    {
+        throw std::invalid_argument("Invalid number of coefficients in block");
+    }
+    for (std::size_t i = 0; i < variables.size(); ++i)
+    {
+        setObjectiveCoefficient(variables[i],
+                                coefficients.size() == 1 ? coefficients[0] : coefficients[i]);
+    }
+}
+
+void BufferedLinearProblem::setMinimization()
+{
+    defer([this] { target_.setMinimization(); });
+}
+
+void BufferedLinearProblem::setMaximization()
+{
+    defer([this] { target_.setMaximization(); });
+}
+
+bool BufferedLinearProblem::isMinimization() const
+{
+    return target_.isMinimization();
+}
+
+bool BufferedLinearProblem::isMaximization() const
+{
+    return target_.isMaximization();
+}
+
+IMipSolution* BufferedLinearProblem::solve([[maybe_unused]] bool verboseSolver)
+{
+    throw std::logic_error("A buffered linear problem cannot be solved");
+}
+
+void BufferedLinearProblem::WriteLP([[maybe_unused]] const std::string& filename)
+{
+    throw std::logic_error("A buffered linear problem cannot be written");
+}
+
+double BufferedLinearProblem::infinity() const
+{
+    return target_.infinity();
+}
+
+void BufferedLinearProblem::defer(std::function<void()> modification)
+{
+    if (closed_)
+    {
+        modification();
+        return;
+    }
+    modifications_.push_back(std::move(modification));
+}
+
+std::optional<double> BufferedLinearProblem::pendingCoefficient(const IMipConstraint* constraint,
+                                                                const IMipVariable* var) const
+{
+    for (auto block = coefficients_.rbegin(); block != coefficients_.rend(); ++block)
+    {
+        for (std::size_t i = block->constraints.size(); i-- > 0;)
+        {
+            const auto* rowVar = block->variables.size() == 1 ? block->variables[0]
+                                                               : block->variables[i];
+            if (block->constraints[i] == constraint && rowVar == var)
+            {
+                return block->coefficients.size() == 1 ? block->coefficients[0]
+                                                       : block->coefficients[i];
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+void BufferedLinearProblem::flush()
+{
+    for (auto i = flushedVariables_; i < variables_.size(); ++i)
+    {
+        auto& variable = *variables_[i];
+        variable.target_ = target_.addVariable(variable.lb_,
+                                               variable.ub_,
+                                               variable.integer_,
+                                               variable.name_);
+    }
+    flushedVariables_ = variables_.size();
+    variablesByName_.clear();
+
+    for (auto i = flushedConstraints_; i < constraints_.size(); ++i)
+    {
+        auto& constraint = *constraints_[i];
+        constraint.target_ = target_.addConstraint(constraint.lb_,
+                                                   constraint.ub_,
+                                                   constraint.name_);
+    }
+    flushedConstraints_ = constraints_.size();
+    constraintsByName_.clear();
+
+    for (auto& block: coefficients_)
+    {
+        for (auto& constraint: block.constraints)
+        {
+            constraint = resolve<BufferedConstraint>(constraint);
+        }
+        for (auto& variable: block.variables)
+        {
+            variable = resolve<BufferedVariable>(variable);
+        }
+        target_.setCoefficients(block.constraints, block.variables, block.coefficients);
+    }
+    coefficients_.clear();
+
+    for (auto& variable: objectiveVariables_)
+    {
+        variable = resolve<BufferedVariable>(variable);
+    }
+    target_.setObjectiveCoefficients(objectiveVariables_, objectiveCoefficients_);
+    objectiveVariables_.clear();
+    objectiveCoefficients_.clear();
+
+    for (const auto& modification: modifications_)
+    {
+        modification();
+    }
+    modifications_.clear();
+}
+
+void BufferedLinearProblem::close()
+{
+    flush();
+    closed_ = true;
+}
+
+} // namespace Antares::Optimisation::LinearProblemApi
@@ -1,13 +1,64 @@
 
 #pragma once
 
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace Antares::Optimisation::LinearProblemApi
 {
 
+/**
+ * Data series resolved for a scenario group once, so that values are then read without lookup.
+ * The series are stored column by column : the one of rank r is values[r * height, (r + 1) *
+ * height). A handle is valid as long as the data it comes from is not modified.
+ */
+class DataHandle
+{
+public:
+    DataHandle() = default;
+
+    DataHandle(std::span<const double> values, unsigned height, std::vector<int> rankOfScenario):
+        values_(values),
+        height_(height),
+        rankOfScenario_(std::move(rankOfScenario))
+    {
+    }
+
+    /// Values of the scenario over time
+    std::span<const double> series(unsigned scenario) const
+    {
+        if (scenario >= rankOfScenario_.size() || rankOfScenario_[scenario] < 0)
+        {
+            throw std::out_of_range("Scenario " + std::to_string(scenario)
+                                    + " is not in the scenario group");
+        }
+        return values_.subspan(static_cast<std::size_t>(rankOfScenario_[scenario]) * height_,
+                               height_);
+    }
+
+    double get(unsigned scenario, unsigned hour) const
+    {
+        return series(scenario)[hour];
+    }
+
+private:
+    std::span<const double> values_;
+    unsigned height_ = 0;
+    // -1 for scenarios out of the group
+    std::vector<int> rankOfScenario_;
+};
+
 class ILinearProblemData
 {
+public:
+    virtual ~ILinearProblemData() = default;
+
+    virtual DataHandle getHandle(const std::string& dataSetId, const std::string& scenarioGroup)
+      = 0;
+
+private:
     virtual double getData(const std::string& dataSetId,
                            const std::string& scenarioGroup,
                            const unsigned scenario,
@@ -0,0 +1,209 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "linearProblem.h"
+
+namespace Antares::Optimisation::LinearProblemApi
+{
+
+class BufferedLinearProblem;
+
+/// Variable recorded by a BufferedLinearProblem, bound to the target variable once flushed
+class BufferedVariable final: public IMipVariable
+{
+public:
+    BufferedVariable(BufferedLinearProblem& owner,
+                     double lb,
+                     double ub,
+                     bool integer,
+                     std::string name);
+
+    void setLb(double lb) override;
+    void setUb(double ub) override;
+    void setBounds(double lb, double ub) override;
+
+    double getLb() const override;
+    double getUb() const override;
+    bool isInteger() const override;
+    const std::string& getName() const override;
+
+    /// Variable of the target problem, null until flushed
+    IMipVariable* target() const;
+
+private:
+    friend class BufferedLinearProblem;
+
+    BufferedLinearProblem& owner_;
+    double lb_;
+    double ub_;
+    bool integer_;
+    std::string name_;
+    IMipVariable* target_ = nullptr;
+};
+
+/// Constraint recorded by a BufferedLinearProblem, bound to the target constraint once flushed
+class BufferedConstraint final: public IMipConstraint
+{
+public:
+    BufferedConstraint(BufferedLinearProblem& owner, double lb, double ub, std::string name);
+
+    void setLb(double lb) override;
+    void setUb(double ub) override;
+    void setBounds(double lb, double ub) override;
+
+    double getLb() const override;
+    double getUb() const override;
+    const std::string& getName() const override;
+
+    void setCoefficient(IMipVariable* var, double coefficient) override;
+    double getCoefficient(IMipVariable* var) override;
+
+    /// Constraint of the target problem, null until flushed
+    IMipConstraint* target() const;
+
+private:
+    friend class BufferedLinearProblem;
+
+    BufferedLinearProblem& owner_;
+    double lb_;
+    double ub_;
+    std::string name_;
+    IMipConstraint* target_ = nullptr;
+};
+
+/**
+ * Linear problem recording what a filler adds, to push it later into a target problem
+ *
+ * Several fillers can then work concurrently, each one in its own buffer, the buffers being
+ * flushed one after the other into the target. Elements already in the target can be looked up
+ * (getVariable, getConstraint, ...) while filling : the target must not be modified meanwhile.
+ * Elements created by the buffer live as long as the buffer, and refer to the target ones once
+ * flushed. After close(), their modifications, and the coefficients set through the buffer, are
+ * applied directly to the target.
+ * The buffer can neither be solved nor written.
+ */
+class BufferedLinearProblem final: public ILinearProblem
+{
+public:
+    explicit BufferedLinearProblem(ILinearProblem& target);
+
+    IMipVariable* addNumVariable(double lb, double ub, const std::string& name) override;
+    std::vector<IMipVariable*> addNumVariable(double lb,
+                                              double ub,
+                                              const std::string& name,
+                                              unsigned int number_new_variables) override;
+    IMipVariable* addIntVariable(double lb, double ub, const std::string& name) override;
+    std::vector<IMipVariable*> addIntVariable(double lb,
+                                              double ub,
+                                              const std::string& name,
+                                              unsigned int number_new_variables) override;
+    IMipVariable* addVariable(double lb, double ub, bool integer, const std::string& name) override;
+    std::vector<IMipVariable*> addVariable(double lb,
+                                           double ub,
+                                           bool integer,
+                                           const std::string& name,
+                                           unsigned int number_new_variables) override;
+
+    IMipVariable* getVariable(const std::string& name) const override;
+    int variableCount() const override;
+
+    IMipConstraint* addConstraint(double lb, double ub, const std::string& name) override;
+    std::vector<IMipConstraint*> addConstraint(double lb,
+                                               double ub,
+                                               const std::string& name,
+                                               unsigned int number_new_constraints) override;
+
+    IMipConstraint* getConstraint(const std::string& name) const override;
+    int constraintCount() const override;
+
+    void setCoefficients(const std::vector<IMipConstraint*>& constraints,
+                         const std::vector<IMipVariable*>& variables,
+                         const std::vector<double>& coefficients) override;
+
+    void setObjectiveCoefficient(IMipVariable* var, double coefficient) override;
+    double getObjectiveCoefficient(const IMipVariable* var) const override;
+    void setObjectiveCoefficients(const std::vector<IMipVariable*>& variables,
+                                  const std::vector<double>& coefficients) override;
+
+    void setMinimization() override;
+    void setMaximization() override;
+
+    bool isMinimization() const override;
+    bool isMaximization() const override;
+
+    IMipSolution* solve(bool verboseSolver) override;
+    void WriteLP(const std::string& filename) override;
+
+    double infinity() const override;
+
+    /// Push the elements recorded since the last flush into the target, in the order they were
+    /// recorded : variables, then constraints, then coefficients, then other modifications
+    void flush();
+
+    /// Flush, then apply any further modification directly to the target
+    void close();
+
+private:
+    friend class BufferedVariable;
+    friend class BufferedConstraint;
+
+    /// Rows (constraint, variable, coefficient) given together to the target
+    struct CoefficientBlock
+    {
+        std::vector<IMipConstraint*> constraints;
+        std::vector<IMipVariable*> variables;
+        std::vector<double> coefficients;
+    };
+
+    /// Modification of an element already flushed, applied at next flush
+    void defer(std::function<void()> modification);
+
+    /// Last coefficient recorded for var in constraint, if any
+    std::optional<double> pendingCoefficient(const IMipConstraint* constraint,
+                                             const IMipVariable* var) const;
+
+    ILinearProblem& target_;
+
+    std::vector<std::unique_ptr<BufferedVariable>> variables_;
+    std::vector<std::unique_ptr<BufferedConstraint>> constraints_;
+    std::unordered_map<std::string, BufferedVariable*> variablesByName_;
+    std::unordered_map<std::string, BufferedConstraint*> constraintsByName_;
+
+    // Recorded since the last flush
+    std::size_t flushedVariables_ = 0;
+    std::size_t flushedConstraints_ = 0;
+    std::vector<CoefficientBlock> coefficients_;
+    std::vector<IMipVariable*> objectiveVariables_;
+    std::vector<double> objectiveCoefficients_;
+    std::vector<std::function<void()>> modifications_;
+    bool closed_ = false;
+};
+
+} // namespace Antares::Optimisation::LinearProblemApi
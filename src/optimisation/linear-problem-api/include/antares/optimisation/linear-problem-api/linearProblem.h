@@ -23,6 +23,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include "mipConstraint.h"
 #include "mipSolution.h"
@@ -90,10 +91,24 @@ public:
     virtual IMipConstraint* getConstraint(const std::string& name) const = 0;
     virtual int constraintCount() const = 0;
 
+    /// Set the coefficients of a block of constraints, typically one constraint per timestep
+    /// The i-th constraint gets coefficients[i] for variables[i]. variables and coefficients hold
+    /// either one element per constraint, or a single element used for all constraints
+    virtual void setCoefficients(const std::vector<IMipConstraint*>& constraints,
+                                 const std::vector<IMipVariable*>& variables,
+                                 const std::vector<double>& coefficients)
+      = 0;
+
     /// Set the objective coefficient for a given variable
     virtual void setObjectiveCoefficient(IMipVariable* var, double coefficient) = 0;
     virtual double getObjectiveCoefficient(const IMipVariable* var) const = 0;
 
+    /// Set the objective coefficients of a range of variables
+    /// coefficients holds either one element per variable, or a single element for all variables
+    virtual void setObjectiveCoefficients(const std::vector<IMipVariable*>& variables,
+                                          const std::vector<double>& coefficients)
+      = 0;
+
     /// Sets the optimization direction to minimize
     virtual void setMinimization() = 0;
     /// Sets the optimization direction to maximize
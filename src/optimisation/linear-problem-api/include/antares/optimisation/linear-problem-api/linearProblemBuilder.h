@@ -21,21 +21,50 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
 #include <vector>
 
+#include "bufferedLinearProblem.h"
 #include "linearProblemFiller.h"
 
 namespace Antares::Optimisation::LinearProblemApi
 {
 
+/**
+ * Builds a linear problem with fillers : variables of all fillers, then constraints, then
+ * objective.
+ *
+ * With several threads, the fillers of a step run concurrently, each one in its own
+ * BufferedLinearProblem. The buffers are then pushed into the problem in the order of the fillers,
+ * so that the problem is the same as the one built serially. Fillers must then only read the data
+ * and the context, and must not modify elements created by other fillers. The elements they
+ * create are owned by the buffers, and stay valid as long as the builder.
+ */
 class LinearProblemBuilder
 {
 public:
-    explicit LinearProblemBuilder(const std::vector<LinearProblemFiller*>& fillers);
+    explicit LinearProblemBuilder(const std::vector<LinearProblemFiller*>& fillers,
+                                  unsigned nbThreads = 1);
     void build(ILinearProblem& pb, ILinearProblemData& data, FillContext& ctx);
+    /// Update a built problem for another time window of the same length
+    void update(ILinearProblem& pb, ILinearProblemData& data, FillContext& ctx);
+    /// Pass the boundary states from a window solution to the next window, see
+    /// LinearProblemFiller::carryOver
+    void carryOver(ILinearProblem& pb, const IMipSolution& solution, unsigned offset);
+    /// Change the value of a component parameter in a built problem, without building it again,
+    /// see LinearProblemFiller::setParameterValue. Throws if no filler has the component
+    void setParameterValue(ILinearProblem& pb,
+                           const std::string& componentId,
+                           const std::string& parameterId,
+                           double value);
 
 private:
+    void buildInParallel(ILinearProblem& pb, ILinearProblemData& data, FillContext& ctx);
+
     const std::vector<LinearProblemFiller*>& fillers_;
+    unsigned nbThreads_;
+    std::vector<std::unique_ptr<BufferedLinearProblem>> buffers_;
 };
 
 } // namespace Antares::Optimisation::LinearProblemApi
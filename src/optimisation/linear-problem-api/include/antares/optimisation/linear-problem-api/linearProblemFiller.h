@@ -22,10 +22,12 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <unordered_map>
 
 #include <antares/optimisation/linear-problem-api/ILinearProblemData.h>
 #include <antares/optimisation/linear-problem-api/linearProblem.h>
+#include <antares/optimisation/linear-problem-api/mipSolution.h>
 
 namespace Antares::Expressions::Visitors
 {
@@ -77,6 +79,30 @@ public:
     virtual void addVariables(ILinearProblem& pb, ILinearProblemData& data, FillContext& ctx) = 0;
     virtual void addConstraints(ILinearProblem& pb, ILinearProblemData& data, FillContext& ctx) = 0;
     virtual void addObjective(ILinearProblem& pb, ILinearProblemData& data, FillContext& ctx) = 0;
+
+    /// Update the data-dependent coefficients and bounds of the elements added for a previous
+    /// time window of the same length, so that they match the time window of ctx
+    virtual void update(ILinearProblem&, ILinearProblemData&, FillContext&)
+    {
+    }
+
+    /// Set the boundary states of the next time window (initial stock levels, ...) from the
+    /// solution of the previous one, in which the next window begins at time step offset
+    virtual void carryOver(ILinearProblem&, const IMipSolution&, unsigned /* offset */)
+    {
+    }
+
+    /// Change the value of a parameter of a component in the elements already added to the
+    /// problem : the bounds, coefficients and objective depending on it are evaluated again, the
+    /// other ones are left as they are. Returns false if the component is not one of the filler
+    virtual bool setParameterValue(ILinearProblem&,
+                                   const std::string& /* componentId */,
+                                   const std::string& /* parameterId */,
+                                   double /* value */)
+    {
+        return false;
+    }
+
     virtual ~LinearProblemFiller() = default;
 };
 
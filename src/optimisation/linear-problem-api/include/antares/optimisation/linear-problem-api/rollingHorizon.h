@@ -0,0 +1,77 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "linearProblemBuilder.h"
+#include "mipSolution.h"
+
+namespace Antares::Optimisation::LinearProblemApi
+{
+
+struct WindowStatistics
+{
+    unsigned firstTimeStep = 0;
+    unsigned lastTimeStep = 0;
+    /// Time steps of the window kept in the results, those before the next window
+    unsigned committedTimeSteps = 0;
+    /// Durations in seconds
+    double fillDuration = 0.;
+    double solveDuration = 0.;
+    MipStatus status = MipStatus::MIP_ERROR;
+    double objectiveValue = 0.;
+};
+
+/**
+ * Solves a horizon of time steps window after window, consecutive windows overlapping by a given
+ * number of time steps. All windows have the same length, the last one being moved back so as to
+ * end with the horizon.
+ *
+ * The problem is built once, for the first window. For the next ones, the fillers only update
+ * their data-dependent coefficients, and get the boundary states from the solution of the
+ * previous window. The run stops at the first window without solution.
+ */
+class RollingHorizon
+{
+public:
+    using SolutionHandler = std::function<void(const WindowStatistics&, const IMipSolution&)>;
+
+    RollingHorizon(LinearProblemBuilder& builder, unsigned windowLength, unsigned overlap);
+
+    std::vector<FillContext> windows(const FillContext& horizon) const;
+
+    /// onSolved is called for each window having a solution
+    std::vector<WindowStatistics> run(ILinearProblem& pb,
+                                      ILinearProblemData& data,
+                                      const FillContext& horizon,
+                                      bool verboseSolver,
+                                      const SolutionHandler& onSolved = {});
+
+private:
+    LinearProblemBuilder& builder_;
+    unsigned windowLength_;
+    unsigned overlap_;
+};
+
+} // namespace Antares::Optimisation::LinearProblemApi
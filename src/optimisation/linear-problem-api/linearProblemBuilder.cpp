@@ -20,19 +20,34 @@
  */
 
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <thread>
 
+#include <antares/optimisation/linear-problem-api/bufferedLinearProblem.h>
 #include <antares/optimisation/linear-problem-api/linearProblemBuilder.h>
 
 namespace Antares::Optimisation::LinearProblemApi
 {
 
-LinearProblemBuilder::LinearProblemBuilder(const std::vector<LinearProblemFiller*>& fillers):
-    fillers_(fillers)
+LinearProblemBuilder::LinearProblemBuilder(const std::vector<LinearProblemFiller*>& fillers,
+                                           unsigned nbThreads):
+    fillers_(fillers),
+    nbThreads_(nbThreads)
 {
 }
 
 void LinearProblemBuilder::build(ILinearProblem& pb, ILinearProblemData& data, FillContext& ctx)
 {
+    if (nbThreads_ > 1 && fillers_.size() > 1)
+    {
+        buildInParallel(pb, data, ctx);
+        return;
+    }
+    buffers_.clear();
+
     std::ranges::for_each(fillers_,
                           [&](const auto& filler) { filler->addVariables(pb, data, ctx); });
     std::ranges::for_each(fillers_,
@@ -41,4 +56,101 @@ void LinearProblemBuilder::build(ILinearProblem& pb, ILinearProblemData& data, F
                           [&](const auto& filler) { filler->addObjective(pb, data, ctx); });
 }
 
+void LinearProblemBuilder::update(ILinearProblem& pb, ILinearProblemData& data, FillContext& ctx)
+{
+    std::ranges::for_each(fillers_, [&](const auto& filler) { filler->update(pb, data, ctx); });
+}
+
+void LinearProblemBuilder::carryOver(ILinearProblem& pb,
+                                     const IMipSolution& solution,
+                                     unsigned offset)
+{
+    std::ranges::for_each(fillers_,
+                          [&](const auto& filler) { filler->carryOver(pb, solution, offset); });
+}
+
+void LinearProblemBuilder::setParameterValue(ILinearProblem& pb,
+                                             const std::string& componentId,
+                                             const std::string& parameterId,
+                                             double value)
+{
+    bool found = false;
+    for (std::size_t i = 0; i < fillers_.size(); ++i)
+    {
+        // Elements built in parallel are the ones of the buffers, which forward to pb once closed
+        auto& fillerPb = buffers_.empty() ? pb : static_cast<ILinearProblem&>(*buffers_[i]);
+        found = fillers_[i]->setParameterValue(fillerPb, componentId, parameterId, value) || found;
+    }
+    if (!found)
+    {
+        throw std::invalid_argument("Component '" + componentId + "' not found in the problem");
+    }
+}
+
+// Calls task(i) for i in [0, count) on nbThreads threads. The error of the lowest i, if any, is
+// rethrown once all tasks are over
+template<class Task>
+static void runInParallel(unsigned nbThreads, std::size_t count, Task task)
+{
+    std::atomic<std::size_t> next = 0;
+    std::vector<std::exception_ptr> errors(count);
+    {
+        std::vector<std::jthread> threads;
+        for (std::size_t t = 0; t < std::min<std::size_t>(nbThreads, count); ++t)
+        {
+            threads.emplace_back(
+              [&]
+              {
+                  for (std::size_t i = next++; i < count; i = next++)
+                  {
+                      try
+                      {
+                          task(i);
+                      }
+                      catch (...)
+                      {
+                          errors[i] = std::current_exception();
+                      }
+                  }
+              });
+        }
+    }
+    for (const auto& error: errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+void LinearProblemBuilder::buildInParallel(ILinearProblem& pb,
+                                           ILinearProblemData& data,
+                                           FillContext& ctx)
+{
+    buffers_.clear();
+    buffers_.reserve(fillers_.size());
+    for (std::size_t i = 0; i < fillers_.size(); ++i)
+    {
+        buffers_.push_back(std::make_unique<BufferedLinearProblem>(pb));
+    }
+
+    // Each step only starts once the previous one is in pb, where fillers may look it up
+    auto step = [this](auto fill)
+    {
+        runInParallel(nbThreads_,
+                      fillers_.size(),
+                      [&](std::size_t i) { fill(*fillers_[i], *buffers_[i]); });
+        std::ranges::for_each(buffers_, [](const auto& buffer) { buffer->flush(); });
+    };
+
+    step([&](LinearProblemFiller& filler, BufferedLinearProblem& buffer)
+         { filler.addVariables(buffer, data, ctx); });
+    step([&](LinearProblemFiller& filler, BufferedLinearProblem& buffer)
+         { filler.addConstraints(buffer, data, ctx); });
+    step([&](LinearProblemFiller& filler, BufferedLinearProblem& buffer)
+         { filler.addObjective(buffer, data, ctx); });
+    std::ranges::for_each(buffers_, [](const auto& buffer) { buffer->close(); });
+}
+
 } // namespace Antares::Optimisation::LinearProblemApi
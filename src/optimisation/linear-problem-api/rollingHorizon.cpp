@@ -0,0 +1,126 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#include <chrono>
+#include <stdexcept>
+#include <string>
+
+#include <antares/optimisation/linear-problem-api/rollingHorizon.h>
+
+namespace Antares::Optimisation::LinearProblemApi
+{
+
+RollingHorizon::RollingHorizon(LinearProblemBuilder& builder,
+                               unsigned windowLength,
+                               unsigned overlap):
+    builder_(builder),
+    windowLength_(windowLength),
+    overlap_(overlap)
+{
+    if (overlap_ >= windowLength_)
+    {
+        throw std::invalid_argument("Rolling horizon: the overlap (" + std::to_string(overlap_)
+                                    + ") must be smaller than the window length ("
+                                    + std::to_string(windowLength_) + ")");
+    }
+}
+
+std::vector<FillContext> RollingHorizon::windows(const FillContext& horizon) const
+{
+    const unsigned first = horizon.getFirstTimeStep();
+    const unsigned last = horizon.getLastTimeStep();
+    std::vector<FillContext> windows;
+    if (horizon.getNumberOfTimestep() <= windowLength_)
+    {
+        windows.push_back(horizon);
+        return windows;
+    }
+
+    const unsigned stride = windowLength_ - overlap_;
+    for (unsigned start = first; start + windowLength_ - 1 < last; start += stride)
+    {
+        windows.emplace_back(start, start + windowLength_ - 1);
+    }
+    windows.emplace_back(last - windowLength_ + 1, last);
+    for (auto& window: windows)
+    {
+        window.scenariosSelected = horizon.scenariosSelected;
+    }
+    return windows;
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::vector<WindowStatistics> RollingHorizon::run(ILinearProblem& pb,
+                                                  ILinearProblemData& data,
+                                                  const FillContext& horizon,
+                                                  bool verboseSolver,
+                                                  const SolutionHandler& onSolved)
+{
+    auto windows = this->windows(horizon);
+    std::vector<WindowStatistics> statistics;
+    for (std::size_t w = 0; w < windows.size(); ++w)
+    {
+        auto& window = windows[w];
+        WindowStatistics& stats = statistics.emplace_back();
+        stats.firstTimeStep = window.getFirstTimeStep();
+        stats.lastTimeStep = window.getLastTimeStep();
+        const bool isLast = w + 1 == windows.size();
+        const unsigned offset = isLast ? window.getNumberOfTimestep()
+                                       : windows[w + 1].getFirstTimeStep() - stats.firstTimeStep;
+        stats.committedTimeSteps = offset;
+
+        auto start = std::chrono::steady_clock::now();
+        if (w == 0)
+        {
+            builder_.build(pb, data, window);
+        }
+        else
+        {
+            builder_.update(pb, data, window);
+        }
+        stats.fillDuration = secondsSince(start);
+
+        start = std::chrono::steady_clock::now();
+        const auto* solution = pb.solve(verboseSolver);
+        stats.solveDuration = secondsSince(start);
+        stats.status = solution->getStatus();
+        if (stats.status != MipStatus::OPTIMAL && stats.status != MipStatus::FEASIBLE)
+        {
+            break;
+        }
+        stats.objectiveValue = solution->getObjectiveValue();
+        if (onSolved)
+        {
+            onSolved(stats, *solution);
+        }
+        if (!isLast)
+        {
+            builder_.carryOver(pb, *solution, offset);
+        }
+    }
+    return statistics;
+}
+
+} // namespace Antares::Optimisation::LinearProblemApi
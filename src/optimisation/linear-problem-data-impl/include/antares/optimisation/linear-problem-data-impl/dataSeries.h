@@ -1,6 +1,7 @@
 
 #pragma once
 
+#include <span>
 #include <string>
 
 namespace Antares::Optimisation::LinearProblemDataImpl
@@ -14,8 +15,14 @@ public:
     {
     }
 
+    virtual ~IDataSeries() = default;
+
     virtual double getData(unsigned int rank, unsigned int hour) = 0;
 
+    /// All the series, one after the other : see LinearProblemApi::DataHandle
+    virtual std::span<const double> values() const = 0;
+    virtual unsigned height() const = 0;
+
     std::string name() const
     {
         return name_;
@@ -38,6 +38,8 @@ public:
                    const std::string& scenarioGroup,
                    const unsigned scenario,
                    const unsigned hour) override;
+    LinearProblemApi::DataHandle getHandle(const std::string& dataSetId,
+                                           const std::string& scenarioGroup) override;
 
     void addScenarioGroup(const std::string& groupId, std::pair<unsigned, unsigned> scenarioToRank);
     void addDataSeries(std::unique_ptr<IDataSeries> dataSeries);
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#include "dataSeries.h"
+#include "mappedFile.h"
+
+namespace Antares::Optimisation::LinearProblemDataImpl
+{
+
+/**
+ * Time series set read in place from a binary file mapped in memory. The file has the layout of
+ * the binary matrices (see Matrix::saveToBinaryBuffer) : a header, then the series of doubles,
+ * one after the other.
+ */
+class MappedTimeSeriesSet: public IDataSeries
+{
+public:
+    MappedTimeSeriesSet(std::string name, const std::filesystem::path& path);
+
+    double getData(unsigned rank, unsigned hour) override;
+    std::span<const double> values() const override;
+    unsigned height() const override;
+
+private:
+    MappedFile file_;
+    unsigned width_ = 0;
+    unsigned height_ = 0;
+    std::span<const double> values_;
+
+public:
+    class InvalidFile: public std::invalid_argument
+    {
+    public:
+        explicit InvalidFile(const std::string& name, const std::filesystem::path& path);
+    };
+};
+
+} // namespace Antares::Optimisation::LinearProblemDataImpl
@@ -13,15 +13,17 @@ public:
                                     const std::pair<unsigned, unsigned> scenarioToRank);
 
     unsigned getDataRank(const std::string& groupId, const unsigned scenario);
+    // Rank of the data per scenario
+    const std::map<unsigned, unsigned>& getGroup(const std::string& groupId) const;
 
 private:
     std::map<std::string, std::map<unsigned, unsigned>> scenarioGroups_;
 
 public:
-    class AlreadyExists: public std::invalid_argument
+    class ScenarioAlreadyExists: public std::invalid_argument
     {
     public:
-        explicit AlreadyExists(const std::string& groupId);
+        explicit ScenarioAlreadyExists(const std::string& groupId, unsigned scenario);
     };
 
     class DoesNotExist: public std::invalid_argument
@@ -12,10 +12,14 @@ public:
     explicit TimeSeriesSet(std::string name, unsigned height);
     void add(const std::vector<double>& ts);
     double getData(unsigned rank, unsigned hour) override;
+    std::span<const double> values() const override;
+    unsigned height() const override;
 
 private:
     unsigned height_ = 0;
-    std::vector<std::vector<double>> tsSet_;
+    unsigned width_ = 0;
+    // Column-major
+    std::vector<double> values_;
 
 public:
     class AddTSofWrongSize: public std::invalid_argument
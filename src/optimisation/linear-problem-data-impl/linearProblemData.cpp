@@ -21,6 +21,8 @@
 
 #include "antares/optimisation/linear-problem-data-impl/linearProblemData.h"
 
+#include "antares/optimisation/linear-problem-data-impl/timeSeriesSet.h"
+
 namespace Antares::Optimisation::LinearProblemDataImpl
 {
 
@@ -44,4 +46,28 @@ double LinearProblemData::getData(const std::string& dataSetId,
     return dataSeriesRepository_.getDataSeries(dataSetId).getData(rank, hour);
 }
 
+LinearProblemApi::DataHandle LinearProblemData::getHandle(const std::string& dataSetId,
+                                                          const std::string& scenarioGroup)
+{
+    const auto& dataSeries = dataSeriesRepository_.getDataSeries(dataSetId);
+    const auto values = dataSeries.values();
+    const unsigned height = dataSeries.height();
+    const std::size_t width = height == 0 ? 0 : values.size() / height;
+
+    std::vector<int> rankOfScenario;
+    for (const auto& [scenario, rank]: groupRepository_.getGroup(scenarioGroup))
+    {
+        if (rank >= width)
+        {
+            throw TimeSeriesSet::RankTooBig(dataSetId, rank);
+        }
+        if (scenario >= rankOfScenario.size())
+        {
+            rankOfScenario.resize(scenario + 1, -1);
+        }
+        rankOfScenario[scenario] = static_cast<int>(rank);
+    }
+    return {values, height, std::move(rankOfScenario)};
+}
+
 } // namespace Antares::Optimisation::LinearProblemDataImpl
@@ -0,0 +1,147 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#include "antares/optimisation/linear-problem-data-impl/mappedFile.h"
+
+#include <stdexcept>
+#include <string>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Antares::Optimisation::LinearProblemDataImpl
+{
+
+static std::runtime_error mappingError(const std::filesystem::path& path)
+{
+    return std::runtime_error("File '" + path.string() + "' cannot be mapped in memory");
+}
+
+#ifdef _WIN32
+MappedFile::MappedFile(const std::filesystem::path& path)
+{
+    file_ = CreateFileW(path.c_str(),
+                        GENERIC_READ,
+                        FILE_SHARE_READ,
+                        nullptr,
+                        OPEN_EXISTING,
+                        FILE_ATTRIBUTE_NORMAL,
+                        nullptr);
+    if (file_ == INVALID_HANDLE_VALUE)
+    {
+        throw mappingError(path);
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file_, &size))
+    {
+        CloseHandle(file_);
+        throw mappingError(path);
+    }
+    size_ = static_cast<std::size_t>(size.QuadPart);
+    if (size_ == 0)
+    {
+        // Empty files cannot be mapped
+        return;
+    }
+
+    mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping_)
+    {
+        CloseHandle(file_);
+        throw mappingError(path);
+    }
+    data_ = static_cast<const std::byte*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+    if (!data_)
+    {
+        CloseHandle(mapping_);
+        CloseHandle(file_);
+        throw mappingError(path);
+    }
+}
+
+MappedFile::~MappedFile()
+{
+    if (data_)
+    {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_)
+    {
+        CloseHandle(mapping_);
+    }
+    CloseHandle(file_);
+}
+#else
+MappedFile::MappedFile(const std::filesystem::path& path)
+{
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw mappingError(path);
+    }
+
+    struct stat status;
+    if (fstat(fd, &status) != 0)
+    {
+        close(fd);
+        throw mappingError(path);
+    }
+    size_ = static_cast<std::size_t>(status.st_size);
+    if (size_ == 0)
+    {
+        // Empty files cannot be mapped
+        close(fd);
+        return;
+    }
+
+    void* address = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping stays valid once the file is closed
+    close(fd);
+    if (address == MAP_FAILED)
+    {
+        throw mappingError(path);
+    }
+    data_ = static_cast<const std::byte*>(address);
+}
+
+MappedFile::~MappedFile()
+{
+    if (data_)
+    {
+        munmap(const_cast<std::byte*>(data_), size_);
+    }
+}
+#endif
+
+std::span<const std::byte> MappedFile::data() const
+{
+    return {data_, size_};
+}
+
+} // namespace Antares::Optimisation::LinearProblemDataImpl
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#include "antares/optimisation/linear-problem-data-impl/mappedTimeSeriesSet.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "antares/optimisation/linear-problem-data-impl/timeSeriesSet.h"
+
+namespace Antares::Optimisation::LinearProblemDataImpl
+{
+
+namespace
+{
+// Same layout as Matrix::saveToBinaryBuffer
+constexpr char magic[8] = {'A', 'N', 'T', 'S', 'M', 'T', 'X', '1'};
+
+struct Header
+{
+    uint32_t width;
+    uint32_t height;
+    uint32_t precision;
+    uint32_t sizeOfValue;
+};
+
+constexpr std::size_t valuesOffset = sizeof(magic) + sizeof(Header);
+static_assert(valuesOffset % alignof(double) == 0);
+} // namespace
+
+MappedTimeSeriesSet::MappedTimeSeriesSet(std::string name, const std::filesystem::path& path):
+    IDataSeries(std::move(name)),
+    file_(path)
+{
+    const auto data = file_.data();
+    Header header;
+    if (data.size() < valuesOffset || std::memcmp(data.data(), magic, sizeof(magic)) != 0)
+    {
+        throw InvalidFile(this->name(), path);
+    }
+    std::memcpy(&header, data.data() + sizeof(magic), sizeof(Header));
+    // The dimensions are read from the file : the size they give must not overflow
+    if (header.width != 0
+        && header.height > (SIZE_MAX - valuesOffset) / sizeof(double) / header.width)
+    {
+        throw InvalidFile(this->name(), path);
+    }
+    const std::size_t count = static_cast<std::size_t>(header.width) * header.height;
+    if (header.sizeOfValue != sizeof(double)
+        || data.size() != valuesOffset + count * sizeof(double))
+    {
+        throw InvalidFile(this->name(), path);
+    }
+
+    width_ = header.width;
+    height_ = header.height;
+    // Mappings are aligned on pages
+    values_ = {reinterpret_cast<const double*>(data.data() + valuesOffset), count};
+}
+
+double MappedTimeSeriesSet::getData(unsigned rank, unsigned hour)
+{
+    if (width_ == 0)
+    {
+        throw TimeSeriesSet::Empty(name());
+    }
+
+    if (rank > width_ - 1)
+    {
+        throw TimeSeriesSet::RankTooBig(name(), rank);
+    }
+
+    if (hour > height_ - 1)
+    {
+        throw TimeSeriesSet::HourTooBig(name(), hour);
+    }
+
+    return values_[static_cast<std::size_t>(rank) * height_ + hour];
+}
+
+std::span<const double> MappedTimeSeriesSet::values() const
+{
+    return values_;
+}
+
+unsigned MappedTimeSeriesSet::height() const
+{
+    return height_;
+}
+
+} // namespace Antares::Optimisation::LinearProblemDataImpl
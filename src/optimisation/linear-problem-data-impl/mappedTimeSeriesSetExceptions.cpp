@@ -0,0 +1,15 @@
+#include <string>
+
+#include "antares/optimisation/linear-problem-data-impl/mappedTimeSeriesSet.h"
+
+namespace Antares::Optimisation::LinearProblemDataImpl
+{
+
+MappedTimeSeriesSet::InvalidFile::InvalidFile(const std::string& name,
+                                              const std::filesystem::path& path):
+    std::invalid_argument("TS set '" + name + "' : '" + path.string()
+                          + "' is not a binary matrix of doubles")
+{
+}
+
+} // namespace Antares::Optimisation::LinearProblemDataImpl
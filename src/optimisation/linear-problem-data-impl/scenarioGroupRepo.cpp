@@ -8,11 +8,12 @@ void ScenarioGroupRepository::addPairScenarioRankToGroup(
   const std::string& groupId,
   const std::pair<unsigned, unsigned> scenarioToRank)
 {
-    if (scenarioGroups_.contains(groupId))
+    auto& group = scenarioGroups_[groupId];
+    if (group.contains(scenarioToRank.first))
     {
-        throw AlreadyExists(groupId);
+        throw ScenarioAlreadyExists(groupId, scenarioToRank.first);
     }
-    scenarioGroups_[groupId] = {scenarioToRank};
+    group.insert(scenarioToRank);
 }
 
 unsigned ScenarioGroupRepository::getDataRank(const std::string& groupId, const unsigned scenario)
@@ -29,4 +30,14 @@ unsigned ScenarioGroupRepository::getDataRank(const std::string& groupId, const
 
     return scenarioGroups_.at(groupId).at(scenario);
 }
+
+const std::map<unsigned, unsigned>& ScenarioGroupRepository::getGroup(
+  const std::string& groupId) const
+{
+    if (!scenarioGroups_.contains(groupId))
+    {
+        throw DoesNotExist(groupId);
+    }
+    return scenarioGroups_.at(groupId);
+}
 } // namespace Antares::Optimisation::LinearProblemDataImpl
@@ -5,8 +5,11 @@
 namespace Antares::Optimisation::LinearProblemDataImpl
 {
 
-ScenarioGroupRepository::AlreadyExists::AlreadyExists(const std::string& groupId):
-    std::invalid_argument("Scenario group '" + groupId + "' already exists in group repo.")
+ScenarioGroupRepository::ScenarioAlreadyExists::ScenarioAlreadyExists(
+  const std::string& groupId,
+  const unsigned scenario):
+    std::invalid_argument("In scenario group '" + groupId + "', scenario '"
+                          + std::to_string(scenario) + "' already exists.")
 {
 }
 
@@ -17,17 +17,18 @@ void TimeSeriesSet::add(const std::vector<double>& ts)
     {
         throw AddTSofWrongSize(name(), ts.size(), height_);
     }
-    tsSet_.push_back(std::move(ts));
+    values_.insert(values_.end(), ts.begin(), ts.end());
+    ++width_;
 }
 
 double TimeSeriesSet::getData(unsigned rank, unsigned hour)
 {
-    if (tsSet_.empty())
+    if (width_ == 0)
     {
         throw Empty(name());
     }
 
-    if (rank > tsSet_.size() - 1)
+    if (rank > width_ - 1)
     {
         throw RankTooBig(name(), rank);
     }
@@ -37,6 +38,16 @@ double TimeSeriesSet::getData(unsigned rank, unsigned hour)
         throw HourTooBig(name(), hour);
     }
 
-    return tsSet_[rank][hour];
+    return values_[static_cast<std::size_t>(rank) * height_ + hour];
+}
+
+std::span<const double> TimeSeriesSet::values() const
+{
+    return values_;
+}
+
+unsigned TimeSeriesSet::height() const
+{
+    return height_;
 }
 } // namespace Antares::Optimisation::LinearProblemDataImpl
@@ -21,6 +21,9 @@
 
 #pragma once
 
+#include <utility>
+#include <vector>
+
 #include <antares/optimisation/linear-problem-api/linearProblem.h>
 #include <antares/optimisation/linear-problem-mpsolver-impl/mipConstraint.h>
 #include <antares/optimisation/linear-problem-mpsolver-impl/mipSolution.h>
@@ -31,6 +34,7 @@ namespace operations_research
 class MPSolver;
 class MPSolverParameters;
 class MPObjective;
+class MPVariable;
 } // namespace operations_research
 
 namespace Antares::Optimisation::LinearProblemMpsolverImpl
@@ -84,9 +88,16 @@ public:
     OrtoolsMipConstraint* getConstraint(const std::string& name) const override;
     int constraintCount() const override;
 
+    void setCoefficients(const std::vector<LinearProblemApi::IMipConstraint*>& constraints,
+                         const std::vector<LinearProblemApi::IMipVariable*>& variables,
+                         const std::vector<double>& coefficients) override;
+
     void setObjectiveCoefficient(LinearProblemApi::IMipVariable* var, double coefficient) override;
     double getObjectiveCoefficient(const LinearProblemApi::IMipVariable* var) const override;
 
+    void setObjectiveCoefficients(const std::vector<LinearProblemApi::IMipVariable*>& variables,
+                                  const std::vector<double>& coefficients) override;
+
     void setMinimization() override;
     void setMaximization() override;
 
@@ -94,6 +105,12 @@ public:
     bool isMaximization() const override;
 
     OrtoolsMipSolution* solve(bool verboseSolver) override;
+
+    /// Start each solve from the solution of the previous one, so that a problem modified in
+    /// place (parameter values, bounds, ...) is solved again quickly. The solution is given as a
+    /// hint to MIP solvers, LP solvers keep their last basis as long as the problem is not built
+    /// again
+    void setWarmStart(bool warmStart);
     void WriteLP(const std::string& filename) override;
 
     double infinity() const override;
@@ -110,6 +127,10 @@ private:
     std::map<std::string, std::unique_ptr<OrtoolsMipConstraint>> constraints_;
 
     std::unique_ptr<OrtoolsMipSolution> solution_;
+
+    bool warmStart_ = false;
+    /// Values of the last feasible solution, kept for the next solve when warm starting
+    std::vector<std::pair<const operations_research::MPVariable*, double>> hint_;
 };
 
 } // namespace Antares::Optimisation::LinearProblemMpsolverImpl
@@ -47,6 +47,8 @@ public:
 
     const std::string& getName() const override;
 
+    operations_research::MPConstraint* getMpConstraint() const;
+
     ~OrtoolsMipConstraint() override = default;
 
     explicit OrtoolsMipConstraint(operations_research::MPConstraint* mpConstraint);
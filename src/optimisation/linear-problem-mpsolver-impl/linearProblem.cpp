@@ -200,6 +200,63 @@ void OrtoolsLinearProblem::setObjectiveCoefficient(LinearProblemApi::IMipVariabl
     objective_->SetCoefficient(getMpVar(var), coefficient);
 }
 
+// Elements of a block are either given one per row, or once for all rows
+static void checkBlockSize(std::size_t size, std::size_t rows, const std::string& what)
+{
+    if (size != rows && size != 1)
+    {
+        logs.error() << "Invalid number of " << what << ": " << size << " for " << rows
+                     << " rows";
+        throw std::invalid_argument("Invalid number of " + what + " in block");
+    }
+}
+
+void OrtoolsLinearProblem::setCoefficients(
+  const std::vector<LinearProblemApi::IMipConstraint*>& constraints,
+  const std::vector<LinearProblemApi::IMipVariable*>& variables,
+  const std::vector<double>& coefficients)
+{
+    if (constraints.empty())
+    {
+        return;
+    }
+    checkBlockSize(variables.size(), constraints.size(), "variables");
+    checkBlockSize(coefficients.size(), constraints.size(), "coefficients");
+
+    const auto* sharedVar = variables.size() == 1 ? getMpVar(variables[0]) : nullptr;
+    for (std::size_t i = 0; i < constraints.size(); ++i)
+    {
+        auto* constraint = dynamic_cast<OrtoolsMipConstraint*>(constraints[i]);
+        if (!constraint)
+        {
+            logs.error() << "Invalid cast, tried from LinearProblemApi::IMipConstraint to "
+                            "OrtoolsMipConstraint";
+            throw std::bad_cast();
+        }
+        constraint->getMpConstraint()->SetCoefficient(sharedVar ? sharedVar
+                                                                : getMpVar(variables[i]),
+                                                      coefficients.size() == 1 ? coefficients[0]
+                                                                               : coefficients[i]);
+    }
+}
+
+void OrtoolsLinearProblem::setObjectiveCoefficients(
+  const std::vector<LinearProblemApi::IMipVariable*>& variables,
+  const std::vector<double>& coefficients)
+{
+    if (variables.empty())
+    {
+        return;
+    }
+    checkBlockSize(coefficients.size(), variables.size(), "coefficients");
+
+    for (std::size_t i = 0; i < variables.size(); ++i)
+    {
+        objective_->SetCoefficient(getMpVar(variables[i]),
+                                   coefficients.size() == 1 ? coefficients[0] : coefficients[i]);
+    }
+}
+
 double OrtoolsLinearProblem::getObjectiveCoefficient(
   const LinearProblemApi::IMipVariable* var) const
 {
@@ -246,12 +303,37 @@ OrtoolsMipSolution* OrtoolsLinearProblem::solve(bool verboseSolver)
         mpSolver_->EnableOutput();
     }
 
+    if (warmStart_ && !hint_.empty())
+    {
+        mpSolver_->SetHint(hint_);
+    }
+
     auto mpStatus = mpSolver_->Solve(params_);
 
     solution_ = std::make_unique<OrtoolsMipSolution>(mpStatus, mpSolver_);
+    // Solution values can't be read once the problem is modified, they are copied now
+    if (warmStart_ && (mpStatus == MPSolver::OPTIMAL || mpStatus == MPSolver::FEASIBLE))
+    {
+        hint_.clear();
+        hint_.reserve(mpSolver_->variables().size());
+        for (const auto* var: mpSolver_->variables())
+        {
+            hint_.emplace_back(var, var->solution_value());
+        }
+    }
     return solution_.get();
 }
 
+void OrtoolsLinearProblem::setWarmStart(bool warmStart)
+{
+    warmStart_ = warmStart;
+    if (!warmStart_)
+    {
+        hint_.clear();
+        mpSolver_->SetHint({});
+    }
+}
+
 double OrtoolsLinearProblem::infinity() const
 {
     return MPSolver::infinity();
@@ -84,6 +84,11 @@ double OrtoolsMipConstraint::getCoefficient(LinearProblemApi::IMipVariable* var)
     return mpConstraint_->GetCoefficient(mpvar->getMpVar());
 }
 
+operations_research::MPConstraint* OrtoolsMipConstraint::getMpConstraint() const
+{
+    return mpConstraint_;
+}
+
 const std::string& OrtoolsMipConstraint::getName() const
 {
     return mpConstraint_->name();
@@ -26,6 +26,7 @@
 #include <antares/checks/checkLoadedInputData.h>
 #include <antares/exception/LoadingError.hpp>
 #include <antares/infoCollection/StudyInfoCollector.h>
+#include <antares/io/load-profile.h>
 #include <antares/logs/hostinfo.h>
 #include <antares/resources/resources.h>
 #include <antares/sys/policy.h>
@@ -225,6 +226,9 @@ void Application::readDataForTheStudy(Data::StudyLoadOptions& options)
     // Apply transformations needed by the solver only (and not the interface for example)
     study.performTransformationsBeforeLaunchingSimulation();
 
+    // Identical input matrices share their memory from now on (copy-on-write)
+    study.shareIdenticalTimeSeries();
+
     ScenarioBuilderOwner(study).callScenarioBuilder();
 }
 
@@ -487,6 +491,10 @@ void Application::writeExectutionInfo()
     const std::string exec_info_path = "execution_info.ini";
     std::string content = file_content.saveToBufferAsIni();
     resultWriter->addEntryFromBuffer(exec_info_path, content);
+
+    // Per file breakdown of the study loading
+    std::string loadProfile = Statistics::LoadProfileReport();
+    resultWriter->addEntryFromBuffer("time_measurement.txt", loadProfile);
 }
 
 Application::~Application()
@@ -0,0 +1,162 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "antares/solver/hydro/daily/h2o_j_donnees_mensuelles.h"
+#include "antares/solver/hydro/daily/h2o_j_fonctions.h"
+
+namespace
+{
+// Tolerance relative sur l'energie du mois
+constexpr double tolerance = 1.e-9;
+} // namespace
+
+bool H2O_J_ResoudreLeProblemeSpecialise(DONNEES_MENSUELLES* DonneesMensuelles,
+                                        int NumeroDeProbleme)
+{
+    PROBLEME_HYDRAULIQUE& ProblemeHydraulique = DonneesMensuelles->ProblemeHydraulique;
+
+    PROBLEME_LINEAIRE_PARTIE_VARIABLE& ProblemeLineairePartieVariable
+      = ProblemeHydraulique.ProblemeLineairePartieVariable[NumeroDeProbleme];
+    const PROBLEME_LINEAIRE_PARTIE_FIXE& ProblemeLineairePartieFixe
+      = ProblemeHydraulique.ProblemeLineairePartieFixe[NumeroDeProbleme];
+    const CORRESPONDANCE_DES_VARIABLES& CorrespondanceDesVariables
+      = ProblemeHydraulique.CorrespondanceDesVariables[NumeroDeProbleme];
+    const CORRESPONDANCE_DES_CONTRAINTES& CorrespondanceDesContraintes
+      = ProblemeHydraulique.CorrespondanceDesContraintes[NumeroDeProbleme];
+
+    const int NbPdt = ProblemeHydraulique.NbJoursDUnProbleme[NumeroDeProbleme];
+
+    const auto& Xmin = ProblemeLineairePartieVariable.Xmin;
+    const auto& Xmax = ProblemeLineairePartieVariable.Xmax;
+    const auto& SecondMembre = ProblemeLineairePartieVariable.SecondMembre;
+    auto& X = ProblemeLineairePartieVariable.X;
+    const auto& CoutLineaire = ProblemeLineairePartieFixe.CoutLineaire;
+    const auto& NumeroDeVariableTurbine = CorrespondanceDesVariables.NumeroDeVariableTurbine;
+    const auto& NumeroDeContrainteSurXi = CorrespondanceDesContraintes.NumeroDeContrainteSurXi;
+
+    const int VarMu = CorrespondanceDesVariables.NumeroDeLaVariableMu;
+    const int VarXi = CorrespondanceDesVariables.NumeroDeLaVariableXi;
+
+    const double TurbineDuMois = SecondMembre[CorrespondanceDesContraintes
+                                                .NumeroDeContrainteDEnergieMensuelle];
+    const double Ecart = tolerance * std::max(1., std::abs(TurbineDuMois));
+
+    // Xi n'est borne que par le bas : son cout doit etre positif
+    if (CoutLineaire[VarXi] <= 0.)
+    {
+        return false;
+    }
+
+    // On part des turbines minimales. La variable Xi ne doit pas dependre des turbines : la
+    // cible de chaque jour est atteinte par la turbine minimale, ou la turbine est fixee.
+    double Energie = 0.;
+    for (int Pdt = 0; Pdt < NbPdt; Pdt++)
+    {
+        const int Var = NumeroDeVariableTurbine[Pdt];
+        const double Cible = SecondMembre[NumeroDeContrainteSurXi[Pdt]];
+        if (Xmin[Var] > Xmax[Var] || (Xmin[Var] < Cible && Xmin[Var] < Xmax[Var]))
+        {
+            return false;
+        }
+        X[Var] = Xmin[Var];
+        Energie += X[Var];
+    }
+
+    // Mu >= 0 : l'energie des turbines minimales ne doit pas depasser celle du mois
+    if (Energie > TurbineDuMois + Ecart)
+    {
+        return false;
+    }
+
+    // Sac a dos continu : chaque MWh turbine en plus economise (CoutMu - Cout[Pdt]). On
+    // augmente en priorite les turbines les moins cheres, jusqu'a epuiser l'energie du mois.
+    const double CoutMu = CoutLineaire[VarMu];
+    std::vector<int> Jours;
+    Jours.reserve(NbPdt);
+    for (int Pdt = 0; Pdt < NbPdt; Pdt++)
+    {
+        if (CoutLineaire[NumeroDeVariableTurbine[Pdt]] < CoutMu)
+        {
+            Jours.push_back(Pdt);
+        }
+    }
+    std::stable_sort(Jours.begin(),
+                     Jours.end(),
+                     [&CoutLineaire, &NumeroDeVariableTurbine](int a, int b)
+                     {
+                         return CoutLineaire[NumeroDeVariableTurbine[a]]
+                                < CoutLineaire[NumeroDeVariableTurbine[b]];
+                     });
+
+    for (int Pdt: Jours)
+    {
+        const double Reste = TurbineDuMois - Energie;
+        if (Reste <= 0.)
+        {
+            break;
+        }
+        const int Var = NumeroDeVariableTurbine[Pdt];
+        const double Hausse = std::min(Xmax[Var] - X[Var], Reste);
+        X[Var] += Hausse;
+        Energie += Hausse;
+    }
+
+    X[VarMu] = std::max(0., TurbineDuMois - Energie);
+
+    double Xi = 0.;
+    for (int Pdt = 0; Pdt < NbPdt; Pdt++)
+    {
+        const double Cible = SecondMembre[NumeroDeContrainteSurXi[Pdt]];
+        Xi = std::max(Xi, Cible - X[NumeroDeVariableTurbine[Pdt]]);
+    }
+    X[VarXi] = Xi;
+
+    // Verification de la contrainte d'energie mensuelle
+    double Somme = X[VarMu];
+    for (int Pdt = 0; Pdt < NbPdt; Pdt++)
+    {
+        Somme += X[NumeroDeVariableTurbine[Pdt]];
+    }
+    if (std::abs(Somme - TurbineDuMois) > Ecart)
+    {
+        return false;
+    }
+
+    ProblemeLineairePartieVariable.ExistenceDUneSolution = OUI_SPX;
+    DonneesMensuelles->ResultatsValides = OUI;
+
+    for (int Var = 0; Var < ProblemeLineairePartieFixe.NombreDeVariables; Var++)
+    {
+        double* pt = ProblemeLineairePartieVariable.AdresseOuPlacerLaValeurDesVariablesOptimisees
+                       [Var];
+        if (pt)
+        {
+            *pt = X[Var];
+        }
+    }
+
+    return true;
+}
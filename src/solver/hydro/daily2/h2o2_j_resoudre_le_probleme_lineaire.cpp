@@ -51,6 +51,11 @@ RESOLUTION:
 
         Probleme->BaseDeDepartFournie = UTILISER_LA_BASE_DU_PROBLEME_SPX;
 
+        // The problem is reused from a previous resolution : Sirius only reads the costs and
+        // the right-hand sides at instanciation
+        SPX_ModifierLeVecteurCouts(ProbSpx,
+                                   ProblemeLineaireEtenduPartieFixe.CoutLineaire.data(),
+                                   ProblemeLineaireEtenduPartieFixe.NombreDeVariables);
         SPX_ModifierLeVecteurSecondMembre(ProbSpx,
                                           ProblemeLineaireEtenduPartieVariable.SecondMembre.data(),
                                           ProblemeLineaireEtenduPartieFixe.Sens.data(),
@@ -46,6 +46,12 @@ void H2O_j_ConstruireLesVariables(int,
 void H2O_J_InitialiserLesBornesdesVariables(DONNEES_MENSUELLES*, int);
 void H2O_J_InitialiserLeSecondMembre(DONNEES_MENSUELLES*, int);
 void H2O_J_ResoudreLeProblemeLineaire(DONNEES_MENSUELLES*, int);
+/*
+** Resolution directe, sans simplexe, qui exploite la structure du probleme (sac a dos
+** continu). Retourne false si la structure ou la solution ne sont pas celles attendues :
+** le probleme doit alors etre resolu par H2O_J_ResoudreLeProblemeLineaire.
+*/
+bool H2O_J_ResoudreLeProblemeSpecialise(DONNEES_MENSUELLES*, int);
 void H2O_J_LisserLesSurTurbines(DONNEES_MENSUELLES*, int);
 void H2O_J_AjouterBruitAuCout(DONNEES_MENSUELLES&);
 
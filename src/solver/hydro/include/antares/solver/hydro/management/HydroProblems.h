@@ -0,0 +1,76 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#pragma once
+
+#include <memory>
+
+namespace Antares
+{
+/*!
+** \brief Hydro allocation problems of a numSpace (monthly, daily, and daily with reservoir
+**   management)
+**
+** The structure of these problems depends neither on the area nor on the year : each one
+** is instanciated at its first use, then only its costs, bounds and right-hand sides are
+** updated. The simplex problems are kept alive, so that a resolution starts from the basis
+** of the previous one.
+**
+** A numSpace runs one year at a time : the problems are never shared between threads.
+*/
+class HydroProblems final
+{
+public:
+    // The problems use homonymous types, which cannot be defined in the same translation
+    // unit : Monthly is defined in monthly.cpp, Daily and DailyWithReservoir in daily.cpp
+    struct Monthly;
+    struct Daily;
+    struct DailyWithReservoir;
+
+    //! The monthly problem (1 reservoir)
+    Monthly& monthly();
+    //! The daily problems, without reservoir management
+    Daily& daily();
+    //! The daily problems, with reservoir management
+    DailyWithReservoir& dailyWithReservoir();
+
+private:
+    struct MonthlyDeleter
+    {
+        void operator()(Monthly* problem) const;
+    };
+
+    struct DailyDeleter
+    {
+        void operator()(Daily* problem) const;
+    };
+
+    struct DailyWithReservoirDeleter
+    {
+        void operator()(DailyWithReservoir* problem) const;
+    };
+
+    std::unique_ptr<Monthly, MonthlyDeleter> monthly_;
+    std::unique_ptr<Daily, DailyDeleter> daily_;
+    std::unique_ptr<DailyWithReservoir, DailyWithReservoirDeleter> dailyWithReservoir_;
+};
+
+} // namespace Antares
@@ -21,6 +21,8 @@
 #ifndef __ANTARES_SOLVER_HYDRO_MANAGEMENT_MANAGEMENT_H__
 #define __ANTARES_SOLVER_HYDRO_MANAGEMENT_MANAGEMENT_H__
 
+#include <functional>
+#include <span>
 #include <unordered_map>
 
 #include <antares/mersenne-twister/mersenne-twister.h>
@@ -28,6 +30,7 @@
 #include <antares/study/fwd.h>
 #include <antares/study/parts/hydro/container.h>
 #include "antares/date/date.h"
+#include "antares/solver/hydro/management/HydroProblems.h"
 #include "antares/writer/i_writer.h"
 
 namespace Antares
@@ -66,10 +69,18 @@ public:
                     const Date::Calendar& calendar,
                     Solver::IResultWriter& resultWriter);
 
-    //! Perform the hydro ventilation
+    /*!
+    ** \brief Perform the hydro ventilation
+    **
+    ** The monthly and daily optimisations of the areas are spread over one thread per
+    ** set of problems.
+    **
+    ** \param problems The problems of the numSpace running the year (at least one set)
+    */
     void makeVentilation(double* randomReservoirLevel,
                          uint y,
-                         Antares::Data::Area::ScratchMap& scratchmap);
+                         Antares::Data::Area::ScratchMap& scratchmap,
+                         std::span<HydroProblems> problems);
 
     const HYDRO_VENTILATION_RESULTS& ventilationResults()
     {
@@ -87,7 +98,8 @@ private:
     //! Monthly Optimal generations
     void prepareMonthlyOptimalGenerations(const double* random_reservoir_level,
                                           uint y,
-                                          HydroSpecificMap& hydro_specific_map);
+                                          HydroSpecificMap& hydro_specific_map,
+                                          std::span<HydroProblems> problems);
 
     //! Monthly target generations
     // note: inflows may have two different types, if in swap mode or not
@@ -99,13 +111,25 @@ private:
 
     void prepareDailyOptimalGenerations(uint y,
                                         Antares::Data::Area::ScratchMap& scratchmap,
-                                        HydroSpecificMap& hydro_specific_map);
+                                        HydroSpecificMap& hydro_specific_map,
+                                        std::span<HydroProblems> problems);
 
     void prepareDailyOptimalGenerations(
       Data::Area& area,
       uint y,
       Antares::Data::Area::ScratchMap& scratchmap,
-      Antares::Data::TimeDependantHydroManagementData& hydro_specific);
+      Antares::Data::TimeDependantHydroManagementData& hydro_specific,
+      HydroProblems& problems);
+
+    /*!
+    ** \brief Call `job(area, problems)` for each area, in parallel when there are several
+    **   sets of problems
+    **
+    ** The area of index i always uses the set (i % problems.size()) : the results do not
+    ** depend on the scheduling of the threads.
+    */
+    void forEachArea(std::span<HydroProblems> problems,
+                     const std::function<void(Data::Area&, HydroProblems&)>& job) const;
 
 private:
     const Data::AreaList& areas_;
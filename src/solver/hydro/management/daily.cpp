@@ -214,11 +214,66 @@ struct DebugData
     }
 };
 
+struct HydroProblems::Daily
+{
+    DONNEES_MENSUELLES* problem = H2O_J_Instanciation();
+
+    Daily()
+    {
+        H2O_J_AjouterBruitAuCout(*problem);
+    }
+
+    ~Daily()
+    {
+        H2O_J_Free(problem);
+        delete problem;
+    }
+};
+
+struct HydroProblems::DailyWithReservoir
+{
+    DONNEES_MENSUELLES_ETENDUES problem = H2O2_J_Instanciation();
+
+    ~DailyWithReservoir()
+    {
+        H2O2_J_Free(problem);
+    }
+};
+
+void HydroProblems::DailyDeleter::operator()(Daily* problem) const
+{
+    delete problem;
+}
+
+void HydroProblems::DailyWithReservoirDeleter::operator()(DailyWithReservoir* problem) const
+{
+    delete problem;
+}
+
+HydroProblems::Daily& HydroProblems::daily()
+{
+    if (!daily_)
+    {
+        daily_.reset(new Daily());
+    }
+    return *daily_;
+}
+
+HydroProblems::DailyWithReservoir& HydroProblems::dailyWithReservoir()
+{
+    if (!dailyWithReservoir_)
+    {
+        dailyWithReservoir_.reset(new DailyWithReservoir());
+    }
+    return *dailyWithReservoir_;
+}
+
 inline void HydroManagement::prepareDailyOptimalGenerations(
   Data::Area& area,
   uint y,
   Antares::Data::Area::ScratchMap& scratchmap,
-  Antares::Data::TimeDependantHydroManagementData& hydro_specific)
+  Antares::Data::TimeDependantHydroManagementData& hydro_specific,
+  HydroProblems& problems)
 {
     const auto srcinflows = area.hydro.series->storage.getColumn(y);
 
@@ -387,8 +442,7 @@ inline void HydroManagement::prepareDailyOptimalGenerations(
             uint firstDay = calendar_.months[simulationMonth].daysYear.first;
             uint endDay = firstDay + daysPerMonth;
 
-            DONNEES_MENSUELLES* problem = H2O_J_Instanciation();
-            H2O_J_AjouterBruitAuCout(*problem);
+            DONNEES_MENSUELLES* problem = problems.daily().problem;
             problem->NombreDeJoursDuMois = (int)daysPerMonth;
             problem->TurbineDuMois = hydro_specific.monthly[realmonth].MOG;
 
@@ -419,8 +473,6 @@ inline void HydroManagement::prepareDailyOptimalGenerations(
                 throw fatalError(area.name.c_str(), y);
             }
 
-            H2O_J_Free(problem);
-
 #ifndef NDEBUG
             for (uint day = firstDay; day != endDay; ++day)
             {
@@ -454,7 +506,7 @@ inline void HydroManagement::prepareDailyOptimalGenerations(
             uint firstDay = calendar_.months[simulationMonth].daysYear.first;
             uint endDay = firstDay + daysPerMonth;
 
-            DONNEES_MENSUELLES_ETENDUES problem = H2O2_J_Instanciation();
+            DONNEES_MENSUELLES_ETENDUES& problem = problems.dailyWithReservoir().problem;
             H2O2_J_apply_costs(h2o2_optim_costs, problem);
 
             if (debugData)
@@ -537,8 +589,6 @@ inline void HydroManagement::prepareDailyOptimalGenerations(
             case EMERGENCY_SHUT_DOWN:
                 throw fatalError(area.name.c_str(), y);
             }
-
-            H2O2_J_Free(problem);
         }
 
         if (debugData)
@@ -550,10 +600,18 @@ inline void HydroManagement::prepareDailyOptimalGenerations(
 
 void HydroManagement::prepareDailyOptimalGenerations(uint y,
                                                      Antares::Data::Area::ScratchMap& scratchmap,
-                                                     HydroSpecificMap& hydro_specific_map)
+                                                     HydroSpecificMap& hydro_specific_map,
+                                                     std::span<HydroProblems> problems)
 {
-    areas_.each(
-      [this, &scratchmap, &y, &hydro_specific_map](Data::Area& area)
-      { prepareDailyOptimalGenerations(area, y, scratchmap, hydro_specific_map[&area]); });
+    forEachArea(problems,
+                [this, &scratchmap, &y, &hydro_specific_map](Data::Area& area,
+                                                             HydroProblems& areaProblems)
+                {
+                    prepareDailyOptimalGenerations(area,
+                                                   y,
+                                                   scratchmap,
+                                                   hydro_specific_map.at(&area),
+                                                   areaProblems);
+                });
 }
 } // namespace Antares
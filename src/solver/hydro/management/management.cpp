@@ -21,9 +21,12 @@
 
 #include "antares/solver/hydro/management/management.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <vector>
 
+#include <antares/concurrency/concurrency.h>
 #include <antares/study/area/scratchpad.h>
 
 namespace Antares
@@ -138,53 +141,64 @@ void HydroManagement::prepareNetDemand(uint year,
                                        const Antares::Data::Area::ScratchMap& scratchmap,
                                        HydroSpecificMap& hydro_specific_map)
 {
+    // Hourly net demand of an area. The tests on the parameters are made once per area
+    // and not once per hour, so that the loops over the hours can be vectorised
+    std::vector<double> netdemand(HOURS_PER_YEAR);
+
     areas_.each(
-      [this, &year, &scratchmap, &mode, &hydro_specific_map](Data::Area& area)
+      [this, &year, &scratchmap, &mode, &hydro_specific_map, &netdemand](Data::Area& area)
       {
           const auto& scratchpad = scratchmap.at(&area);
 
           const auto& rormatrix = area.hydro.series->ror;
           const auto* ror = rormatrix.getColumn(year);
 
-          auto& data = area.hydro.managementData[year];
           auto& hydro_specific = hydro_specific_map[&area];
           const double* loadSeries = area.load.series.getColumn(year);
           const double* windSeries = area.wind.series.getColumn(year);
           const double* solarSeries = area.solar.series.getColumn(year);
+          const double* miscGenSum = scratchpad.miscGenSum;
+          const double* mustrunSum = (mode != Data::SimulationMode::Adequacy)
+                                       ? scratchpad.mustrunSum.data()
+                                       : scratchpad.originalMustrunSum.data();
 
-          for (uint hour = 0; hour != HOURS_PER_YEAR; ++hour)
+          // Aggregated renewable production: wind & solar
+          if (parameters_.renewableGeneration.isAggregated())
           {
-              auto dayYear = calendar_.hours[hour].dayYear;
-
-              double netdemand = 0;
-
-              // Aggregated renewable production: wind & solar
-              if (parameters_.renewableGeneration.isAggregated())
+              for (uint hour = 0; hour != HOURS_PER_YEAR; ++hour)
               {
-                  netdemand = +loadSeries[hour] - windSeries[hour] - scratchpad.miscGenSum[hour]
-                              - solarSeries[hour] - ror[hour]
-                              - ((mode != Data::SimulationMode::Adequacy)
-                                   ? scratchpad.mustrunSum[hour]
-                                   : scratchpad.originalMustrunSum[hour]);
+                  netdemand[hour] = +loadSeries[hour] - windSeries[hour] - miscGenSum[hour]
+                                    - solarSeries[hour] - ror[hour] - mustrunSum[hour];
               }
+          }
 
-              // Renewable clusters, if enabled
-              else if (parameters_.renewableGeneration.isClusters())
+          // Renewable clusters, if enabled
+          else if (parameters_.renewableGeneration.isClusters())
+          {
+              for (uint hour = 0; hour != HOURS_PER_YEAR; ++hour)
               {
-                  netdemand = loadSeries[hour] - scratchpad.miscGenSum[hour] - ror[hour]
-                              - ((mode != Data::SimulationMode::Adequacy)
-                                   ? scratchpad.mustrunSum[hour]
-                                   : scratchpad.originalMustrunSum[hour]);
+                  netdemand[hour] = loadSeries[hour] - miscGenSum[hour] - ror[hour]
+                                    - mustrunSum[hour];
+              }
 
-                  for (auto& c: area.renewable.list.each_enabled())
+              for (auto& c: area.renewable.list.each_enabled())
+              {
+                  for (uint hour = 0; hour != HOURS_PER_YEAR; ++hour)
                   {
-                      netdemand -= c->valueAtTimeStep(year, hour);
+                      netdemand[hour] -= c->valueAtTimeStep(year, hour);
                   }
               }
+          }
+          else
+          {
+              std::fill(netdemand.begin(), netdemand.end(), 0.);
+          }
 
-              assert(!std::isnan(netdemand)
+          for (uint hour = 0; hour != HOURS_PER_YEAR; ++hour)
+          {
+              assert(!std::isnan(netdemand[hour])
                      && "hydro management: NaN detected when calculating the net demande");
-              hydro_specific.daily[dayYear].DLN += netdemand;
+              hydro_specific.daily[calendar_.hours[hour].dayYear].DLN += netdemand[hour];
           }
       });
 }
@@ -268,14 +282,53 @@ void HydroManagement::prepareEffectiveDemand(uint year, HydroSpecificMap& hydro_
 
 void HydroManagement::makeVentilation(double* randomReservoirLevel,
                                       uint y,
-                                      Antares::Data::Area::ScratchMap& scratchmap)
+                                      Antares::Data::Area::ScratchMap& scratchmap,
+                                      std::span<HydroProblems> problems)
 {
     HydroSpecificMap hydro_specific_map;
     prepareNetDemand(y, parameters_.mode, scratchmap, hydro_specific_map);
     prepareEffectiveDemand(y, hydro_specific_map);
 
-    prepareMonthlyOptimalGenerations(randomReservoirLevel, y, hydro_specific_map);
-    prepareDailyOptimalGenerations(y, scratchmap, hydro_specific_map);
+    prepareMonthlyOptimalGenerations(randomReservoirLevel, y, hydro_specific_map, problems);
+    prepareDailyOptimalGenerations(y, scratchmap, hydro_specific_map, problems);
+}
+
+void HydroManagement::forEachArea(
+  std::span<HydroProblems> problems,
+  const std::function<void(Data::Area&, HydroProblems&)>& job) const
+{
+    const std::size_t nbAreas = areas_.size();
+    const std::size_t nbSets = std::min(problems.size(), nbAreas);
+
+    if (nbSets <= 1)
+    {
+        for (std::size_t i = 0; i != nbAreas; ++i)
+        {
+            job(*areas_.byIndex[i], problems.front());
+        }
+        return;
+    }
+
+    Yuni::Job::QueueService queue;
+    queue.maximumThreadCount((uint)nbSets);
+
+    Concurrency::FutureSet results;
+    for (std::size_t set = 0; set != nbSets; ++set)
+    {
+        results.add(Concurrency::AddTask(queue,
+                                         [this, &job, &problems, nbAreas, nbSets, set]
+                                         {
+                                             for (std::size_t i = set; i < nbAreas; i += nbSets)
+                                             {
+                                                 job(*areas_.byIndex[i], problems[set]);
+                                             }
+                                         }));
+    }
+
+    queue.start();
+    queue.wait(Yuni::qseIdle);
+    queue.stop();
+    results.join();
 }
 
 } // namespace Antares
@@ -142,16 +142,42 @@ double HydroManagement::prepareMonthlyTargetGenerations(
     return total;
 }
 
+struct HydroProblems::Monthly
+{
+    DONNEES_ANNUELLES problem = H2O_M_Instanciation(1);
+
+    ~Monthly()
+    {
+        H2O_M_Free(problem);
+    }
+};
+
+void HydroProblems::MonthlyDeleter::operator()(Monthly* problem) const
+{
+    delete problem;
+}
+
+HydroProblems::Monthly& HydroProblems::monthly()
+{
+    if (!monthly_)
+    {
+        monthly_.reset(new Monthly());
+    }
+    return *monthly_;
+}
+
 void HydroManagement::prepareMonthlyOptimalGenerations(const double* random_reservoir_level,
                                                        uint y,
-                                                       HydroSpecificMap& hydro_specific_map)
+                                                       HydroSpecificMap& hydro_specific_map,
+                                                       std::span<HydroProblems> problems)
 {
-    uint indexArea = 0;
-    areas_.each(
-      [this, &random_reservoir_level, &y, &indexArea, &hydro_specific_map](Data::Area& area)
+    forEachArea(
+      problems,
+      [this, &random_reservoir_level, &y, &hydro_specific_map](Data::Area& area,
+                                                               HydroProblems& areaProblems)
       {
           auto& data = area.hydro.managementData[y];
-          auto& hydro_specific = hydro_specific_map[&area];
+          auto& hydro_specific = hydro_specific_map.at(&area);
 
           auto& minLvl = area.hydro.reservoirLevel[Data::PartHydro::minimum];
           auto& maxLvl = area.hydro.reservoirLevel[Data::PartHydro::maximum];
@@ -161,7 +187,7 @@ void HydroManagement::prepareMonthlyOptimalGenerations(const double* random_rese
           double lvi = -1.;
           if (area.hydro.reservoirManagement)
           {
-              lvi = random_reservoir_level[indexArea];
+              lvi = random_reservoir_level[area.index];
           }
 
           double solutionCost = 0.;
@@ -169,7 +195,7 @@ void HydroManagement::prepareMonthlyOptimalGenerations(const double* random_rese
 
           if (area.hydro.reservoirManagement)
           {
-              auto problem = H2O_M_Instanciation(1);
+              auto& problem = areaProblems.monthly().problem;
 
               double totalInflowsYear = prepareMonthlyTargetGenerations(area, data, hydro_specific);
               assert(totalInflowsYear >= 0.);
@@ -230,8 +256,6 @@ void HydroManagement::prepareMonthlyOptimalGenerations(const double* random_rese
                   throw FatalError(msg.str());
               }
               }
-
-              H2O_M_Free(problem);
           }
 
           else
@@ -306,7 +330,6 @@ void HydroManagement::prepareMonthlyOptimalGenerations(const double* random_rese
               auto content = buffer.str();
               resultWriter_.addEntryFromBuffer(path, content);
           }
-          indexArea++;
       });
 }
 
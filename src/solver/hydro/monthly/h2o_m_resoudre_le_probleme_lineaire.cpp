@@ -50,6 +50,11 @@ RESOLUTION:
 
         Probleme->BaseDeDepartFournie = UTILISER_LA_BASE_DU_PROBLEME_SPX;
 
+        // The problem is reused from a previous resolution : Sirius only reads the costs and
+        // the right-hand sides at instanciation
+        SPX_ModifierLeVecteurCouts(ProbSpx,
+                                   ProblemeLineairePartieFixe.CoutLineaireBruite.data(),
+                                   ProblemeLineairePartieFixe.NombreDeVariables);
         SPX_ModifierLeVecteurSecondMembre(ProbSpx,
                                           ProblemeLineairePartieVariable.SecondMembre.data(),
                                           ProblemeLineairePartieFixe.Sens.data(),
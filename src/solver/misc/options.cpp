@@ -31,6 +31,7 @@
 
 #include <antares/antares/constants.h>
 #include <antares/exception/LoadingError.hpp>
+#include <antares/io/archive.h>
 #include <antares/logs/logs.h>
 #include <antares/study/study.h>
 #include "antares/antares/Enum.hpp"
@@ -51,7 +52,7 @@ std::unique_ptr<Yuni::GetOpt::Parser> CreateParser(Settings& settings, StudyLoad
     // Simulation mode
     parser->addParagraph("Simulation");
     // --input
-    parser->addFlag(options.studyFolder, 'i', "input", "Study folder");
+    parser->addFlag(options.studyFolder, 'i', "input", "Study folder or zip archive");
     // --expansion
     parser->addFlag(options.forceExpansion,
                     ' ',
@@ -124,6 +125,12 @@ std::unique_ptr<Yuni::GetOpt::Parser> CreateParser(Settings& settings, StudyLoad
                     "Force the writing the result output for each year (economy only)");
     // --derated
     parser->addFlag(options.forceDerated, ' ', "derated", "Force the derated mode");
+    // --ts-memory-budget
+    parser->add(options.timeSeriesMemoryBudget,
+                ' ',
+                "ts-memory-budget",
+                "Read the ready-made load, solar and wind time-series on demand, keeping at most "
+                "VALUE MB of them in memory");
 
     // --output-force-zip
     parser->addFlag(settings.forceZipOutput,
@@ -286,6 +293,17 @@ void Settings::checkAndSetStudyFolder(const std::string& folder)
         throw Error::StudyFolderDoesNotExist(folder);
     }
 
+    // A zip archive is read in place: its content is made visible in a folder
+    // of the same name, where the logs and the outputs are written
+    if (std::filesystem::is_regular_file(abspath) && abspath.extension() == ".zip")
+    {
+        auto mountPoint = abspath;
+        mountPoint.replace_extension();
+        logs.info() << "Reading the study from the archive " << abspath.string();
+        Antares::IO::mountArchive(abspath, mountPoint);
+        abspath = mountPoint;
+    }
+
     // Copying the result
     studyFolder = abspath.string();
 }
@@ -34,7 +34,14 @@ namespace Antares::Solver::LoadFiles
 
 ModelerParameters loadParameters(const std::filesystem::path& studyPath);
 
-std::vector<Study::SystemModel::Library> loadLibraries(const std::filesystem::path& studyPath);
+/**
+ * Libraries of the study, loaded on at most nbThreads threads. With useCache, a library is
+ * read from its compiled form in cache/model-libraries when its file is unchanged since, and
+ * this form is written otherwise.
+ */
+std::vector<Study::SystemModel::Library> loadLibraries(const std::filesystem::path& studyPath,
+                                                       bool useCache = false,
+                                                       unsigned int nbThreads = 1);
 
 Study::SystemModel::System loadSystem(const std::filesystem::path& studyPath,
                                       const std::vector<Study::SystemModel::Library>& libraries);
@@ -19,9 +19,15 @@
  * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
  */
 
+#include <algorithm>
+#include <fstream>
+#include <random>
+
 #include <yaml-cpp/yaml.h>
 
+#include <antares/concurrency/concurrency.h>
 #include <antares/io/file.h>
+#include <antares/io/inputs/model-cache/libraryCache.h>
 #include <antares/io/inputs/model-converter/modelConverter.h>
 #include <antares/io/inputs/yml-model/parser.h>
 #include <antares/logs/logs.h>
@@ -33,19 +39,9 @@ namespace Antares::Solver::LoadFiles
 {
 using namespace IO::Inputs;
 
-static Study::SystemModel::Library loadSingleLibrary(const fs::path& filePath)
+static Study::SystemModel::Library convertLibrary(const std::string& libraryStr,
+                                                  const fs::path& filePath)
 {
-    std::string libraryStr;
-    try
-    {
-        libraryStr = IO::readFile(filePath);
-    }
-    catch (const std::runtime_error& e)
-    {
-        logs.error() << "Error while trying to read this library file: " << filePath;
-        throw ErrorLoadingYaml(e.what());
-    }
-
     YmlModel::Parser parser;
     YmlModel::Library libraryObj;
 
@@ -71,10 +67,88 @@ static Study::SystemModel::Library loadSingleLibrary(const fs::path& filePath)
     }
 }
 
-std::vector<Study::SystemModel::Library> loadLibraries(const fs::path& studyPath)
+static std::optional<Study::SystemModel::Library> readCache(const fs::path& cacheFile,
+                                                            std::uint64_t contentHash)
 {
-    std::vector<Study::SystemModel::Library> libraries;
+    if (!fs::exists(cacheFile))
+    {
+        return std::nullopt;
+    }
+    try
+    {
+        return ModelCache::deserialize(IO::readFile(cacheFile), contentHash);
+    }
+    catch (const std::runtime_error&)
+    {
+        return std::nullopt;
+    }
+}
 
+// A cache which can't be written is only a missed optimisation
+static void writeCache(const fs::path& cacheFile,
+                       const Study::SystemModel::Library& library,
+                       std::uint64_t contentHash)
+{
+    // Written aside then renamed, so that other runs never read a partial file
+    fs::path tmpFile = cacheFile;
+    tmpFile += "." + std::to_string(std::random_device{}()) + ".tmp";
+    try
+    {
+        const auto data = ModelCache::serialize(library, contentHash);
+        fs::create_directories(cacheFile.parent_path());
+        std::ofstream out(tmpFile, std::ios::binary);
+        out.write(data.data(), static_cast<std::streamsize>(data.size()));
+        out.close();
+        if (!out)
+        {
+            throw std::runtime_error("write failed");
+        }
+        fs::rename(tmpFile, cacheFile);
+    }
+    catch (const std::exception& e)
+    {
+        logs.warning() << "Library cache not written: " << cacheFile << ": " << e.what();
+        std::error_code ignored;
+        fs::remove(tmpFile, ignored);
+    }
+}
+
+static Study::SystemModel::Library loadSingleLibrary(const fs::path& filePath,
+                                                     const fs::path& cacheDirectory)
+{
+    std::string libraryStr;
+    try
+    {
+        libraryStr = IO::readFile(filePath);
+    }
+    catch (const std::runtime_error& e)
+    {
+        logs.error() << "Error while trying to read this library file: " << filePath;
+        throw ErrorLoadingYaml(e.what());
+    }
+
+    if (cacheDirectory.empty())
+    {
+        return convertLibrary(libraryStr, filePath);
+    }
+
+    const auto contentHash = ModelCache::hashContent(libraryStr);
+    const auto cacheFile = cacheDirectory / (filePath.filename().string() + ".bin");
+    if (auto library = readCache(cacheFile, contentHash))
+    {
+        logs.info() << "Library read from the cache: " << cacheFile;
+        return std::move(*library);
+    }
+    auto library = convertLibrary(libraryStr, filePath);
+    writeCache(cacheFile, library, contentHash);
+    return library;
+}
+
+std::vector<Study::SystemModel::Library> loadLibraries(const fs::path& studyPath,
+                                                       bool useCache,
+                                                       unsigned int nbThreads)
+{
+    std::vector<fs::path> files;
     const fs::path directoryPath = studyPath / "input" / "model-libraries";
     for (const auto& entry: fs::directory_iterator(directoryPath))
     {
@@ -84,11 +158,35 @@ std::vector<Study::SystemModel::Library> loadLibraries(const fs::path& studyPath
                         << " ignored, only files having the `.yml` extension are loaded";
             continue;
         }
+        files.push_back(entry.path());
+    }
+
+    const fs::path cacheDirectory = useCache ? studyPath / "cache" / "model-libraries"
+                                             : fs::path();
 
-        libraries.push_back(loadSingleLibrary(entry.path()));
-        logs.info() << "Library loaded: " << libraries.back().Id();
+    // Libraries are independent, each one is parsed and converted on its own thread
+    std::vector<Study::SystemModel::Library> libraries(files.size());
+    Yuni::Job::QueueService queue;
+    const auto nbWorkers = std::min<std::size_t>(files.size(), nbThreads);
+    queue.maximumThreadCount(std::max<std::size_t>(1, nbWorkers));
+
+    auto load = [&](std::size_t i)
+    { libraries[i] = loadSingleLibrary(files[i], cacheDirectory); };
+    Concurrency::FutureSet futures;
+    for (std::size_t i = 0; i < files.size(); ++i)
+    {
+        futures.add(Concurrency::AddTask(queue, [&load, i] { load(i); }));
     }
 
+    queue.start();
+    queue.wait(Yuni::qseIdle);
+    queue.stop();
+    futures.join();
+
+    for (const auto& library: libraries)
+    {
+        logs.info() << "Library loaded: " << library.Id();
+    }
     return libraries;
 }
 } // namespace Antares::Solver::LoadFiles
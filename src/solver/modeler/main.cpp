@@ -22,12 +22,12 @@
 #include <fstream>
 
 #include <antares/logs/logs.h>
-#include <antares/optimisation/linear-problem-api/linearProblemBuilder.h>
 #include <antares/optimisation/linear-problem-data-impl/linearProblemData.h>
 #include <antares/optimisation/linear-problem-mpsolver-impl/linearProblem.h>
 #include <antares/solver/modeler/loadFiles/loadFiles.h>
 #include <antares/solver/modeler/parameters/parseModelerParameters.h>
-#include <antares/solver/optim-model-filler/ComponentFiller.h>
+#include <antares/solver/modeler/scenarios/scenarios.h>
+#include <antares/solver/modeler/scenarios/systemLinearProblem.h>
 #include "antares/optimisation/linear-problem-api/linearProblem.h"
 
 using namespace Antares::Optimisation::LinearProblemMpsolverImpl;
@@ -35,39 +35,58 @@ using namespace Antares;
 using namespace Antares::Solver;
 using namespace Antares::Optimisation::LinearProblemApi;
 
-class SystemLinearProblem
+static void writeSolution(const std::filesystem::path& path, const IMipSolution& solution)
 {
-public:
-    explicit SystemLinearProblem(const Study::SystemModel::System& system):
-        system_(system)
+    std::ofstream sol_out(path);
+    sol_out << "objective " << solution.getObjectiveValue() << std::endl;
+    for (const auto& [name, value]: solution.getOptimalValues())
     {
+        sol_out << name << " " << value << std::endl;
     }
+}
 
-    ~SystemLinearProblem() = default;
-
-    void Provide(ILinearProblem& pb, const ModelerParameters& parameters)
+// Solution of each window in solution-<window>.csv, statistics of all windows in
+// rolling-horizon.csv
+static bool solveByWindows(SystemLinearProblem& system_linear_problem,
+                           ILinearProblem& pb,
+                           const ModelerParameters& parameters,
+                           const std::filesystem::path& outputPath)
+{
+    logs.info() << "Launching rolling horizon resolution, windows of " << parameters.windowLength
+                << " time steps overlapping by " << parameters.windowOverlap;
+    unsigned window = 0;
+    auto statistics = system_linear_problem.ProvideAndSolveByWindows(
+      pb,
+      [&](const WindowStatistics& stats, const IMipSolution& solution)
+      {
+          logs.info() << "Window " << window << " [" << stats.firstTimeStep << ", "
+                      << stats.lastTimeStep << "] : objective " << stats.objectiveValue
+                      << ", solved in " << stats.solveDuration << "s";
+          if (!parameters.noOutput)
+          {
+              writeSolution(outputPath / ("solution-" + std::to_string(window) + ".csv"),
+                            solution);
+          }
+          ++window;
+      });
+
+    if (!parameters.noOutput)
     {
-        std::vector<std::unique_ptr<Optimization::ComponentFiller>> fillers;
-        std::vector<LinearProblemFiller*> fillers_ptr;
-        for (const auto& [_, component]: system_.Components())
-        {
-            auto cf = std::make_unique<Optimization::ComponentFiller>(component);
-            fillers.push_back(std::move(cf));
-        }
-        for (auto& component_filler: fillers)
+        std::ofstream stats_out(outputPath / "rolling-horizon.csv");
+        stats_out << "window first-time-step last-time-step committed-time-steps fill-duration "
+                     "solve-duration status objective"
+                  << std::endl;
+        for (unsigned w = 0; w < statistics.size(); ++w)
         {
-            fillers_ptr.push_back(component_filler.get());
+            const auto& stats = statistics[w];
+            stats_out << w << " " << stats.firstTimeStep << " " << stats.lastTimeStep << " "
+                      << stats.committedTimeSteps << " " << stats.fillDuration << " "
+                      << stats.solveDuration << " " << toString(stats.status) << " "
+                      << stats.objectiveValue << std::endl;
         }
-
-        LinearProblemBuilder linear_problem_builder(fillers_ptr);
-        Optimisation::LinearProblemDataImpl::LinearProblemData dummy_data;
-        FillContext dummy_time_scenario_ctx = {parameters.firstTimeStep, parameters.lastTimeStep};
-        linear_problem_builder.build(pb, dummy_data, dummy_time_scenario_ctx);
     }
-
-private:
-    const Study::SystemModel::System& system_;
-};
+    return !statistics.empty() && window == statistics.size();
+}
 
 static void usage()
 {
@@ -98,11 +117,19 @@ int main(int argc, const char** argv)
     {
         const auto parameters = LoadFiles::loadParameters(studyPath);
         logs.info() << "Parameters loaded";
-        const auto libraries = LoadFiles::loadLibraries(studyPath);
+        // The study provides no data series yet : all the scenarios would be the same problem
+        if (parameters.nbScenarios > 1)
+        {
+            throw std::invalid_argument("The study has no scenario-dependent data, nb-scenarios "
+                                        "must be 1");
+        }
+        const auto libraries = LoadFiles::loadLibraries(studyPath,
+                                                        parameters.libraryCache,
+                                                        parameters.nbThreads);
         logs.info() << "Libraries loaded";
         const auto system = LoadFiles::loadSystem(studyPath, libraries);
         logs.info() << "System loaded";
-        SystemLinearProblem system_linear_problem(system);
+        Optimisation::LinearProblemDataImpl::LinearProblemData data;
 
         auto outputPath = studyPath / "output";
         if (!parameters.noOutput)
@@ -116,10 +143,23 @@ int main(int argc, const char** argv)
             }
         }
 
+        SystemLinearProblem system_linear_problem(system, parameters, data);
         logs.info() << "linear problem of System loaded";
         OrtoolsLinearProblem ortools_linear_problem(true, parameters.solver);
 
-        system_linear_problem.Provide(ortools_linear_problem, parameters);
+        if (parameters.windowLength > 0)
+        {
+            if (!solveByWindows(system_linear_problem,
+                                ortools_linear_problem,
+                                parameters,
+                                outputPath))
+            {
+                logs.error() << "Problem during linear optimization";
+            }
+            return 0;
+        }
+
+        system_linear_problem.Provide(ortools_linear_problem);
 
         logs.info() << "Linear problem provided";
 
@@ -142,12 +182,7 @@ int main(int argc, const char** argv)
             if (!parameters.noOutput)
             {
                 logs.info() << "Writing objective & variable values...";
-                std::ofstream sol_out(outputPath / "solution.csv");
-                sol_out << "objective " << solution->getObjectiveValue() << std::endl;
-                for (const auto& [name, value]: solution->getOptimalValues())
-                {
-                    sol_out << name << " " << value << std::endl;
-                }
+                writeSolution(outputPath / "solution.csv", *solution);
             }
             break;
         default:
@@ -41,6 +41,12 @@ struct convert<Antares::Solver::ModelerParameters>
         rhs.firstTimeStep = node["first-time-step"].as<unsigned int>(0);
         // TODO check this value
         rhs.lastTimeStep = node["last-time-step"].as<unsigned int>(167);
+        rhs.nbThreads = node["nb-threads"].as<unsigned int>(1);
+        rhs.windowLength = node["window-length"].as<unsigned int>(0);
+        rhs.windowOverlap = node["window-overlap"].as<unsigned int>(0);
+        rhs.nbScenarios = node["nb-scenarios"].as<unsigned int>(1);
+        rhs.nbParallelScenarios = node["nb-parallel-scenarios"].as<unsigned int>(1);
+        rhs.libraryCache = node["library-cache"].as<bool>(false);
         return true;
     }
 };
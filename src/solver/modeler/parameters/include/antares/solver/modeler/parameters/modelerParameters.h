@@ -38,5 +38,16 @@ struct ModelerParameters
     // time steps
     unsigned int firstTimeStep;
     unsigned int lastTimeStep;
+    // Number of threads building the linear problem
+    unsigned int nbThreads = 1;
+    // Rolling horizon : length of the time windows (0 to solve the whole horizon at once), and
+    // number of time steps shared by consecutive windows
+    unsigned int windowLength = 0;
+    unsigned int windowOverlap = 0;
+    // Scenarios, each one solved in its own problem, and how many are solved at the same time
+    unsigned int nbScenarios = 1;
+    unsigned int nbParallelScenarios = 1;
+    // Read the libraries from their compiled form when unchanged
+    bool libraryCache = false;
 };
 } // namespace Antares::Solver
@@ -0,0 +1,65 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <antares/optimisation/linear-problem-api/ILinearProblemData.h>
+#include <antares/optimisation/linear-problem-api/mipSolution.h>
+#include <antares/solver/modeler/parameters/modelerParameters.h>
+#include <antares/study/system-model/system.h>
+
+namespace Antares::Solver
+{
+struct ScenarioResult
+{
+    Optimisation::LinearProblemApi::MipStatus status = Optimisation::LinearProblemApi::MipStatus::
+      MIP_ERROR;
+    double objectiveValue = 0.;
+    // Durations in seconds
+    double buildDuration = 0.;
+    double solveDuration = 0.;
+    std::map<std::string, double> values;
+};
+
+const char* toString(Optimisation::LinearProblemApi::MipStatus status);
+
+// Build and solve the problem of a single scenario
+ScenarioResult solveScenario(const Study::SystemModel::System& system,
+                             const ModelerParameters& parameters,
+                             Optimisation::LinearProblemApi::ILinearProblemData& data,
+                             unsigned scenario);
+
+// One problem per scenario, built from the same system and data. The problems are solved
+// concurrently, nb-parallel-scenarios at a time
+std::vector<ScenarioResult> solveScenarios(
+  const Study::SystemModel::System& system,
+  const ModelerParameters& parameters,
+  Optimisation::LinearProblemApi::ILinearProblemData& data);
+
+// Statistics of all scenarios in scenarios.csv, their solutions in solution.csv
+void writeScenarios(const std::filesystem::path& outputPath,
+                    const std::vector<ScenarioResult>& results);
+} // namespace Antares::Solver
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <antares/optimisation/linear-problem-api/ILinearProblemData.h>
+#include <antares/optimisation/linear-problem-api/linearProblemBuilder.h>
+#include <antares/optimisation/linear-problem-api/rollingHorizon.h>
+#include <antares/solver/modeler/parameters/modelerParameters.h>
+#include <antares/solver/optim-model-filler/ComponentFiller.h>
+#include <antares/study/system-model/system.h>
+
+namespace Antares::Solver
+{
+/**
+ * Linear problem of a system : one ComponentFiller per component, filled for the time steps of
+ * the parameters and a single scenario.
+ */
+class SystemLinearProblem
+{
+public:
+    SystemLinearProblem(const Study::SystemModel::System& system,
+                        const ModelerParameters& parameters,
+                        Optimisation::LinearProblemApi::ILinearProblemData& data,
+                        unsigned scenario = 0);
+
+    void Provide(Optimisation::LinearProblemApi::ILinearProblem& pb);
+
+    // Build and solve the problem for successive time windows
+    std::vector<Optimisation::LinearProblemApi::WindowStatistics> ProvideAndSolveByWindows(
+      Optimisation::LinearProblemApi::ILinearProblem& pb,
+      const Optimisation::LinearProblemApi::RollingHorizon::SolutionHandler& onSolved);
+
+private:
+    const Study::SystemModel::System& system_;
+    const ModelerParameters& parameters_;
+    Optimisation::LinearProblemApi::ILinearProblemData& data_;
+    unsigned scenario_;
+    std::vector<std::unique_ptr<Optimization::ComponentFiller>> fillers_;
+    std::vector<Optimisation::LinearProblemApi::LinearProblemFiller*> fillers_ptr_;
+    Optimisation::LinearProblemApi::LinearProblemBuilder builder_;
+};
+} // namespace Antares::Solver
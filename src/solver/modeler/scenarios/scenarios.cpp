@@ -0,0 +1,130 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+#include <antares/concurrency/concurrency.h>
+#include <antares/logs/logs.h>
+#include <antares/optimisation/linear-problem-mpsolver-impl/linearProblem.h>
+#include <antares/solver/modeler/scenarios/scenarios.h>
+#include <antares/solver/modeler/scenarios/systemLinearProblem.h>
+
+using namespace Antares::Optimisation::LinearProblemApi;
+using namespace Antares::Optimisation::LinearProblemMpsolverImpl;
+
+namespace Antares::Solver
+{
+const char* toString(MipStatus status)
+{
+    switch (status)
+    {
+    case MipStatus::OPTIMAL:
+        return "OPTIMAL";
+    case MipStatus::FEASIBLE:
+        return "FEASIBLE";
+    case MipStatus::UNBOUNDED:
+        return "UNBOUNDED";
+    case MipStatus::INFEASIBLE:
+        return "INFEASIBLE";
+    default:
+        return "ERROR";
+    }
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+ScenarioResult solveScenario(const Study::SystemModel::System& system,
+                             const ModelerParameters& parameters,
+                             ILinearProblemData& data,
+                             unsigned scenario)
+{
+    ScenarioResult result;
+    auto start = std::chrono::steady_clock::now();
+    SystemLinearProblem system_linear_problem(system, parameters, data, scenario);
+    OrtoolsLinearProblem ortools_linear_problem(true, parameters.solver);
+    system_linear_problem.Provide(ortools_linear_problem);
+    result.buildDuration = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    auto* solution = ortools_linear_problem.solve(parameters.solverLogs);
+    result.solveDuration = secondsSince(start);
+    result.status = solution->getStatus();
+    if (result.status == MipStatus::OPTIMAL || result.status == MipStatus::FEASIBLE)
+    {
+        result.objectiveValue = solution->getObjectiveValue();
+        result.values = solution->getOptimalValues();
+    }
+    logs.info() << "Scenario " << scenario << " : " << toString(result.status) << ", built in "
+                << result.buildDuration << "s, solved in " << result.solveDuration << "s";
+    return result;
+}
+
+std::vector<ScenarioResult> solveScenarios(const Study::SystemModel::System& system,
+                                           const ModelerParameters& parameters,
+                                           ILinearProblemData& data)
+{
+    std::vector<ScenarioResult> results(parameters.nbScenarios);
+    Yuni::Job::QueueService queue;
+    queue.maximumThreadCount(std::max(1u, parameters.nbParallelScenarios));
+
+    auto solve = [&](unsigned scenario)
+    { results[scenario] = solveScenario(system, parameters, data, scenario); };
+    Concurrency::FutureSet futures;
+    for (unsigned scenario = 0; scenario < parameters.nbScenarios; ++scenario)
+    {
+        futures.add(Concurrency::AddTask(queue, [&solve, scenario] { solve(scenario); }));
+    }
+
+    queue.start();
+    queue.wait(Yuni::qseIdle);
+    queue.stop();
+    futures.join();
+    return results;
+}
+
+void writeScenarios(const std::filesystem::path& outputPath,
+                    const std::vector<ScenarioResult>& results)
+{
+    std::ofstream stats_out(outputPath / "scenarios.csv");
+    stats_out << "scenario status objective build-duration solve-duration" << std::endl;
+    std::ofstream sol_out(outputPath / "solution.csv");
+    for (unsigned scenario = 0; scenario < results.size(); ++scenario)
+    {
+        const auto& result = results[scenario];
+        stats_out << scenario << " " << toString(result.status) << " " << result.objectiveValue
+                  << " " << result.buildDuration << " " << result.solveDuration << std::endl;
+        if (result.status != MipStatus::OPTIMAL && result.status != MipStatus::FEASIBLE)
+        {
+            continue;
+        }
+        sol_out << scenario << " objective " << result.objectiveValue << std::endl;
+        for (const auto& [name, value]: result.values)
+        {
+            sol_out << scenario << " " << name << " " << value << std::endl;
+        }
+    }
+}
+} // namespace Antares::Solver
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#include <antares/solver/modeler/scenarios/systemLinearProblem.h>
+
+using namespace Antares::Optimisation::LinearProblemApi;
+
+namespace Antares::Solver
+{
+SystemLinearProblem::SystemLinearProblem(const Study::SystemModel::System& system,
+                                         const ModelerParameters& parameters,
+                                         ILinearProblemData& data,
+                                         unsigned scenario):
+    system_(system),
+    parameters_(parameters),
+    data_(data),
+    scenario_(scenario),
+    builder_(fillers_ptr_, parameters.nbThreads)
+{
+    for (const auto& [_, component]: system_.Components())
+    {
+        auto cf = std::make_unique<Optimization::ComponentFiller>(component);
+        fillers_ptr_.push_back(cf.get());
+        fillers_.push_back(std::move(cf));
+    }
+}
+
+void SystemLinearProblem::Provide(ILinearProblem& pb)
+{
+    FillContext time_scenario_ctx = {parameters_.firstTimeStep, parameters_.lastTimeStep};
+    time_scenario_ctx.scenariosSelected = {scenario_};
+    builder_.build(pb, data_, time_scenario_ctx);
+}
+
+std::vector<WindowStatistics> SystemLinearProblem::ProvideAndSolveByWindows(
+  ILinearProblem& pb,
+  const RollingHorizon::SolutionHandler& onSolved)
+{
+    RollingHorizon rolling_horizon(builder_, parameters_.windowLength, parameters_.windowOverlap);
+    FillContext horizon = {parameters_.firstTimeStep, parameters_.lastTimeStep};
+    horizon.scenariosSelected = {scenario_};
+    return rolling_horizon.run(pb, data_, horizon, parameters_.solverLogs, onSolved);
+}
+} // namespace Antares::Solver
@@ -19,24 +19,83 @@
  * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
  */
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
 #include <ranges>
+#include <set>
 
+#include <antares/expressions/bytecode/Compiler.h>
+#include <antares/expressions/bytecode/Evaluator.h>
 #include <antares/expressions/nodes/ExpressionsNodes.h>
-#include <antares/expressions/visitors/EvalVisitor.h>
 #include <antares/solver/optim-model-filler/ComponentFiller.h>
-#include <antares/solver/optim-model-filler/ReadLinearConstraintVisitor.h>
 #include <antares/study/system-model/variable.h>
 #include "antares/expressions/visitors/TimeIndexVisitor.h"
 
 namespace Antares::Optimization
 {
+using namespace Expressions::Bytecode;
 
 ComponentFiller::ComponentFiller(const Study::SystemModel::Component& component):
     component_(component),
-    evaluationContext_(component_.getParameterValues(), {}),
-    modelVariable_(component.getModel()->Variables())
+    parameterValues_(component_.getParameterValues())
+{
+}
 
+const Program& ComponentFiller::compiled(const Expressions::Nodes::Node* node)
 {
+    auto it = programs_.find(node);
+    if (it == programs_.end())
+    {
+        it = programs_.emplace(node, compile(node)).first;
+    }
+    return it->second;
+}
+
+const ConstraintProgram& ComponentFiller::compiledConstraint(const std::string& constraint_id)
+{
+    auto it = constraintPrograms_.find(constraint_id);
+    if (it == constraintPrograms_.end())
+    {
+        const auto& constraint = component_.getModel()->getConstraints().at(constraint_id);
+        it = constraintPrograms_
+               .emplace(constraint_id, compileConstraint(constraint.expression().RootNode()))
+               .first;
+    }
+    return it->second;
+}
+
+// Parameters read from a data series take their values at each timestep
+std::vector<ParameterValues> ComponentFiller::bind(const Program& program) const
+{
+    std::vector<ParameterValues> parameters;
+    parameters.reserve(program.parameters.size());
+    for (const auto& name: program.parameters)
+    {
+        if (auto it = dataSeries_.find(name); it != dataSeries_.end())
+        {
+            parameters.push_back({it->second.data(), true});
+        }
+        else
+        {
+            parameters.push_back({&parameterValues_.at(name), false});
+        }
+    }
+    return parameters;
+}
+
+// Values of a code for the timesteps of the problem, a single one if they are all the same
+std::vector<double> ComponentFiller::evaluateOverTime(Evaluator& evaluator,
+                                                      const Code& code) const
+{
+    std::vector<double> values(nbTimeSteps_);
+    evaluator.run(code, firstTimeStep_, values);
+    if (std::ranges::adjacent_find(values, std::ranges::not_equal_to()) == values.end())
+    {
+        values.resize(1);
+    }
+    return values;
 }
 
 bool checkTimeSteps(Optimisation::LinearProblemApi::FillContext& ctx)
@@ -54,69 +113,90 @@ void ComponentFiller::addVariables(Optimisation::LinearProblemApi::ILinearProble
         return;
     }
 
-    Expressions::Visitors::EvalVisitor evaluator(evaluationContext_);
-    for (const auto& variable: component_.getModel()->Variables() | std::views::values)
+    firstTimeStep_ = ctx.getFirstTimeStep();
+    nbTimeSteps_ = ctx.getNumberOfTimestep();
+    resolveDataSeries(data, ctx);
+
+    constexpr double infinity = std::numeric_limits<double>::infinity();
+    const auto& modelVariables = component_.getModel()->Variables();
+    variables_.clear();
+    variables_.reserve(modelVariables.size());
+    for (const auto& variable: modelVariables | std::views::values)
     {
         if (variable.isTimeDependent())
         {
-            pb.addVariable(evaluator.dispatch(variable.LowerBound().RootNode()),
-                           evaluator.dispatch(variable.UpperBound().RootNode()),
-                           variable.Type() != Study::SystemModel::ValueType::FLOAT,
-                           component_.Id() + "." + variable.Id(),
-                           ctx.getNumberOfTimestep());
+            variables_[variable.Id()] = pb.addVariable(
+              -infinity,
+              infinity,
+              variable.Type() != Study::SystemModel::ValueType::FLOAT,
+              component_.Id() + "." + variable.Id(),
+              ctx.getNumberOfTimestep());
         }
         else
         {
-            pb.addVariable(evaluator.dispatch(variable.LowerBound().RootNode()),
-                           evaluator.dispatch(variable.UpperBound().RootNode()),
-                           variable.Type() != Study::SystemModel::ValueType::FLOAT,
-                           component_.Id() + "." + variable.Id());
+            variables_[variable.Id()] = {
+              pb.addVariable(-infinity,
+                             infinity,
+                             variable.Type() != Study::SystemModel::ValueType::FLOAT,
+                             component_.Id() + "." + variable.Id())};
+        }
+        setVariableBounds(variable);
+    }
+}
+
+// The series are read for the scenario of the problem, over its timesteps
+void ComponentFiller::resolveDataSeries(Optimisation::LinearProblemApi::ILinearProblemData& data,
+                                        const Optimisation::LinearProblemApi::FillContext& ctx)
+{
+    dataSeries_.clear();
+    const auto& parameterDataSeries = component_.getParameterDataSeries();
+    if (parameterDataSeries.empty())
+    {
+        return;
+    }
+    if (ctx.scenariosSelected.size() != 1)
+    {
+        throw std::invalid_argument("The problem of component '" + component_.Id()
+                                    + "' must be built for a single scenario, "
+                                    + std::to_string(ctx.scenariosSelected.size())
+                                    + " are selected");
+    }
+    const unsigned scenario = ctx.scenariosSelected.front();
+    for (const auto& [parameter, dataSetId]: parameterDataSeries)
+    {
+        auto series = data.getHandle(dataSetId, component_.getScenarioGroupId()).series(scenario);
+        if (series.size() <= ctx.getLastTimeStep())
+        {
+            throw std::out_of_range("Data series '" + dataSetId + "' of parameter '" + parameter
+                                    + "' of component '" + component_.Id() + "' has "
+                                    + std::to_string(series.size()) + " values, timestep "
+                                    + std::to_string(ctx.getLastTimeStep()) + " is out of range");
         }
+        dataSeries_[parameter] = series;
     }
 }
 
-void ComponentFiller::addStaticConstraint(Optimisation::LinearProblemApi::ILinearProblem& pb,
-                                          const LinearConstraint& linear_constraint,
-                                          const std::string& constraint_id) const
+std::vector<double> ComponentFiller::evaluateBound(const Expressions::Nodes::Node* node)
 {
-    auto* ct = pb.addConstraint(linear_constraint.lb,
-                                linear_constraint.ub,
-                                component_.Id() + "." + constraint_id);
-    for (auto [var_id, coef]: linear_constraint.coef_per_var)
+    const auto& program = compiled(node);
+    if (!program.variables.empty())
     {
-        auto* variable = pb.getVariable(component_.Id() + "." + var_id);
-        ct->setCoefficient(variable, coef);
+        throw std::out_of_range("Variable '" + program.variables.front()
+                                + "' used in a bound of component '" + component_.Id() + "'");
     }
+    Evaluator evaluator(bind(program));
+    return evaluateOverTime(evaluator, program.offset);
 }
 
-void ComponentFiller::addTimeDependentConstraints(
-  Optimisation::LinearProblemApi::ILinearProblem& pb,
-  const LinearConstraint& linear_constraint,
-  const std::string& constraint_id,
-  unsigned int nb_cstr) const
+// A static variable gets the bounds of the first timestep
+void ComponentFiller::setVariableBounds(const Study::SystemModel::Variable& variable)
 {
-    auto vect_ct = pb.addConstraint(linear_constraint.lb,
-                                    linear_constraint.ub,
-                                    component_.Id() + "." + constraint_id,
-                                    nb_cstr);
-    for (auto cstr(0); cstr < nb_cstr; ++cstr)
+    const auto lb = evaluateBound(variable.LowerBound().RootNode());
+    const auto ub = evaluateBound(variable.UpperBound().RootNode());
+    const auto& variables = variables_.at(variable.Id());
+    for (std::size_t i = 0; i < variables.size(); ++i)
     {
-        auto* ct = vect_ct[cstr];
-        for (const auto& [var_id, coef]: linear_constraint.coef_per_var)
-        {
-            // TODO FIXME the coefficient needs to be time-dependent
-            if (IsThisVariableTimeDependent(var_id))
-            {
-                auto* variable = pb.getVariable(component_.Id() + "." + var_id + '_'
-                                                + std::to_string(cstr));
-                ct->setCoefficient(variable, coef);
-            }
-            else
-            {
-                auto* variable = pb.getVariable(component_.Id() + "." + var_id);
-                ct->setCoefficient(variable, coef);
-            }
-        }
+        variables[i]->setBounds(lb[lb.size() > 1 ? i : 0], ub[ub.size() > 1 ? i : 0]);
     }
 }
 
@@ -124,27 +204,66 @@ void ComponentFiller::addConstraints(Optimisation::LinearProblemApi::ILinearProb
                                      Optimisation::LinearProblemApi::ILinearProblemData& data,
                                      Optimisation::LinearProblemApi::FillContext& ctx)
 {
-    ReadLinearConstraintVisitor visitor(evaluationContext_);
+    constraints_.clear();
+    // TODO timesteps will be a parameter
+    if (!checkTimeSteps(ctx))
+    {
+        return;
+    }
+    constexpr double infinity = std::numeric_limits<double>::infinity();
     for (const auto& constraint: component_.getModel()->getConstraints() | std::views::values)
     {
-        auto* root_node = constraint.expression().RootNode();
-        auto linear_constraint = visitor.dispatch(root_node);
-        // TODO timesteps will be a parameter
-        if (checkTimeSteps(ctx))
+        const auto name = component_.Id() + "." + constraint.Id();
+        // A static constraint is added once, with the values of the first timestep
+        if (IsThisConstraintTimeDependent(constraint.expression()))
         {
-            if (IsThisConstraintTimeDependent(root_node))
-
-            {
-                addTimeDependentConstraints(pb,
-                                            linear_constraint,
-                                            constraint.Id(),
-                                            ctx.getNumberOfTimestep());
-            }
-            else
-            {
-                addStaticConstraint(pb, linear_constraint, constraint.Id());
-            }
+            constraints_[constraint.Id()] = pb.addConstraint(-infinity,
+                                                             infinity,
+                                                             name,
+                                                             ctx.getNumberOfTimestep());
         }
+        else
+        {
+            constraints_[constraint.Id()] = {pb.addConstraint(-infinity, infinity, name)};
+        }
+        setConstraint(pb, constraint.Id());
+    }
+}
+
+// The variables of a compiled constraint only depend on its structure : a coefficient becoming
+// zero stays in the program, so overwriting the coefficients is enough to update it
+void ComponentFiller::setConstraint(Optimisation::LinearProblemApi::ILinearProblem& pb,
+                                    const std::string& constraint_id)
+{
+    const auto& constraints = constraints_.at(constraint_id);
+    const auto& [program, comparison] = compiledConstraint(constraint_id);
+    Evaluator evaluator(bind(program));
+    const bool timeDependent = constraints.size() > 1;
+    auto values = [&](const Code& code)
+    {
+        return timeDependent ? evaluateOverTime(evaluator, code)
+                             : std::vector{evaluator.run(code, firstTimeStep_)};
+    };
+
+    // left - right <comparison> 0, i.e. the bounds are the opposite of the offset
+    const auto offsets = values(program.offset);
+    for (std::size_t i = 0; i < constraints.size(); ++i)
+    {
+        const double bound = -offsets[offsets.size() > 1 ? i : 0];
+        constraints[i]->setBounds(
+          comparison == Comparison::LESS_THAN_OR_EQUAL ? -std::numeric_limits<double>::infinity()
+                                                       : bound,
+          comparison == Comparison::GREATER_THAN_OR_EQUAL ? std::numeric_limits<double>::infinity()
+                                                          : bound);
+    }
+
+    // One block per variable: a time-dependent variable has one column per constraint,
+    // the other ones a single column shared by all constraints
+    for (std::size_t slot = 0; slot < program.variables.size(); ++slot)
+    {
+        pb.setCoefficients(constraints,
+                           variables_.at(program.variables[slot]),
+                           values(program.coefficients[slot]));
     }
 }
 
@@ -152,53 +271,160 @@ void ComponentFiller::addObjective(Optimisation::LinearProblemApi::ILinearProble
                                    Optimisation::LinearProblemApi::ILinearProblemData& data,
                                    Optimisation::LinearProblemApi::FillContext& ctx)
 {
-    auto model = component_.getModel();
-    if (model->Objective().Empty())
+    if (component_.getModel()->Objective().Empty())
     {
         return;
     }
-    ReadLinearExpressionVisitor visitor(evaluationContext_);
-    auto linear_expression = visitor.dispatch(model->Objective().RootNode());
-    if (abs(linear_expression.offset()) > 1e-10)
+    setObjectiveCoefficients(pb);
+}
+
+void ComponentFiller::setObjectiveCoefficients(Optimisation::LinearProblemApi::ILinearProblem& pb)
+{
+    auto model = component_.getModel();
+    const auto& program = compiled(model->Objective().RootNode());
+    Evaluator evaluator(bind(program));
+    const auto offsets = evaluateOverTime(evaluator, program.offset);
+    if (std::ranges::any_of(offsets, [](double offset) { return std::abs(offset) > 1e-10; }))
     {
         throw std::invalid_argument("Antares does not support objective offsets (found in model '"
                                     + model->Id() + "' of component '" + component_.Id() + "').");
     }
 
-    for (auto [var_id, coef]: linear_expression.coefPerVar())
+    for (std::size_t slot = 0; slot < program.variables.size(); ++slot)
     {
-        if (IsThisVariableTimeDependent(var_id))
+        const auto& variables = variables_.at(program.variables[slot]);
+        auto coefficients = evaluateOverTime(evaluator, program.coefficients[slot]);
+        // A static variable gets the coefficient of the first timestep
+        if (variables.size() == 1)
         {
-            for (auto var_pos = 0; var_pos != ctx.getNumberOfTimestep(); ++var_pos)
-            {
-                auto* variable = pb.getVariable(component_.Id() + "." + var_id + '_'
-                                                + std::to_string(var_pos));
-                pb.setObjectiveCoefficient(variable, coef);
-            }
+            coefficients.resize(1);
         }
-        else
+        pb.setObjectiveCoefficients(variables, coefficients);
+    }
+}
+
+// Names of the parameters the expression refers to
+static void collectParameters(const Expressions::Nodes::Node* node,
+                              std::set<std::string>& parameters)
+{
+    using namespace Expressions::Nodes;
+    if (auto* parameter = dynamic_cast<const ParameterNode*>(node))
+    {
+        parameters.insert(parameter->value());
+    }
+    else if (auto* binary = dynamic_cast<const BinaryNode*>(node))
+    {
+        collectParameters(binary->left(), parameters);
+        collectParameters(binary->right(), parameters);
+    }
+    else if (auto* unary = dynamic_cast<const UnaryNode*>(node))
+    {
+        collectParameters(unary->child(), parameters);
+    }
+    else if (auto* sum = dynamic_cast<const SumNode*>(node))
+    {
+        for (const auto* operand: sum->getOperands())
         {
-            auto* variable = pb.getVariable(component_.Id() + "." + var_id);
-            pb.setObjectiveCoefficient(variable, coef);
+            collectParameters(operand, parameters);
         }
     }
 }
 
-bool ComponentFiller::IsThisConstraintTimeDependent(const Expressions::Nodes::Node* node)
+static std::set<std::string> collectParameters(const Study::SystemModel::Expression& expression)
 {
-    Expressions::Visitors::TimeIndexVisitor timeIndexVisitor;
-    const auto ret = timeIndexVisitor.dispatch(node);
-    return ret == Expressions::Visitors::TimeIndex::VARYING_IN_TIME_ONLY
-           || ret == Expressions::Visitors::TimeIndex::VARYING_IN_TIME_AND_SCENARIO;
+    std::set<std::string> parameters;
+    if (!expression.Empty())
+    {
+        collectParameters(expression.RootNode(), parameters);
+    }
+    return parameters;
 }
 
-// return false if the variable with the id var_id is not found or if it is not time-dependent
-bool ComponentFiller::IsThisVariableTimeDependent(const std::string& var_id) const
+const std::unordered_map<std::string, ComponentFiller::ParameterDependents>& ComponentFiller::
+  parameterDependents()
 {
-    if (const auto& it = modelVariable_.find(var_id); it != modelVariable_.end())
+    if (parameterDependents_)
+    {
+        return *parameterDependents_;
+    }
+    auto& dependents = parameterDependents_.emplace();
+    auto model = component_.getModel();
+    for (const auto& variable: model->Variables() | std::views::values)
     {
-        return it->second.isTimeDependent();
+        auto parameters = collectParameters(variable.LowerBound());
+        parameters.merge(collectParameters(variable.UpperBound()));
+        for (const auto& parameter: parameters)
+        {
+            dependents[parameter].variables.push_back(variable.Id());
+        }
     }
-    return false;
+    for (const auto& constraint: model->getConstraints() | std::views::values)
+    {
+        for (const auto& parameter: collectParameters(constraint.expression()))
+        {
+            dependents[parameter].constraints.push_back(constraint.Id());
+        }
+    }
+    for (const auto& parameter: collectParameters(model->Objective()))
+    {
+        dependents[parameter].objective = true;
+    }
+    return dependents;
+}
+
+bool ComponentFiller::setParameterValue(Optimisation::LinearProblemApi::ILinearProblem& pb,
+                                        const std::string& componentId,
+                                        const std::string& parameterId,
+                                        double value)
+{
+    if (componentId != component_.Id())
+    {
+        return false;
+    }
+    if (!component_.getParameterValues().contains(parameterId))
+    {
+        throw std::invalid_argument("Parameter '" + parameterId + "' not found in component '"
+                                    + component_.Id() + "'");
+    }
+    parameterValues_[parameterId] = value;
+
+    const auto& dependents = parameterDependents();
+    auto it = dependents.find(parameterId);
+    if (it == dependents.end())
+    {
+        return true;
+    }
+
+    const auto& modelVariables = component_.getModel()->Variables();
+    for (const auto& var_id: it->second.variables)
+    {
+        setVariableBounds(modelVariables.at(var_id));
+    }
+    for (const auto& constraint_id: it->second.constraints)
+    {
+        if (constraints_.contains(constraint_id))
+        {
+            setConstraint(pb, constraint_id);
+        }
+    }
+    if (it->second.objective)
+    {
+        setObjectiveCoefficients(pb);
+    }
+    return true;
+}
+
+bool ComponentFiller::IsThisConstraintTimeDependent(
+  const Study::SystemModel::Expression& expression)
+{
+    auto ret = expression.timeIndex();
+    if (!ret)
+    {
+        Expressions::Visitors::TimeIndexVisitor timeIndexVisitor;
+        ret = timeIndexVisitor.dispatch(expression.RootNode());
+    }
+    return ret == Expressions::Visitors::TimeIndex::VARYING_IN_TIME_ONLY
+           || ret == Expressions::Visitors::TimeIndex::VARYING_IN_TIME_AND_SCENARIO;
 }
+
 } // namespace Antares::Optimization
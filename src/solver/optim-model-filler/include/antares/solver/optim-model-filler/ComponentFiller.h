@@ -21,11 +21,16 @@
 
 #pragma once
 
+#include <map>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <antares/expressions/bytecode/Program.h>
 #include <antares/optimisation/linear-problem-api/linearProblemFiller.h>
 #include <antares/study/system-model/component.h>
-#include "antares/expressions/visitors/EvaluationContext.h"
-
-#include "ReadLinearConstraintVisitor.h"
 
 namespace Antares::Study::SystemModel
 {
@@ -33,9 +38,10 @@ class Component;
 class Variable;
 } // namespace Antares::Study::SystemModel
 
-namespace Antares::Expressions::Visitors
+namespace Antares::Expressions::Bytecode
 {
-class EvalVisitor;
+class Evaluator;
+struct ParameterValues;
 }
 
 namespace Antares::Optimization
@@ -57,15 +63,6 @@ public:
                       Optimisation::LinearProblemApi::ILinearProblemData& data,
                       Optimisation::LinearProblemApi::FillContext& ctx) override;
 
-    void addStaticConstraint(Optimisation::LinearProblemApi::ILinearProblem& pb,
-                             const LinearConstraint& linear_constraint,
-                             const std::string& constraint_id) const;
-
-    void addTimeDependentConstraints(Optimisation::LinearProblemApi::ILinearProblem& pb,
-                                     const LinearConstraint& linear_constraint,
-                                     const std::string& constraint_id,
-                                     unsigned int nb_cstr) const;
-
     void addConstraints(Optimisation::LinearProblemApi::ILinearProblem& pb,
                         Optimisation::LinearProblemApi::ILinearProblemData& data,
                         Optimisation::LinearProblemApi::FillContext& ctx) override;
@@ -73,13 +70,64 @@ public:
                       Optimisation::LinearProblemApi::ILinearProblemData& data,
                       Optimisation::LinearProblemApi::FillContext& ctx) override;
 
+    /// Change the value of a parameter of the component in the elements already added to pb
+    bool setParameterValue(Optimisation::LinearProblemApi::ILinearProblem& pb,
+                           const std::string& componentId,
+                           const std::string& parameterId,
+                           double value) override;
+
 private:
-    static bool IsThisConstraintTimeDependent(const Expressions::Nodes::Node* node);
+    static bool IsThisConstraintTimeDependent(const Study::SystemModel::Expression& expression);
+
+    /// Elements of the model whose expressions refer to a parameter
+    struct ParameterDependents
+    {
+        /// Ids of the variables whose bounds depend on the parameter
+        std::vector<std::string> variables;
+        /// Ids of the constraints whose bounds or coefficients depend on the parameter
+        std::vector<std::string> constraints;
+        bool objective = false;
+    };
+
+    /// Dependents of each parameter, indexed at the first parameter change only
+    const std::unordered_map<std::string, ParameterDependents>& parameterDependents();
+
+    /// Programs of the model expressions, compiled at their first evaluation
+    const Expressions::Bytecode::Program& compiled(const Expressions::Nodes::Node* node);
+    const Expressions::Bytecode::ConstraintProgram& compiledConstraint(
+      const std::string& constraint_id);
+    std::vector<Expressions::Bytecode::ParameterValues> bind(
+      const Expressions::Bytecode::Program& program) const;
+    std::vector<double> evaluateOverTime(Expressions::Bytecode::Evaluator& evaluator,
+                                         const Expressions::Bytecode::Code& code) const;
+    std::vector<double> evaluateBound(const Expressions::Nodes::Node* node);
+
+    void resolveDataSeries(Optimisation::LinearProblemApi::ILinearProblemData& data,
+                           const Optimisation::LinearProblemApi::FillContext& ctx);
+    void setVariableBounds(const Study::SystemModel::Variable& variable);
 
-    bool IsThisVariableTimeDependent(const std::string& var_id) const;
+    /// Set the bounds and the coefficients of a constraint already added to the problem
+    void setConstraint(Optimisation::LinearProblemApi::ILinearProblem& pb,
+                       const std::string& constraint_id);
+    void setObjectiveCoefficients(Optimisation::LinearProblemApi::ILinearProblem& pb);
 
     const Study::SystemModel::Component& component_;
-    Expressions::Visitors::EvaluationContext evaluationContext_;
-    const std::map<std::string, Study::SystemModel::Variable>& modelVariable_;
+    /// Current values of the parameters, bound by address to the evaluated programs
+    std::map<std::string, double> parameterValues_;
+    /// Values of the parameters read from a data series, for the scenario of the problem
+    std::map<std::string, std::span<const double>> dataSeries_;
+    std::unordered_map<const Expressions::Nodes::Node*, Expressions::Bytecode::Program> programs_;
+    std::unordered_map<std::string, Expressions::Bytecode::ConstraintProgram> constraintPrograms_;
+    /// Timesteps of the problem, set when the variables are added
+    unsigned int firstTimeStep_ = 0;
+    unsigned int nbTimeSteps_ = 1;
+    /// Variables added to the problem, per model variable id : one per timestep if the variable
+    /// is time-dependent, a single one otherwise. Resolved once, when the variables are added
+    std::unordered_map<std::string, std::vector<Optimisation::LinearProblemApi::IMipVariable*>>
+      variables_;
+    /// Constraints added to the problem, per model constraint id
+    std::unordered_map<std::string, std::vector<Optimisation::LinearProblemApi::IMipConstraint*>>
+      constraints_;
+    std::optional<std::unordered_map<std::string, ParameterDependents>> parameterDependents_;
 };
 } // namespace Antares::Optimization
@@ -19,9 +19,11 @@
 ** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
 */
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 
+#include <antares/concurrency/concurrency.h>
 #include <antares/exception/AssertionError.hpp>
 #include <antares/logs/logs.h>
 #include <antares/study/study.h>
@@ -267,47 +269,69 @@ static void RunAccurateShavePeaks(const Data::AreaList& areas,
                                   uint numSpace,
                                   uint firstHourOfWeek)
 {
-    areas.each(
-      [&](const Data::Area& area)
-      {
-          auto& weeklyResults = problem.ResultatsHoraires[area.index];
-
-          const auto load = extractLoadForCurrentWeek(area, problem.year, firstHourOfWeek);
-          auto& unsupE = weeklyResults.ValeursHorairesDeDefaillancePositive;
-          auto& hydroGen = weeklyResults.TurbinageHoraire;
-          auto& levels = weeklyResults.niveauxHoraires;
-          const auto DispatchGen = computeTotalGenWithoutHydro(load, unsupE, hydroGen);
-          const auto& hydroPmax = problem.CaracteristiquesHydrauliques[area.index]
-                                    .ContrainteDePmaxHydrauliqueHoraire;
-          const auto hydroPmin = extractHydroPmin(area, problem.year, firstHourOfWeek);
-          const double initLevel = problem.CaracteristiquesHydrauliques[area.index]
-                                     .NiveauInitialReservoir;
-          const double capacity = area.hydro.reservoirCapacity;
-          const auto& inflows = problem.CaracteristiquesHydrauliques[area.index]
-                                  .ApportNaturelHoraire;
-          const auto& ovf = weeklyResults.debordementsHoraires;
-          const auto& pump = weeklyResults.PompageHoraire;
-          const auto& spillage = weeklyResults.ValeursHorairesDeDefaillanceNegative;
-
-          const auto& dtgMrgArray = area.scratchpad[numSpace].dispatchableGenerationMargin;
-          const std::vector<double> dtgMrg(dtgMrgArray, dtgMrgArray + HOURS_IN_WEEK);
-
-          auto [H, U, L] = shavePeaksByRemixingHydro(DispatchGen,
-                                                     hydroGen,
-                                                     unsupE,
-                                                     hydroPmax,
-                                                     hydroPmin,
-                                                     initLevel,
-                                                     capacity,
-                                                     inflows,
-                                                     ovf,
-                                                     pump,
-                                                     spillage,
-                                                     dtgMrg);
-          hydroGen = H;
-          unsupE = U;
-          levels = L;
-      });
+    auto remixArea = [&](const Data::Area& area)
+    {
+        auto& weeklyResults = problem.ResultatsHoraires[area.index];
+
+        const auto load = extractLoadForCurrentWeek(area, problem.year, firstHourOfWeek);
+        auto& unsupE = weeklyResults.ValeursHorairesDeDefaillancePositive;
+        auto& hydroGen = weeklyResults.TurbinageHoraire;
+        auto& levels = weeklyResults.niveauxHoraires;
+        const auto DispatchGen = computeTotalGenWithoutHydro(load, unsupE, hydroGen);
+        const auto& hydroPmax = problem.CaracteristiquesHydrauliques[area.index]
+                                  .ContrainteDePmaxHydrauliqueHoraire;
+        const auto hydroPmin = extractHydroPmin(area, problem.year, firstHourOfWeek);
+        const double initLevel = problem.CaracteristiquesHydrauliques[area.index]
+                                   .NiveauInitialReservoir;
+        const double capacity = area.hydro.reservoirCapacity;
+        const auto& inflows = problem.CaracteristiquesHydrauliques[area.index]
+                                .ApportNaturelHoraire;
+        const auto& ovf = weeklyResults.debordementsHoraires;
+        const auto& pump = weeklyResults.PompageHoraire;
+        const auto& spillage = weeklyResults.ValeursHorairesDeDefaillanceNegative;
+
+        const auto& dtgMrgArray = area.scratchpad[numSpace].dispatchableGenerationMargin;
+        const std::vector<double> dtgMrg(dtgMrgArray, dtgMrgArray + HOURS_IN_WEEK);
+
+        auto [H, U, L] = shavePeaksByRemixingHydro(DispatchGen,
+                                                   hydroGen,
+                                                   unsupE,
+                                                   hydroPmax,
+                                                   hydroPmin,
+                                                   initLevel,
+                                                   capacity,
+                                                   inflows,
+                                                   ovf,
+                                                   pump,
+                                                   spillage,
+                                                   dtgMrg);
+        hydroGen = H;
+        unsupE = U;
+        levels = L;
+    };
+
+    // Each area only writes its own results: they can be remixed independently
+    const uint nbThreads = std::min<uint>(problem.areaThreadCount, areas.size());
+    if (nbThreads <= 1)
+    {
+        areas.each(remixArea);
+        return;
+    }
+
+    Yuni::Job::QueueService queue;
+    queue.maximumThreadCount(nbThreads);
+
+    Concurrency::FutureSet results;
+    for (uint i = 0; i < areas.size(); ++i)
+    {
+        results.add(Concurrency::AddTask(queue,
+                                         [&remixArea, &areas, i] { remixArea(*areas.byIndex[i]); }));
+    }
+
+    queue.start();
+    queue.wait(Yuni::qseIdle);
+    queue.stop();
+    results.join();
 }
 
 void RemixHydroForAllAreas(const Data::AreaList& areas,
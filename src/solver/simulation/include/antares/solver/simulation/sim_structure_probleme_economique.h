@@ -537,6 +537,8 @@ struct PROBLEME_HEBDO
 
     uint32_t HeureDansLAnnee = 0;
     bool LeProblemeADejaEteInstancie = false;
+    // Threads that may be used to process the areas of this problem in parallel
+    uint32_t areaThreadCount = 1;
     bool firstWeekOfSimulation = false;
 
     std::vector<CORRESPONDANCES_DES_VARIABLES> CorrespondanceVarNativesVarOptim;
@@ -32,6 +32,7 @@
 #include "antares/solver/misc/options.h"
 #include "antares/solver/simulation/solver.data.h"
 #include "antares/solver/simulation/solver_utils.h"
+#include "antares/solver/ts-generator/archive.h"
 #include "antares/solver/variable/state.h"
 
 namespace Antares::Solver::Simulation
@@ -150,6 +151,11 @@ private:
     //! Statistics about annual (system and solution) costs
     annualCostsStatistics pAnnualStatistics;
 
+    //! Hydro allocation problems, for each numSpace (reused from one year to the next)
+    std::vector<HydroProblems> pHydroProblems;
+    //! Number of sets of hydro problems per numSpace, i.e. of threads for the ventilation
+    uint pHydroProblemsPerSpace = 1;
+
     // Collecting durations inside the simulation
     Benchmarking::DurationCollector& pDurationCollector;
 
@@ -158,6 +164,8 @@ public:
     std::shared_ptr<Yuni::Job::QueueService> pQueueService = nullptr;
     //! Result writer
     Antares::Solver::IResultWriter& pResultWriter;
+    //! Archive of the generated time-series, written while the simulation goes on
+    TSGenerator::TimeSeriesArchive pTSArchive;
 
     std::reference_wrapper<ISimulationObserver> simulationObserver_;
 }; // class ISimulation
@@ -21,6 +21,8 @@
 #ifndef __SOLVER_SIMULATION_SOLVER_HXX__
 #define __SOLVER_SIMULATION_SOLVER_HXX__
 
+#include <span>
+
 #include <yuni/io/io.h>
 
 #include <antares/antares/fatal-error.h>
@@ -33,6 +35,7 @@
 #include "antares/solver/simulation/opt_time_writer.h"
 #include "antares/solver/simulation/timeseries-numbers.h"
 #include "antares/solver/ts-generator/generator.h"
+#include "antares/solver/ts-generator/parallel.h"
 #include "antares/solver/variable/print.h"
 
 namespace Antares::Solver::Simulation
@@ -153,7 +156,14 @@ public:
 
             // 4 - Hydraulic ventilation
             pDurationCollector("hydro_ventilation") << [this, &scratchmap, &randomReservoirLevel]
-            { hydroManagement.makeVentilation(randomReservoirLevel.data(), y, scratchmap); };
+            {
+                const uint nbSets = simulation_->pHydroProblemsPerSpace;
+                hydroManagement.makeVentilation(
+                  randomReservoirLevel.data(),
+                  y,
+                  scratchmap,
+                  std::span(simulation_->pHydroProblems).subspan(numSpace * nbSets, nbSets));
+            };
 
             // Updating the state
             auto& state = states[numSpace];
@@ -235,6 +245,9 @@ inline ISimulation<ImplementationType>::ISimulation(
     pDurationCollector(duration_collector),
     pQueueService(study.pQueueService),
     pResultWriter(resultWriter),
+    pTSArchive(resultWriter,
+               study.parameters.timeSeriesArchiveFormat,
+               TSGenerator::generationThreadCount(study)),
     simulationObserver_(simulationObserver)
 {
     // Ask to the interface to show the messages
@@ -298,6 +311,7 @@ void ISimulation<ImplementationType>::run()
         logs.info() << " Only the preprocessors are enabled.";
 
         regenerateTimeSeries(0);
+        pTSArchive.flush();
 
         // Destroy the TS Generators if any
         // It will export the time-series into the output in the same time
@@ -330,12 +344,19 @@ void ISimulation<ImplementationType>::run()
         {
             ImplementationType::initializeState(state[numSpace], numSpace);
         }
+        // Hydro allocation problems, reused by all the years run in a same numSpace. The cores
+        // left by the parallel years are given to the hydro ventilation of each year.
+        pHydroProblemsPerSpace = study.getNumberOfCoresPerParallelYear();
+        pHydroProblems.resize(pNbMaxPerformedYearsInParallel * pHydroProblemsPerSpace);
 
         uint finalYear = 1 + study.runtime.rangeLimits.year[Data::rangeEnd];
         {
             pDurationCollector("mc_years")
               << [finalYear, &state, this] { loopThroughYears(0, finalYear, state); };
         }
+        // The hydro allocation problems are not needed anymore
+        pHydroProblems.clear();
+
         // Destroy the TS Generators if any
         // It will export the time-series into the output in the same time
         TSGenerator::DestroyAll(study);
@@ -414,29 +435,54 @@ void ISimulation<ImplementationType>::regenerateTimeSeries(uint year)
     // * Both options "Preprocessor" and "Refresh" are checked in the interface
     //   _and_ the refresh must be done for the given year (always done for the first year).
     using namespace TSGenerator;
-    // Load
+
+    // Load, solar and wind : each XCast generator has its own random numbers and its own
+    // series, they can run concurrently without changing the results
+    std::vector<std::function<void(unsigned int)>> xcastGenerations;
     if (pData.haveToRefreshTSLoad && (year % pData.refreshIntervalLoad == 0))
     {
-        pDurationCollector("tsgen_load")
-          << [year, this] { GenerateTimeSeries<Data::timeSeriesLoad>(study, year, pResultWriter); };
+        xcastGenerations.push_back(
+          [year, this](unsigned int nbThreads)
+          {
+              pDurationCollector("tsgen_load") << [year, nbThreads, this]
+              { GenerateTimeSeries<Data::timeSeriesLoad>(study, year, pTSArchive, nbThreads); };
+          });
     }
-    // Solar
     if (pData.haveToRefreshTSSolar && (year % pData.refreshIntervalSolar == 0))
     {
-        pDurationCollector("tsgen_solar") << [year, this]
-        { GenerateTimeSeries<Data::timeSeriesSolar>(study, year, pResultWriter); };
+        xcastGenerations.push_back(
+          [year, this](unsigned int nbThreads)
+          {
+              pDurationCollector("tsgen_solar") << [year, nbThreads, this]
+              { GenerateTimeSeries<Data::timeSeriesSolar>(study, year, pTSArchive, nbThreads); };
+          });
     }
-    // Wind
     if (pData.haveToRefreshTSWind && (year % pData.refreshIntervalWind == 0))
     {
-        pDurationCollector("tsgen_wind")
-          << [year, this] { GenerateTimeSeries<Data::timeSeriesWind>(study, year, pResultWriter); };
+        xcastGenerations.push_back(
+          [year, this](unsigned int nbThreads)
+          {
+              pDurationCollector("tsgen_wind") << [year, nbThreads, this]
+              { GenerateTimeSeries<Data::timeSeriesWind>(study, year, pTSArchive, nbThreads); };
+          });
     }
+    // The generators share the threads : each one gets its part of them
+    const unsigned int nbThreads = generationThreadCount(study);
+    const auto nbGenerations = (unsigned int)xcastGenerations.size();
+    generateInParallel(std::min(nbThreads, nbGenerations),
+                       nbGenerations,
+                       [&xcastGenerations, nbThreads, nbGenerations](std::size_t i)
+                       {
+                           unsigned int share = nbThreads / nbGenerations
+                                                + (i < nbThreads % nbGenerations ? 1 : 0);
+                           xcastGenerations[i](std::max(1u, share));
+                       });
+
     // Hydro
     if (pData.haveToRefreshTSHydro && (year % pData.refreshIntervalHydro == 0))
     {
-        pDurationCollector("tsgen_hydro") << [year, this]
-        { GenerateTimeSeries<Data::timeSeriesHydro>(study, year, pResultWriter); };
+        pDurationCollector("tsgen_hydro") << [year, nbThreads, this]
+        { GenerateTimeSeries<Data::timeSeriesHydro>(study, year, pTSArchive, nbThreads); };
     }
 
     // Thermal
@@ -449,15 +495,16 @@ void ISimulation<ImplementationType>::regenerateTimeSeries(uint year)
             auto clusters = getAllClustersToGen(study.areas, pData.haveToRefreshTSThermal);
             generateThermalTimeSeries(study,
                                       clusters,
-                                      study.runtime.random[Data::seedTsGenThermal]);
+                                      study.runtime.random[Data::seedTsGenThermal],
+                                      year);
 
             bool archive = study.parameters.timeSeriesToArchive & Data::timeSeriesThermal;
             bool doWeWrite = archive && !study.parameters.noOutput;
             if (doWeWrite)
             {
-                fs::path savePath = study.folderOutput / "ts-generator" / "thermal" / "mc-"
-                                    / std::to_string(year);
-                writeThermalTimeSeries(clusters, savePath);
+                fs::path folder = fs::path("ts-generator") / "thermal"
+                                  / ("mc-" + std::to_string(year));
+                writeThermalTimeSeries(clusters, pTSArchive, folder);
             }
 
             // apply the spinning if we generated some in memory clusters
@@ -670,20 +717,21 @@ void ISimulation<ImplementationType>::computeRandomNumbers(
         const unsigned int nbAreas = study.areas.size();
 
         // ... Thermal noise ...
+        // One noise per cluster, in the order of their area-wide index
+        auto& randomThermal = study.runtime.random[Data::seedThermalCosts];
         for (unsigned int a = 0; a != nbAreas; ++a)
         {
-            // logs.info() << "   area : " << a << " :";
             const auto& area = *(study.areas.byIndex[a]);
-
-            for (auto& cluster: area.thermal.list.all())
+            const uint nbClusters = area.thermal.list.allClustersCount();
+            if (isPerformed)
             {
-                uint clusterIndex = cluster->areaWideIndex;
-                double thermalNoise = study.runtime.random[Data::seedThermalCosts].next();
-                if (isPerformed)
-                {
-                    randomForYears.pYears[indexYear].pThermalNoisesByArea[a][clusterIndex]
-                      = thermalNoise;
-                }
+                auto& thermalNoises = randomForYears.pYears[indexYear].pThermalNoisesByArea[a];
+                assert(thermalNoises.size() == nbClusters);
+                randomThermal.generate(thermalNoises.data(), nbClusters);
+            }
+            else
+            {
+                randomThermal.discard(nbClusters);
             }
         }
 
@@ -797,9 +845,9 @@ void ISimulation<ImplementationType>::computeRandomNumbers(
                     auto& noise = randomForYears.pYears[indexYear]
                                     .pHydroCostsByArea_freeMod[areaIndex];
                     std::set<hydroCostNoise, compareHydroCostsNoises> setHydroCostsNoises;
+                    randomHydro.generate(noise.data(), 8784);
                     for (uint j = 0; j != 8784; ++j)
                     {
-                        noise[j] = randomHydro();
                         noise[j] -= 0.5; // Now we have : -0.5 < noise[j] < +0.5
 
                         // This std::set naturally sorts the hydro costs noises into increasing
@@ -831,13 +879,7 @@ void ISimulation<ImplementationType>::computeRandomNumbers(
             }
             else
             {
-                for (auto i = study.areas.begin(); i != end; ++i)
-                {
-                    for (uint j = 0; j != 8784; ++j)
-                    {
-                        randomHydro();
-                    }
-                }
+                randomHydro.discard(8784 * (std::size_t)study.areas.size());
             }
 
             break;
@@ -1037,8 +1079,16 @@ void ISimulation<ImplementationType>::loopThroughYears(uint firstYear,
         pQueueService->wait(Yuni::qseIdle);
         pQueueService->stop();
         results.join();
+        // The series archived meanwhile must reach the writer before it is flushed
+        pTSArchive.flush();
         pResultWriter.flush();
 
+        if (study.timeSeriesColumnCache)
+        {
+            // No year of the set is running anymore : the columns they read can be evicted
+            study.timeSeriesColumnCache->unpinAll();
+        }
+
         // At this point, the first set of parallel year(s) was run with at least one year
         // performed
         if (!pFirstSetParallelWithAPerformedYearWasRun && yearPerformed)
@@ -1079,6 +1129,14 @@ void ISimulation<ImplementationType>::loopThroughYears(uint firstYear,
     // Writing annual costs statistics
     pAnnualStatistics.endStandardDeviations();
     pAnnualStatistics.writeToOutput(pResultWriter);
+
+    if (study.timeSeriesColumnCache)
+    {
+        const auto stats = study.timeSeriesColumnCache->statistics();
+        logs.info() << "Time-series read on demand: " << stats.misses << " columns read, "
+                    << stats.hits << " cache hits, " << stats.evictions << " evictions, peak "
+                    << (stats.peakBytes / (1024 * 1024)) << " MB";
+    }
 }
 
 } // namespace Antares::Solver::Simulation
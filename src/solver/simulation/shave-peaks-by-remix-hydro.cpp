@@ -1,61 +1,144 @@
 #include "include/antares/solver/simulation/shave-peaks-by-remix-hydro.h"
 
 #include <algorithm>
+#include <limits>
 #include <ranges>
+#include <set>
 #include <stdexcept>
 #include <vector>
 
 namespace Antares::Solver::Simulation
 {
 
-int find_min_index(const std::vector<double>& TotalGen,
-                   const std::vector<double>& OutUnsupE,
-                   const std::vector<double>& OutHydroGen,
-                   const std::vector<bool>& triedBottom,
-                   const std::vector<double>& HydroPmax,
-                   const std::vector<bool>& enabledHours,
-                   double top)
+namespace
 {
-    double min_val = top;
-    int min_hour = -1;
-    for (unsigned int h = 0; h < TotalGen.size(); ++h)
+/*!
+** \brief Orders hours by total generation, ties being broken by increasing hour.
+**
+** This is the order in which a linear scan keeping the first strict extremum visits them.
+*/
+struct LowestGenerationFirst
+{
+    const std::vector<double>* TotalGen;
+
+    bool operator()(unsigned int a, unsigned int b) const
     {
-        if (OutUnsupE[h] > 0 && OutHydroGen[h] < HydroPmax[h] && !triedBottom[h] && enabledHours[h])
+        const auto& gen = *TotalGen;
+        return gen[a] < gen[b] || (gen[a] == gen[b] && a < b);
+    }
+};
+
+struct HighestGenerationFirst
+{
+    const std::vector<double>* TotalGen;
+
+    bool operator()(unsigned int a, unsigned int b) const
+    {
+        const auto& gen = *TotalGen;
+        return gen[a] > gen[b] || (gen[a] == gen[b] && a < b);
+    }
+};
+
+/*!
+** \brief Minimum and maximum of the reservoir levels over ranges of hours
+**
+** Iterative segment tree. Moving hydro generation between two hours only changes the levels
+** after the first of them, so only that part of the tree is refreshed.
+*/
+class LevelsRange
+{
+public:
+    explicit LevelsRange(const std::vector<double>& levels):
+        size_(levels.size()),
+        min_(2 * size_),
+        max_(2 * size_)
+    {
+        update(levels, 0);
+    }
+
+    //! Refresh the levels of hours [from, size)
+    void update(const std::vector<double>& levels, size_t from)
+    {
+        for (size_t h = from; h < size_; ++h)
+        {
+            min_[size_ + h] = levels[h];
+            max_[size_ + h] = levels[h];
+        }
+        size_t first = from + size_;
+        size_t last = 2 * size_;
+        while (first > 1)
         {
-            if (TotalGen[h] < min_val)
+            first /= 2;
+            last = (last - 1) / 2 + 1;
+            for (size_t node = first; node < last; ++node)
             {
-                min_val = TotalGen[h];
-                min_hour = h;
+                min_[node] = std::min(min_[2 * node], min_[2 * node + 1]);
+                max_[node] = std::max(max_[2 * node], max_[2 * node + 1]);
             }
         }
     }
-    return min_hour;
-}
 
-int find_max_index(const std::vector<double>& TotalGen,
-                   const std::vector<double>& OutHydroGen,
-                   const std::vector<bool>& triedPeak,
-                   const std::vector<double>& HydroPmin,
-                   const std::vector<bool>& enabledHours,
-                   double ref_value,
-                   double eps)
-{
-    double max_val = 0;
-    int max_hour = -1;
-    for (unsigned int h = 0; h < TotalGen.size(); ++h)
+    //! Minimum level over hours [first, last), the range must not be empty
+    double min(size_t first, size_t last) const
+    {
+        double result = std::numeric_limits<double>::infinity();
+        for (first += size_, last += size_; first < last; first /= 2, last /= 2)
+        {
+            if (first & 1)
+            {
+                result = std::min(result, min_[first++]);
+            }
+            if (last & 1)
+            {
+                result = std::min(result, min_[--last]);
+            }
+        }
+        return result;
+    }
+
+    //! Maximum level over hours [first, last), the range must not be empty
+    double max(size_t first, size_t last) const
     {
-        if (OutHydroGen[h] > HydroPmin[h] && TotalGen[h] >= ref_value + eps && !triedPeak[h]
-            && enabledHours[h])
+        double result = -std::numeric_limits<double>::infinity();
+        for (first += size_, last += size_; first < last; first /= 2, last /= 2)
         {
-            if (TotalGen[h] > max_val)
+            if (first & 1)
+            {
+                result = std::max(result, max_[first++]);
+            }
+            if (last & 1)
             {
-                max_val = TotalGen[h];
-                max_hour = h;
+                result = std::max(result, max_[--last]);
             }
         }
+        return result;
+    }
+
+private:
+    size_t size_;
+    std::vector<double> min_;
+    std::vector<double> max_;
+};
+
+void computeLevels(std::vector<double>& levels,
+                   size_t from,
+                   double initial_level,
+                   const std::vector<double>& inflows,
+                   const std::vector<double>& overflow,
+                   const std::vector<double>& pump,
+                   const std::vector<double>& HydroGen)
+{
+    if (from == 0)
+    {
+        levels[0] = initial_level + inflows[0] - overflow[0] + pump[0] - HydroGen[0];
+        from = 1;
+    }
+    for (size_t h = from; h < levels.size(); ++h)
+    {
+        levels[h] = levels[h - 1] + inflows[h] - overflow[h] + pump[h] - HydroGen[h];
     }
-    return max_hour;
 }
+} // namespace
 
 static bool operator<=(const std::vector<double>& a, const std::vector<double>& b)
 {
@@ -156,11 +239,7 @@ RemixHydroOutput shavePeaksByRemixingHydro(const std::vector<double>& DispatchGe
     std::vector<double> levels(DispatchGen.size());
     if (!levels.empty())
     {
-        levels[0] = initial_level + inflows[0] - overflow[0] + pump[0] - HydroGen[0];
-        for (size_t h = 1; h < levels.size(); ++h)
-        {
-            levels[h] = levels[h - 1] + inflows[h] - overflow[h] + pump[h] - HydroGen[h];
-        }
+        computeLevels(levels, 0, initial_level, inflows, overflow, pump, HydroGen);
     }
 
     checkInputCorrectness(DispatchGen,
@@ -202,89 +281,79 @@ RemixHydroOutput shavePeaksByRemixingHydro(const std::vector<double>& DispatchGe
                    TotalGen.begin(),
                    std::plus<>());
 
+    // Hours that can still receive hydro generation (bottoms) or give some (peaks), ordered as
+    // they have to be tried. Only the two hours involved in a move need to be re-sorted.
+    auto isBottom = [&](unsigned int h)
+    {
+        return OutUnsupE[h] > 0 && OutHydroGen[h] < HydroPmax[h] && enabledHours[h]
+               && TotalGen[h] < top;
+    };
+    auto isPeak = [&](unsigned int h)
+    { return OutHydroGen[h] > HydroPmin[h] && enabledHours[h] && TotalGen[h] > 0; };
+
+    std::set<unsigned int, LowestGenerationFirst> bottoms(LowestGenerationFirst{&TotalGen});
+    std::set<unsigned int, HighestGenerationFirst> peaks(HighestGenerationFirst{&TotalGen});
+    for (unsigned int h = 0; h < TotalGen.size(); ++h)
+    {
+        if (isBottom(h))
+        {
+            bottoms.insert(h);
+        }
+        if (isPeak(h))
+        {
+            peaks.insert(h);
+        }
+    }
+
+    LevelsRange levelsRange(levels);
+
     while (loop-- > 0)
     {
-        std::vector<bool> triedBottom(DispatchGen.size(), false);
         double delta = 0;
+        unsigned int hourBottom = 0;
+        unsigned int hourPeak = 0;
 
-        while (true)
+        for (unsigned int bottom: bottoms)
         {
-            int hourBottom = find_min_index(TotalGen,
-                                            OutUnsupE,
-                                            OutHydroGen,
-                                            triedBottom,
-                                            HydroPmax,
-                                            enabledHours,
-                                            top);
-            if (hourBottom == -1)
+            for (unsigned int peak: peaks)
             {
-                break;
-            }
-
-            std::vector<bool> triedPeak(DispatchGen.size(), false);
-            while (true)
-            {
-                int hourPeak = find_max_index(TotalGen,
-                                              OutHydroGen,
-                                              triedPeak,
-                                              HydroPmin,
-                                              enabledHours,
-                                              TotalGen[hourBottom],
-                                              eps);
-                if (hourPeak == -1)
+                if (TotalGen[peak] < TotalGen[bottom] + eps)
                 {
                     break;
                 }
 
-                std::vector<double> intermediate_level(levels.begin()
-                                                         + std::min(hourBottom, hourPeak),
-                                                       levels.begin()
-                                                         + std::max(hourBottom, hourPeak));
                 double max_pic, max_creux;
-                if (hourBottom < hourPeak)
+                if (bottom < peak)
                 {
                     max_pic = capa;
-                    max_creux = *std::min_element(intermediate_level.begin(),
-                                                  intermediate_level.end());
+                    max_creux = levelsRange.min(bottom, peak);
                 }
                 else
                 {
-                    max_pic = capa
-                              - *std::max_element(intermediate_level.begin(),
-                                                  intermediate_level.end());
+                    max_pic = capa - levelsRange.max(peak, bottom);
                     max_creux = capa;
                 }
 
-                max_pic = std::min(OutHydroGen[hourPeak] - HydroPmin[hourPeak], max_pic);
-                max_creux = std::min({HydroPmax[hourBottom] - OutHydroGen[hourBottom],
-                                      OutUnsupE[hourBottom],
-                                      max_creux});
+                max_pic = std::min(OutHydroGen[peak] - HydroPmin[peak], max_pic);
+                max_creux = std::min(
+                  {HydroPmax[bottom] - OutHydroGen[bottom], OutUnsupE[bottom], max_creux});
 
-                double dif_pic_creux = std::max(TotalGen[hourPeak] - TotalGen[hourBottom], 0.);
+                double dif_pic_creux = std::max(TotalGen[peak] - TotalGen[bottom], 0.);
 
                 delta = std::max(std::min({max_pic, max_creux, dif_pic_creux / 2.}), 0.);
 
                 if (delta > 0)
                 {
-                    OutHydroGen[hourPeak] -= delta;
-                    OutHydroGen[hourBottom] += delta;
-                    OutUnsupE[hourPeak] = HydroGen[hourPeak] + UnsupE[hourPeak]
-                                          - OutHydroGen[hourPeak];
-                    OutUnsupE[hourBottom] = HydroGen[hourBottom] + UnsupE[hourBottom]
-                                            - OutHydroGen[hourBottom];
+                    hourBottom = bottom;
+                    hourPeak = peak;
                     break;
                 }
-                else
-                {
-                    triedPeak[hourPeak] = true;
-                }
             }
 
             if (delta > 0)
             {
                 break;
             }
-            triedBottom[hourBottom] = true;
         }
 
         if (delta == 0)
@@ -292,16 +361,40 @@ RemixHydroOutput shavePeaksByRemixingHydro(const std::vector<double>& DispatchGe
             break;
         }
 
-        std::transform(DispatchGen.begin(),
-                       DispatchGen.end(),
-                       OutHydroGen.begin(),
-                       TotalGen.begin(),
-                       std::plus<>());
-        levels[0] = initial_level + inflows[0] - overflow[0] + pump[0] - OutHydroGen[0];
-        for (size_t h = 1; h < levels.size(); ++h)
+        for (unsigned int h: {hourPeak, hourBottom})
+        {
+            bottoms.erase(h);
+            peaks.erase(h);
+        }
+
+        OutHydroGen[hourPeak] -= delta;
+        OutHydroGen[hourBottom] += delta;
+        OutUnsupE[hourPeak] = HydroGen[hourPeak] + UnsupE[hourPeak] - OutHydroGen[hourPeak];
+        OutUnsupE[hourBottom] = HydroGen[hourBottom] + UnsupE[hourBottom]
+                                - OutHydroGen[hourBottom];
+
+        for (unsigned int h: {hourPeak, hourBottom})
         {
-            levels[h] = levels[h - 1] + inflows[h] - overflow[h] + pump[h] - OutHydroGen[h];
+            TotalGen[h] = DispatchGen[h] + OutHydroGen[h];
+            if (isBottom(h))
+            {
+                bottoms.insert(h);
+            }
+            if (isPeak(h))
+            {
+                peaks.insert(h);
+            }
         }
+
+        const size_t firstChangedLevel = std::min(hourBottom, hourPeak);
+        computeLevels(levels,
+                      firstChangedLevel,
+                      initial_level,
+                      inflows,
+                      overflow,
+                      pump,
+                      OutHydroGen);
+        levelsRange.update(levels, firstChangedLevel);
     }
     return {OutHydroGen, OutUnsupE, levels};
 }
@@ -136,6 +136,9 @@ void SIM_InitialisationProblemeHebdo(Data::Study& study,
 
     problem.OptimisationAuPasHebdomadaire = (parameters.simplexOptimizationRange == Data::sorWeek);
 
+    // The cores not used to run years in parallel are left to the processing of the areas
+    problem.areaThreadCount = study.getNumberOfCoresPerParallelYear();
+
     switch (parameters.power.fluctuations)
     {
     case Data::lssFreeModulations:
@@ -102,7 +102,7 @@ class LoadAreaNumberOfTSretriever: public AreaNumberOfTSretriever
 public:
     std::vector<uint> getAreaTimeSeriesNumber(const Area& area) override
     {
-        return {area.load.series.timeSeries.width};
+        return {area.load.series.numberOfColumns()};
     }
 };
 
@@ -120,7 +120,7 @@ class WindAreaNumberOfTSretriever: public AreaNumberOfTSretriever
 public:
     std::vector<uint> getAreaTimeSeriesNumber(const Area& area) override
     {
-        return {area.wind.series.timeSeries.width};
+        return {area.wind.series.numberOfColumns()};
     }
 };
 
@@ -129,7 +129,7 @@ class SolarAreaNumberOfTSretriever: public AreaNumberOfTSretriever
 public:
     std::vector<uint> getAreaTimeSeriesNumber(const Area& area) override
     {
-        return {area.solar.series.timeSeries.width};
+        return {area.solar.series.numberOfColumns()};
     }
 };
 
@@ -280,21 +280,21 @@ bool checkInterModalConsistencyForArea(const Area& area,
     int indexTS = ts_to_tsIndex.at(timeSeriesLoad);
     if (isTSintermodal[indexTS])
     {
-        listNumberTsOverArea.push_back(area.load.series.timeSeries.width);
+        listNumberTsOverArea.push_back(area.load.series.numberOfColumns());
     }
 
     // Solar : Add solar's number of TS in area ...
     indexTS = ts_to_tsIndex.at(timeSeriesSolar);
     if (isTSintermodal[indexTS])
     {
-        listNumberTsOverArea.push_back(area.solar.series.timeSeries.width);
+        listNumberTsOverArea.push_back(area.solar.series.numberOfColumns());
     }
 
     // Wind : Add wind's number of TS in area ...
     indexTS = ts_to_tsIndex.at(timeSeriesWind);
     if (isTSintermodal[indexTS])
     {
-        listNumberTsOverArea.push_back(area.wind.series.timeSeries.width);
+        listNumberTsOverArea.push_back(area.wind.series.numberOfColumns());
     }
 
     // Hydro : Add hydro's number of TS in area ...
@@ -377,7 +377,7 @@ void storeTSnumbersForIntraModal(const array<uint32_t, timeSeriesCount>& intramo
           assert(year < area.load.series.timeseriesNumbers.height());
           int indexTS = ts_to_tsIndex.at(timeSeriesLoad);
 
-          if (isTSintramodal[indexTS] && area.load.series.timeSeries.width > 1)
+          if (isTSintramodal[indexTS] && area.load.series.numberOfColumns() > 1)
           {
               area.load.series.timeseriesNumbers[year] = intramodal_draws[indexTS];
           }
@@ -388,7 +388,7 @@ void storeTSnumbersForIntraModal(const array<uint32_t, timeSeriesCount>& intramo
           assert(year < area.solar.series.timeseriesNumbers.height());
           indexTS = ts_to_tsIndex.at(timeSeriesSolar);
 
-          if (isTSintramodal[indexTS] && area.solar.series.timeSeries.width > 1)
+          if (isTSintramodal[indexTS] && area.solar.series.numberOfColumns() > 1)
           {
               area.solar.series.timeseriesNumbers[year] = intramodal_draws[indexTS];
           }
@@ -399,7 +399,7 @@ void storeTSnumbersForIntraModal(const array<uint32_t, timeSeriesCount>& intramo
           assert(year < area.wind.series.timeseriesNumbers.height());
           indexTS = ts_to_tsIndex.at(timeSeriesWind);
 
-          if (isTSintramodal[indexTS] && area.wind.series.timeSeries.width > 1)
+          if (isTSintramodal[indexTS] && area.wind.series.numberOfColumns() > 1)
           {
               area.wind.series.timeseriesNumbers[year] = intramodal_draws[indexTS];
           }
@@ -476,7 +476,7 @@ void drawAndStoreTSnumbersForNOTintraModal(const array<bool, timeSeriesCount>& i
           {
               area.load.series.timeseriesNumbers[year] = (uint32_t)(floor(
                 study.runtime.random[seedTimeseriesNumbers].next()
-                * area.load.series.timeSeries.width));
+                * area.load.series.numberOfColumns()));
           }
 
           // -------------
@@ -488,7 +488,7 @@ void drawAndStoreTSnumbersForNOTintraModal(const array<bool, timeSeriesCount>& i
           {
               area.solar.series.timeseriesNumbers[year] = (uint32_t)(floor(
                 study.runtime.random[seedTimeseriesNumbers].next()
-                * area.solar.series.timeSeries.width));
+                * area.solar.series.numberOfColumns()));
           }
 
           // -------------
@@ -500,7 +500,7 @@ void drawAndStoreTSnumbersForNOTintraModal(const array<bool, timeSeriesCount>& i
           {
               area.wind.series.timeseriesNumbers[year] = (uint32_t)(floor(
                 study.runtime.random[seedTimeseriesNumbers].next()
-                * area.wind.series.timeSeries.width));
+                * area.wind.series.numberOfColumns()));
           }
 
           // -------------
@@ -0,0 +1,189 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#include "antares/solver/ts-generator/archive.h"
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+#include <antares/io/file.h>
+#include <antares/logs/logs.h>
+
+namespace Antares::TSGenerator
+{
+TimeSeriesArchive::TimeSeriesArchive(Solver::IResultWriter& writer,
+                                     Format format,
+                                     unsigned int nbThreads):
+    writer_(writer),
+    format_(format)
+{
+    queue_.maximumThreadCount(std::max(1u, nbThreads));
+}
+
+TimeSeriesArchive::~TimeSeriesArchive()
+{
+    try
+    {
+        flush();
+    }
+    catch (const std::exception& e)
+    {
+        logs.error() << "ts-generator: failed to archive the time-series: " << e.what();
+    }
+    queue_.stop();
+}
+
+const char* TimeSeriesArchive::Extension(Format format)
+{
+    return (format == Format::Binary) ? ".bin" : ".txt";
+}
+
+void TimeSeriesArchive::add(std::filesystem::path entryPath,
+                            const Matrix<>& series,
+                            unsigned int precision)
+{
+    std::call_once(queueStarted_, [this] { queue_.start(); });
+
+    entryPath.replace_extension(Extension(format_));
+    auto copy = std::make_shared<Matrix<>>(series);
+    auto job = [this, entryPath = std::move(entryPath), copy, precision]
+    {
+        std::string buffer;
+        if (format_ == Format::Binary)
+        {
+            copy->saveToBinaryBuffer(buffer, precision);
+        }
+        else
+        {
+            copy->saveToBuffer(buffer, precision);
+        }
+
+        // A writer relying on the shared job queue may only be fed by the thread driving
+        // that queue : the entry is then kept until the next flush()
+        if (writer_.needsTheJobQueue())
+        {
+            std::lock_guard lock(deferredMutex_);
+            deferred_.emplace_back(entryPath, std::move(buffer));
+        }
+        else
+        {
+            writer_.addEntryFromBuffer(entryPath, buffer);
+        }
+    };
+    jobs_.add(Concurrency::AddTask(queue_, job));
+}
+
+void TimeSeriesArchive::flush()
+{
+    jobs_.join();
+
+    std::vector<std::pair<std::filesystem::path, std::string>> entries;
+    {
+        std::lock_guard lock(deferredMutex_);
+        std::swap(entries, deferred_);
+    }
+    for (auto& [entryPath, buffer]: entries)
+    {
+        writer_.addEntryFromBuffer(entryPath, buffer);
+    }
+}
+
+bool TimeSeriesArchive::ConvertToText(const std::filesystem::path& folder)
+{
+    namespace fs = std::filesystem;
+
+    if (!fs::is_directory(folder))
+    {
+        if (folder.extension() == ".zip")
+        {
+            logs.error() << folder.string()
+                         << ": the time-series of a zipped output can not be converted, the "
+                            "output must be unzipped first";
+        }
+        else
+        {
+            logs.error() << folder.string() << ": the output folder does not exist";
+        }
+        return false;
+    }
+
+    std::vector<fs::path> files;
+    try
+    {
+        for (const auto& item: fs::recursive_directory_iterator(folder))
+        {
+            if (item.is_regular_file() && item.path().extension() == Extension(Format::Binary))
+            {
+                files.push_back(item.path());
+            }
+        }
+    }
+    catch (const fs::filesystem_error& e)
+    {
+        logs.error() << "Impossible to list the archived time-series: " << e.what();
+        return false;
+    }
+
+    logs.info() << "Converting " << files.size() << " archived time-series into text";
+    bool ok = true;
+    for (const auto& path: files)
+    {
+        Matrix<> series;
+        uint precision = 0;
+        std::string content;
+        try
+        {
+            content = IO::readFile(path);
+        }
+        catch (const std::runtime_error&)
+        {
+            // The error is already logged
+            ok = false;
+            continue;
+        }
+
+        if (!series.loadFromBinaryBuffer(content, &precision))
+        {
+            logs.error() << path.string() << ": invalid binary time-series";
+            ok = false;
+            continue;
+        }
+
+        std::string buffer;
+        series.saveToBuffer(buffer, precision);
+        auto output = path;
+        output.replace_extension(Extension(Format::Text));
+        if (!IO::fileSetContent(output.string(), buffer))
+        {
+            ok = false;
+            continue;
+        }
+        std::error_code ec;
+        if (!fs::remove(path, ec))
+        {
+            logs.warning() << path.string() << ": impossible to remove the binary time-series";
+        }
+    }
+    return ok;
+}
+
+} // namespace Antares::TSGenerator
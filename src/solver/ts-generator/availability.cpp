@@ -20,11 +20,14 @@
 */
 
 #include <string>
+#include <utility>
 
 #include <antares/io/file.h> // For Antares::IO::fileSetContent
 #include <antares/logs/logs.h>
+#include <antares/mersenne-twister/substream.h>
 #include <antares/solver/ts-generator/generator.h>
 #include <antares/solver/ts-generator/law.h>
+#include <antares/solver/ts-generator/parallel.h>
 #include <antares/study/study.h>
 
 constexpr double FAILURE_RATE_EQ_1 = 0.999;
@@ -39,7 +42,7 @@ AvailabilityTSGeneratorData::AvailabilityTSGeneratorData(Data::ThermalCluster* c
     forcedLaw(cluster->forcedLaw),
     plannedLaw(cluster->plannedLaw),
     prepro(cluster->prepro.get()),
-    modulationCapacity(cluster->modulation[Data::thermalModulationCapacity]),
+    modulationCapacity(std::as_const(cluster->modulation)[Data::thermalModulationCapacity]),
     name(cluster->name())
 {
 }
@@ -605,21 +608,43 @@ void writeTStoDisk(const Matrix<>& series, const std::filesystem::path savePath)
 
 bool generateThermalTimeSeries(Data::Study& study,
                                const std::vector<Data::ThermalCluster*>& clusters,
-                               MersenneTwister& thermalRandom)
+                               MersenneTwister& thermalRandom,
+                               uint year)
 {
     logs.info();
     logs.info() << "Generating the thermal time-series";
 
-    auto generator = AvailabilityTSgenerator(study.parameters.derated,
-                                             study.parameters.nbTimeSeriesThermal,
-                                             thermalRandom);
-
-    for (auto* cluster: clusters)
+    const auto& parameters = study.parameters;
+    if (parameters.compatibility.tsGenSeeding == TsGenSeeding::V1)
     {
-        AvailabilityTSGeneratorData tsGenerationData(cluster);
-        cluster->series.timeSeries = generator.run(tsGenerationData);
+        auto generator = AvailabilityTSgenerator(parameters.derated,
+                                                 parameters.nbTimeSeriesThermal,
+                                                 thermalRandom);
+
+        for (auto* cluster: clusters)
+        {
+            AvailabilityTSGeneratorData tsGenerationData(cluster);
+            cluster->series.timeSeries = generator.run(tsGenerationData);
+        }
+        return true;
     }
 
+    const uint seed = parameters.seed[Data::seedTsGenThermal];
+    generateInParallel(generationThreadCount(study),
+                       clusters.size(),
+                       [&clusters, &parameters, seed, year](std::size_t i)
+                       {
+                           auto* cluster = clusters[i];
+                           auto streamName = cluster->parentArea->id.to<std::string>() + '/'
+                                             + cluster->id();
+                           auto random = MakeSubstream(seed, streamName, year);
+                           auto generator = AvailabilityTSgenerator(parameters.derated,
+                                                                    parameters.nbTimeSeriesThermal,
+                                                                    random);
+
+                           AvailabilityTSGeneratorData tsGenerationData(cluster);
+                           cluster->series.timeSeries = generator.run(tsGenerationData);
+                       });
     return true;
 }
 
@@ -636,6 +661,43 @@ void writeThermalTimeSeries(const std::vector<Data::ThermalCluster*>& clusters,
     }
 }
 
+void writeThermalTimeSeries(const std::vector<Data::ThermalCluster*>& clusters,
+                            TimeSeriesArchive& archive,
+                            const fs::path& folder)
+{
+    for (auto* cluster: clusters)
+    {
+        auto areaName = cluster->parentArea->id.to<std::string>();
+        auto clusterName = cluster->id();
+        auto entryPath = folder / areaName / clusterName += ".txt";
+
+        archive.add(entryPath, cluster->series.timeSeries, 0);
+    }
+}
+
+static void generateLinkTimeSeries(const AvailabilityTSgenerator& generator,
+                                   LinkTSgenerationParams& link,
+                                   const fs::path& savePath)
+{
+    // === DIRECT =======================
+    AvailabilityTSGeneratorData tsConfigDataDirect(link,
+                                                   link.modulationCapacityDirect,
+                                                   link.namesPair.second);
+    auto generated_ts = generator.run(tsConfigDataDirect);
+
+    auto filePath = savePath / link.namesPair.first / link.namesPair.second += "_direct.txt";
+    writeTStoDisk(generated_ts, filePath);
+
+    // === INDIRECT =======================
+    AvailabilityTSGeneratorData tsConfigDataIndirect(link,
+                                                     link.modulationCapacityIndirect,
+                                                     link.namesPair.second);
+    generated_ts = generator.run(tsConfigDataIndirect);
+
+    filePath = savePath / link.namesPair.first / link.namesPair.second += "_indirect.txt";
+    writeTStoDisk(generated_ts, filePath);
+}
+
 // gp : we should try to add const identifiers before args here
 bool generateLinkTimeSeries(std::vector<LinkTSgenerationParams>& links,
                             StudyParamsForLinkTS& generalParams,
@@ -644,10 +706,7 @@ bool generateLinkTimeSeries(std::vector<LinkTSgenerationParams>& links,
     logs.info();
     logs.info() << "Generation of links time-series";
 
-    auto generator = AvailabilityTSgenerator(generalParams.derated,
-                                             generalParams.nbLinkTStoGenerate,
-                                             generalParams.random);
-    for (auto& link: links)
+    for (const auto& link: links)
     {
         if (!link.hasValidData)
         {
@@ -655,31 +714,41 @@ bool generateLinkTimeSeries(std::vector<LinkTSgenerationParams>& links,
                          << link.namesPair.second;
             return false;
         }
+    }
 
-        if (link.forceNoGeneration)
+    if (generalParams.seeding == TsGenSeeding::V1)
+    {
+        auto generator = AvailabilityTSgenerator(generalParams.derated,
+                                                 generalParams.nbLinkTStoGenerate,
+                                                 generalParams.random);
+        for (auto& link: links)
         {
-            continue; // Skipping the link
+            if (!link.forceNoGeneration)
+            {
+                generateLinkTimeSeries(generator, link, savePath);
+            }
         }
-
-        // === DIRECT =======================
-        AvailabilityTSGeneratorData tsConfigDataDirect(link,
-                                                       link.modulationCapacityDirect,
-                                                       link.namesPair.second);
-        auto generated_ts = generator.run(tsConfigDataDirect);
-
-        auto filePath = savePath / link.namesPair.first / link.namesPair.second += "_direct.txt";
-        writeTStoDisk(generated_ts, filePath);
-
-        // === INDIRECT =======================
-        AvailabilityTSGeneratorData tsConfigDataIndirect(link,
-                                                         link.modulationCapacityIndirect,
-                                                         link.namesPair.second);
-        generated_ts = generator.run(tsConfigDataIndirect);
-
-        filePath = savePath / link.namesPair.first / link.namesPair.second += "_indirect.txt";
-        writeTStoDisk(generated_ts, filePath);
+        return true;
     }
 
+    generateInParallel(generalParams.nbThreads,
+                       links.size(),
+                       [&links, &generalParams, &savePath](std::size_t i)
+                       {
+                           auto& link = links[i];
+                           if (link.forceNoGeneration)
+                           {
+                               return; // Skipping the link
+                           }
+
+                           auto streamName = link.namesPair.first + '/' + link.namesPair.second;
+                           auto random = MakeSubstream(generalParams.seed, streamName, 0);
+                           const auto nbSeries = generalParams.nbLinkTStoGenerate;
+                           auto generator = AvailabilityTSgenerator(generalParams.derated,
+                                                                    nbSeries,
+                                                                    random);
+                           generateLinkTimeSeries(generator, link, savePath);
+                       });
     return true;
 }
 } // namespace Antares::TSGenerator
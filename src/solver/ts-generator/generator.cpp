@@ -21,8 +21,14 @@
 
 #include "antares/solver/ts-generator/generator.h"
 
+#include "antares/solver/ts-generator/parallel.h"
+
 namespace Antares::TSGenerator
 {
+unsigned int generationThreadCount(Data::Study& study)
+{
+    return study.getNumberOfConfiguredCores();
+}
 
 void ResizeGeneratedTimeSeries(Data::AreaList& areas, Data::Parameters& params)
 {
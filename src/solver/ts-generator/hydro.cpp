@@ -19,14 +19,20 @@
  * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
  */
 
+#include <algorithm>
 #include <cmath>
+#include <string>
+#include <vector>
 
 #include <antares/antares/fatal-error.h>
+#include <antares/mersenne-twister/substream.h>
 #include <antares/study/study.h>
 #include <antares/utils/utils.h>
-#include <antares/writer/i_writer.h>
 #include "antares/solver/misc/cholesky.h"
 #include "antares/solver/misc/matrix-dp-make.h"
+#include "antares/solver/ts-generator/generator.h"
+#include "antares/solver/ts-generator/parallel.h"
+#include "antares/solver/ts-generator/xcast/constants.h"
 
 using namespace Antares;
 
@@ -57,7 +63,156 @@ static void PreproRoundAllEntriesPlusDerated(Data::Study& study)
       });
 }
 
-bool GenerateHydroTimeSeries(Data::Study& study, uint currentYear, Solver::IResultWriter& writer)
+/*!
+** \brief Draw DIM independent normal values (polar method), written every `stride` values
+*/
+static void DrawNormals(MersenneTwister& random, double* norm, uint DIM, uint stride)
+{
+    double x, y, z, u;
+    for (uint s = 0; s < DIM / 2; ++s)
+    {
+        do
+        {
+            x = 2. * random.next() - 1.;
+            y = 2. * random.next() - 1.;
+            z = (x * x) + (y * y);
+        } while (z > 1);
+
+        u = sqrt(-2. * log(z) / z);
+        norm[2 * s * stride] = x * u;
+        norm[(2 * s + 1) * stride] = y * u;
+    }
+}
+
+/*!
+** \brief Correlated draws of a block of `count` series : out = CHSKY * norm
+**
+** CHSKY is lower triangular, norm and out have one row of `count` values per (area, month).
+** The innermost loop runs over the series of the block, so that it can be vectorized, and
+** each value is accumulated in the same order as a row by column product.
+*/
+static void CorrelateNormals(const Matrix<double>& CHSKY,
+                             const double* norm,
+                             double* out,
+                             uint DIM,
+                             uint count)
+{
+    for (uint i = 0; i < DIM; ++i)
+    {
+        double* outRow = out + i * count;
+        std::fill(outRow, outRow + count, 0.);
+
+        const auto& chskyRow = CHSKY[i];
+        for (uint j = 0; j < i + 1; ++j)
+        {
+            const double c = chskyRow[j];
+            const double* normRow = norm + j * count;
+            for (uint k = 0; k < count; ++k)
+            {
+                outRow[k] += c * normRow[k];
+            }
+        }
+    }
+}
+
+/*!
+** \brief Hourly run-of-river and daily storage of one month of one series
+**
+** \param i Index of the (area, month)
+** \param l Index of the series
+** \param correlatedDraw The correlated normal draw of this month and series
+** \param SIP Sum of the inflow patterns of the month
+*/
+static void GenerateMonth(Data::Study& study, uint i, uint l, double correlatedDraw, double SIP)
+{
+    const auto& calendar = study.calendar;
+    const auto& area = *(study.areas.byIndex[i / MONTHS_PER_YEAR]);
+    const auto& prepro = *area.hydro.prepro;
+    auto& series = *area.hydro.series;
+    auto ror = series.ror[l];
+
+    auto& colExpectation = prepro.data[Data::PreproHydro::expectation];
+    auto& colStdDeviation = prepro.data[Data::PreproHydro::stdDeviation];
+    auto& colMinEnergy = prepro.data[Data::PreproHydro::minimumEnergy];
+    auto& colMaxEnergy = prepro.data[Data::PreproHydro::maximumEnergy];
+    auto& colPOW = prepro.data[Data::PreproHydro::powerOverWater];
+
+    uint month = i % MONTHS_PER_YEAR;
+    uint realmonth = calendar.months[month].realmonth;
+
+    assert(l < series.ror.timeSeries.width);
+    assert(not std::isnan(colPOW[realmonth]));
+
+    double EnergieHydrauliqueTotaleMensuelle = 0;
+
+    if (!Utils::isZero(colExpectation[realmonth]))
+    {
+        EnergieHydrauliqueTotaleMensuelle = correlatedDraw;
+
+        EnergieHydrauliqueTotaleMensuelle *= colStdDeviation[realmonth];
+        EnergieHydrauliqueTotaleMensuelle += colExpectation[realmonth];
+
+        EnergieHydrauliqueTotaleMensuelle = exp(EnergieHydrauliqueTotaleMensuelle);
+        assert(not std::isnan(EnergieHydrauliqueTotaleMensuelle));
+
+        if (EnergieHydrauliqueTotaleMensuelle < colMinEnergy[realmonth])
+        {
+            EnergieHydrauliqueTotaleMensuelle = colMinEnergy[realmonth];
+        }
+        if (EnergieHydrauliqueTotaleMensuelle > colMaxEnergy[realmonth])
+        {
+            EnergieHydrauliqueTotaleMensuelle = colMaxEnergy[realmonth];
+        }
+    }
+
+    uint h = calendar.months[month].hours.first;
+    uint end = calendar.months[month].hours.end;
+    uint d = calendar.months[month].daysYear.first;
+    uint dend = calendar.months[month].daysYear.end;
+
+    double dailyStorage = 0.;
+    double hourlyStorage = 0.;
+    double dailyInflowPattern = 0.;
+    double sumInflowPatterns = SIP;
+
+    double monthlyROR = EnergieHydrauliqueTotaleMensuelle * colPOW[realmonth];
+
+    for (; h != end; ++h)
+    {
+        uint dayOfHour = h / 24;
+        dailyInflowPattern = area.hydro.inflowPattern[0][dayOfHour];
+        hourlyStorage = round(monthlyROR * dailyInflowPattern / (24. * sumInflowPatterns));
+
+        ror[h] = hourlyStorage;
+
+        monthlyROR -= hourlyStorage;
+        sumInflowPatterns -= dailyInflowPattern / 24.;
+    }
+
+    double monthlyStorage = EnergieHydrauliqueTotaleMensuelle * (1. - colPOW[realmonth]);
+
+    sumInflowPatterns = SIP;
+    dailyStorage = 0.;
+    dailyInflowPattern = 0.;
+    for (; d != dend; ++d)
+    {
+        dailyInflowPattern = area.hydro.inflowPattern[0][d];
+        dailyStorage = round(monthlyStorage * dailyInflowPattern / sumInflowPatterns);
+
+        series.storage[l][d] = dailyStorage;
+
+        monthlyStorage -= dailyStorage;
+        sumInflowPatterns -= dailyInflowPattern;
+    }
+
+    assert(not std::isnan(monthlyStorage)
+           && "TS generator Hydro: NaN value detected in timeseries");
+}
+
+bool GenerateHydroTimeSeries(Data::Study& study,
+                             uint currentYear,
+                             TimeSeriesArchive& archive,
+                             unsigned int nbThreads)
 {
     logs.info() << "Generating the hydro time-series";
 
@@ -67,7 +222,6 @@ bool GenerateHydroTimeSeries(Data::Study& study, uint currentYear, Solver::IResu
     auto& calendar = study.calendar;
 
     uint DIM = MONTHS_PER_YEAR * study.areas.size();
-    uint DEM = DIM / 2;
 
     Matrix<double> CHSKY;
     CHSKY.reset(DIM, DIM);
@@ -76,7 +230,7 @@ bool GenerateHydroTimeSeries(Data::Study& study, uint currentYear, Solver::IResu
 
     Matrix<double> B;
     B.reset(DIM, DIM);
-    double x, y, z, u;
+    double x;
     double** nullmatrx = nullptr;
 
     if (1. > Solver::MatrixDPMake<double>(CHSKY.entry,
@@ -140,131 +294,92 @@ bool GenerateHydroTimeSeries(Data::Study& study, uint currentYear, Solver::IResu
     CORRE.clear();
     QCHOLTemp.clear();
 
-    std::vector<double> NORM(DIM);
-    for (uint i = 0; i != DIM; ++i)
-    {
-        NORM[i] = 0.;
-    }
-
     uint nbTimeseries = study.parameters.nbTimeSeriesHydro;
 
-    for (uint l = 0; l != nbTimeseries; ++l)
+    // The sum of the inflow patterns of each month does not depend on the series
+    std::vector<double> SIP(DIM, 0.);
+    for (uint i = 0; i < DIM; ++i)
     {
-        for (uint s = 0; s < DEM; ++s)
+        const auto& area = *(study.areas.byIndex[i / MONTHS_PER_YEAR]);
+        const auto& month = calendar.months[i % MONTHS_PER_YEAR];
+        for (uint d = month.daysYear.first; d < month.daysYear.end; ++d)
         {
-            do
-            {
-                x = 2. * studyRTI.random[Data::seedTsGenHydro].next() - 1.;
-                y = 2. * studyRTI.random[Data::seedTsGenHydro].next() - 1.;
-                z = (x * x) + (y * y);
-            } while (z > 1);
-
-            u = sqrt(-2. * log(z) / z);
-            NORM[2 * s] = x * u;
-            NORM[2 * s + 1] = y * u;
+            SIP[i] += area.hydro.inflowPattern[0][d];
         }
-        for (uint i = 0; i < DIM; ++i)
-        {
-            auto& area = *(study.areas.byIndex[i / MONTHS_PER_YEAR]);
-            auto& prepro = *area.hydro.prepro;
-            auto& series = *area.hydro.series;
-            auto ror = series.ror[l];
-
-            auto& colExpectation = prepro.data[Data::PreproHydro::expectation];
-            auto& colStdDeviation = prepro.data[Data::PreproHydro::stdDeviation];
-            auto& colMinEnergy = prepro.data[Data::PreproHydro::minimumEnergy];
-            auto& colMaxEnergy = prepro.data[Data::PreproHydro::maximumEnergy];
-            auto& colPOW = prepro.data[Data::PreproHydro::powerOverWater];
-
-            uint month = i % MONTHS_PER_YEAR;
-            uint realmonth = calendar.months[month].realmonth;
-
-            assert(l < series.ror.timeSeries.width);
-            assert(not std::isnan(colPOW[realmonth]));
-
-            double EnergieHydrauliqueTotaleMensuelle = 0;
 
-            if (!Utils::isZero(colExpectation[realmonth]))
-            {
-                for (uint j = 0; j < i + 1; ++j)
-                {
-                    EnergieHydrauliqueTotaleMensuelle += CHSKY[i][j] * NORM[j];
-                }
-
-                EnergieHydrauliqueTotaleMensuelle *= colStdDeviation[realmonth];
-                EnergieHydrauliqueTotaleMensuelle += colExpectation[realmonth];
-
-                EnergieHydrauliqueTotaleMensuelle = exp(EnergieHydrauliqueTotaleMensuelle);
-                assert(not std::isnan(EnergieHydrauliqueTotaleMensuelle));
-
-                if (EnergieHydrauliqueTotaleMensuelle < colMinEnergy[realmonth])
-                {
-                    EnergieHydrauliqueTotaleMensuelle = colMinEnergy[realmonth];
-                }
-                if (EnergieHydrauliqueTotaleMensuelle > colMaxEnergy[realmonth])
-                {
-                    EnergieHydrauliqueTotaleMensuelle = colMaxEnergy[realmonth];
-                }
-            }
-
-            uint h = calendar.months[month].hours.first;
-            uint end = calendar.months[month].hours.end;
-            uint d = calendar.months[month].daysYear.first;
-            uint dend = calendar.months[month].daysYear.end;
-
-            double SIP = 0.;
-            for (uint i = d; i < dend; i++)
-            {
-                SIP += area.hydro.inflowPattern[0][i];
-            }
+        if (nbTimeseries != 0 && Utils::isZero(SIP[i]))
+        {
+            logs.fatal() << "Sum of monthly inflow patterns equals zero.";
+            return false;
+        }
+    }
 
-            if (Utils::isZero(SIP))
-            {
-                logs.fatal() << "Sum of monthly inflow patterns equals zero.";
-                return false;
-            }
+    // The series are generated by chunks, in parallel : each chunk writes its own columns
+    study.areas.each(
+      [](Data::Area& area)
+      {
+          area.hydro.series->ror.timeSeries.detach();
+          area.hydro.series->storage.timeSeries.detach();
+      });
 
-            double dailyStorage = 0.;
-            double hourlyStorage = 0.;
-            double dailyInflowPattern = 0.;
-            double sumInflowPatterns = SIP;
+    const uint nbChunks = (nbTimeseries + SERIES_PER_CHUNK - 1) / SERIES_PER_CHUNK;
+    auto chunkSize = [nbTimeseries](uint chunk)
+    { return std::min(SERIES_PER_CHUNK, nbTimeseries - chunk * SERIES_PER_CHUNK); };
 
-            double monthlyROR = EnergieHydrauliqueTotaleMensuelle * colPOW[realmonth];
+    // Normal draws of each chunk, one row of `chunkSize` values per (area, month)
+    std::vector<std::vector<double>> NORM(nbChunks);
 
-            for (; h != end; ++h)
+    const bool seedingV1 = study.parameters.compatibility.tsGenSeeding == TsGenSeeding::V1;
+    if (seedingV1)
+    {
+        // A single stream, drawn in the historical order : series after series
+        auto& random = studyRTI.random[Data::seedTsGenHydro];
+        for (uint chunk = 0; chunk != nbChunks; ++chunk)
+        {
+            const uint count = chunkSize(chunk);
+            NORM[chunk].resize(DIM * count);
+            for (uint k = 0; k != count; ++k)
             {
-                uint dayOfHour = h / 24;
-                dailyInflowPattern = area.hydro.inflowPattern[0][dayOfHour];
-                hourlyStorage = round(monthlyROR * dailyInflowPattern / (24. * sumInflowPatterns));
-
-                ror[h] = hourlyStorage;
-
-                monthlyROR -= hourlyStorage;
-                sumInflowPatterns -= dailyInflowPattern / 24.;
+                DrawNormals(random, NORM[chunk].data() + k, DIM, count);
             }
+        }
+    }
 
-            double monthlyStorage = EnergieHydrauliqueTotaleMensuelle * (1. - colPOW[realmonth]);
-
-            sumInflowPatterns = SIP;
-            dailyStorage = 0.;
-            dailyInflowPattern = 0.;
-            for (; d != dend; ++d)
-            {
-                dailyInflowPattern = area.hydro.inflowPattern[0][d];
-                dailyStorage = round(monthlyStorage * dailyInflowPattern / sumInflowPatterns);
-
-                series.storage[l][d] = dailyStorage;
+    const uint seed = study.parameters.seed[Data::seedTsGenHydro];
+    generateInParallel(
+      nbThreads,
+      nbChunks,
+      [&](std::size_t chunk)
+      {
+          const uint count = chunkSize((uint)chunk);
+          const uint firstSeries = (uint)chunk * SERIES_PER_CHUNK;
+          auto& norm = NORM[chunk];
 
-                monthlyStorage -= dailyStorage;
-                sumInflowPatterns -= dailyInflowPattern;
-            }
+          if (!seedingV1)
+          {
+              auto random = MakeSubstream(seed, "hydro/" + std::to_string(chunk), currentYear);
+              norm.resize(DIM * count);
+              for (uint k = 0; k != count; ++k)
+              {
+                  DrawNormals(random, norm.data() + k, DIM, count);
+              }
+          }
 
-            assert(not std::isnan(monthlyStorage)
-                   && "TS generator Hydro: NaN value detected in timeseries");
-        }
+          // Correlated draws of the whole chunk : the lower triangular factor times the
+          // block of normal draws
+          std::vector<double> energies(DIM * count);
+          CorrelateNormals(CHSKY, norm.data(), energies.data(), DIM, count);
 
-        ++progression;
-    }
+          for (uint k = 0; k != count; ++k)
+          {
+              const uint l = firstSeries + k;
+              for (uint i = 0; i < DIM; ++i)
+              {
+                  GenerateMonth(study, i, l, energies[i * count + k], SIP[i]);
+              }
+              ++progression;
+          }
+      });
 
     PreproRoundAllEntriesPlusDerated(study);
 
@@ -281,21 +396,19 @@ bool GenerateHydroTimeSeries(Data::Study& study, uint currentYear, Solver::IResu
         {
             logs.info() << "Archiving the hydro time-series";
             study.areas.each(
-              [&currentYear, &writer, &progression](const Data::Area& area)
+              [&currentYear, &archive, &progression](const Data::Area& area)
               {
-                  const int precision = 0;
-                  std::string mcYear = "mc-" + currentYear;
+                  const uint precision = 0;
+                  std::string mcYear = "mc-" + std::to_string(currentYear);
                   fs::path outputFolder = fs::path("ts-generator") / "hydro" / mcYear
                                           / area.id.to<std::string>();
 
-                  std::string buffer;
-                  area.hydro.series->ror.timeSeries.saveToBuffer(buffer, precision);
-                  fs::path outputFile = outputFolder / "ror.txt";
-                  writer.addEntryFromBuffer(outputFile, buffer);
-
-                  area.hydro.series->storage.timeSeries.saveToBuffer(buffer, precision);
-                  outputFile = outputFolder / "storage.txt";
-                  writer.addEntryFromBuffer(outputFile, buffer);
+                  archive.add(outputFolder / "ror.txt",
+                              area.hydro.series->ror.timeSeries,
+                              precision);
+                  archive.add(outputFolder / "storage.txt",
+                              area.hydro.series->storage.timeSeries,
+                              precision);
 
                   ++progression;
               });
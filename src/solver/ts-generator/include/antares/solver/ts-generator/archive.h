@@ -0,0 +1,98 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#ifndef __ANTARES_SOLVER_TS_GENERATOR_ARCHIVE_H__
+#define __ANTARES_SOLVER_TS_GENERATOR_ARCHIVE_H__
+
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <antares/array/matrix.h>
+#include <antares/concurrency/concurrency.h>
+#include <antares/study/parameters.h>
+#include <antares/writer/i_writer.h>
+
+namespace Antares::TSGenerator
+{
+/*!
+** \brief Archive of the generated time-series into the output
+**
+** Encoding a matrix into text takes about as long as generating it. The archive
+** takes a copy of the generated series and encodes it on its own threads, so that
+** the generation, and the simulation, go on meanwhile.
+*/
+class TimeSeriesArchive final
+{
+public:
+    using Format = Data::Parameters::ArchiveFormat;
+
+    TimeSeriesArchive(Solver::IResultWriter& writer, Format format, unsigned int nbThreads);
+    ~TimeSeriesArchive();
+
+    TimeSeriesArchive(const TimeSeriesArchive&) = delete;
+    TimeSeriesArchive& operator=(const TimeSeriesArchive&) = delete;
+
+    /*!
+    ** \brief Queue the archiving of a copy of \p series
+    **
+    ** \param entryPath Path of the entry in the output, with the ".txt" extension
+    **   (replaced by ".bin" in the binary format)
+    ** \param precision Number of decimals in the text format
+    */
+    void add(std::filesystem::path entryPath, const Matrix<>& series, unsigned int precision);
+
+    /*!
+    ** \brief Wait for all the queued series to be handed to the writer
+    **
+    ** Must be called from the thread driving the writer, before flushing it.
+    ** The first error raised by an encoding job, if any, is re-thrown.
+    */
+    void flush();
+
+    //! Extension of the entries, according to the format
+    static const char* Extension(Format format);
+
+    /*!
+    ** \brief Convert the binary archives found in \p folder (recursively) back to text
+    **
+    ** Each `.bin` file is replaced by the `.txt` file the text format would have written.
+    ** Only unzipped outputs are supported : a zipped output must be extracted first.
+    ** \return False if \p folder is not a folder, or if a file could not be converted
+    */
+    static bool ConvertToText(const std::filesystem::path& folder);
+
+private:
+    Solver::IResultWriter& writer_;
+    const Format format_;
+    Yuni::Job::QueueService queue_;
+    std::once_flag queueStarted_;
+    Concurrency::FutureSet jobs_;
+
+    //! Entries waiting for flush(), when the writer relies on the shared job queue
+    std::mutex deferredMutex_;
+    std::vector<std::pair<std::filesystem::path, std::string>> deferred_;
+};
+
+} // namespace Antares::TSGenerator
+
+#endif // __ANTARES_SOLVER_TS_GENERATOR_ARCHIVE_H__
@@ -29,6 +29,7 @@
 #include <antares/study/parts/thermal/cluster.h>
 #include <antares/study/study.h>
 
+#include "archive.h"
 #include "xcast/xcast.h"
 
 namespace fs = std::filesystem;
@@ -37,6 +38,7 @@ using LinkPairs = std::vector<LinkPair>;
 
 namespace Antares::TSGenerator
 {
+using TsGenSeeding = Data::Parameters::Compatibility::TsGenSeeding;
 
 struct StudyParamsForLinkTS
 {
@@ -45,6 +47,11 @@ struct StudyParamsForLinkTS
     // gp : we will have a problem with that if seed-tsgen-links not set in
     // gp : generaldata.ini. In that case, our default value is wrong.
     MersenneTwister random;
+    //! Seed of the links generator, needed to derive the per-link streams
+    unsigned int seed = 0;
+    TsGenSeeding seeding = TsGenSeeding::V1;
+    //! Number of links generated simultaneously (only with the v2 seeding)
+    unsigned int nbThreads = 1;
 };
 
 struct LinkTSgenerationParams
@@ -89,7 +96,7 @@ public:
 
     Data::PreproAvailability* prepro;
 
-    Matrix<>::ColumnType& modulationCapacity;
+    const Matrix<>::ColumnType& modulationCapacity;
 
     const std::string& name;
 };
@@ -100,17 +107,42 @@ void ResizeGeneratedTimeSeries(Data::AreaList& areas, Data::Parameters& params);
 
 /*!
 ** \brief Regenerate the time-series
+**
+** The generated series are archived through \p archive, if required by the parameters.
+** At most \p nbThreads threads are used (see generationThreadCount()).
 */
 template<enum Data::TimeSeriesType T>
-bool GenerateTimeSeries(Data::Study& study, uint year, IResultWriter& writer);
+bool GenerateTimeSeries(Data::Study& study,
+                        uint year,
+                        TimeSeriesArchive& archive,
+                        unsigned int nbThreads);
 
+/*!
+** \brief Generate the availability time-series of thermal clusters
+**
+** With the v1 seeding, the clusters are generated one after the other and all draw
+** their random numbers from \p thermalRandom.
+** With the v2 seeding, each cluster draws from its own stream, derived from the seed
+** of the thermal generator, the name of the cluster and \p year : the clusters are
+** then generated in parallel and the results do not depend on the number of threads.
+*/
 bool generateThermalTimeSeries(Data::Study& study,
                                const std::vector<Data::ThermalCluster*>& clusters,
-                               MersenneTwister& thermalRandom);
+                               MersenneTwister& thermalRandom,
+                               uint year = 0);
 
 void writeThermalTimeSeries(const std::vector<Data::ThermalCluster*>& clusters,
                             const fs::path& savePath);
 
+/*!
+** \brief Archive the availability time-series of thermal clusters
+**
+** Each series is queued in \p archive as the entry `<folder>/<area>/<cluster>.txt`.
+*/
+void writeThermalTimeSeries(const std::vector<Data::ThermalCluster*>& clusters,
+                            TimeSeriesArchive& archive,
+                            const fs::path& folder);
+
 bool generateLinkTimeSeries(std::vector<LinkTSgenerationParams>& links,
                             StudyParamsForLinkTS&,
                             const fs::path& savePath);
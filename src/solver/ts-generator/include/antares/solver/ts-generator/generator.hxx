@@ -28,19 +28,26 @@ namespace Antares::TSGenerator
 
 // forward declaration
 // Hydro - see hydro.cpp
-bool GenerateHydroTimeSeries(Data::Study& study, uint year, IResultWriter& writer);
+bool GenerateHydroTimeSeries(Data::Study& study,
+                             uint year,
+                             TimeSeriesArchive& archive,
+                             unsigned int nbThreads);
 
 template<>
 inline bool GenerateTimeSeries<Data::timeSeriesHydro>(Data::Study& study,
                                                       uint year,
-                                                      IResultWriter& writer)
+                                                      TimeSeriesArchive& archive,
+                                                      unsigned int nbThreads)
 {
-    return GenerateHydroTimeSeries(study, year, writer);
+    return GenerateHydroTimeSeries(study, year, archive, nbThreads);
 }
 
 // --- TS Generators using XCast ---
 template<enum Data::TimeSeriesType T>
-bool GenerateTimeSeries(Data::Study& study, uint year, IResultWriter& writer)
+bool GenerateTimeSeries(Data::Study& study,
+                        uint year,
+                        TimeSeriesArchive& archive,
+                        unsigned int nbThreads)
 {
     auto* xcast = reinterpret_cast<XCast::XCast*>(
       study.cacheTSGenerator[Data::TimeSeriesBitPatternIntoIndex<T>::value]);
@@ -48,12 +55,13 @@ bool GenerateTimeSeries(Data::Study& study, uint year, IResultWriter& writer)
     if (not xcast)
     {
         logs.debug() << "Preparing the " << Data::TimeSeriesToCStr<T>::Value() << " TS Generator";
-        xcast = new XCast::XCast(study, T, writer);
+        xcast = new XCast::XCast(study, T, archive);
         study.cacheTSGenerator[Data::TimeSeriesBitPatternIntoIndex<T>::value] = xcast;
     }
 
     // The current year
     xcast->year = year;
+    xcast->nbThreads = nbThreads;
 
     switch (T)
     {
@@ -0,0 +1,62 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#ifndef __ANTARES_SOLVER_TS_GENERATOR_PARALLEL_H__
+#define __ANTARES_SOLVER_TS_GENERATOR_PARALLEL_H__
+
+#include <algorithm>
+#include <cstddef>
+
+#include <antares/concurrency/concurrency.h>
+#include <antares/study/fwd.h>
+
+namespace Antares::TSGenerator
+{
+/*!
+** \brief Number of threads the generators may use, according to the number of cores setting
+*/
+unsigned int generationThreadCount(Data::Study& study);
+
+/*!
+** \brief Call `generate(i)` for each i in [0, count), in parallel on a dedicated queue service
+**
+** The first exception thrown by a call, if any, is re-thrown once all calls are done.
+*/
+template<class F>
+void generateInParallel(unsigned int nbThreads, std::size_t count, const F& generate)
+{
+    Yuni::Job::QueueService queue;
+    queue.maximumThreadCount(std::max(1u, nbThreads));
+
+    Concurrency::FutureSet results;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        results.add(Concurrency::AddTask(queue, [&generate, i] { generate(i); }));
+    }
+
+    queue.start();
+    queue.wait(Yuni::qseIdle);
+    queue.stop();
+    results.join();
+}
+
+} // namespace Antares::TSGenerator
+
+#endif // __ANTARES_SOLVER_TS_GENERATOR_PARALLEL_H__
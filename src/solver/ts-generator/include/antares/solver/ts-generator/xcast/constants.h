@@ -45,4 +45,7 @@
 //! A la limite superieure des lois Gamma  la fonction de repartition vaut 1- NEGLI_GAM
 #define NEGLI_GAMM ((double)1.0e-4)
 
+//! Nombre de series consecutives generees avec un meme flux aleatoire (graines v2)
+#define SERIES_PER_CHUNK 10u
+
 #endif // __ANTARES_SOLVER_TS_GENERATOR_XCAST_CONSTANTS_H__
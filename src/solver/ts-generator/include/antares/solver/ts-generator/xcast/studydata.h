@@ -21,6 +21,11 @@
 #ifndef __ANTARES_SOLVER_TS_GENERATOR_XCAST_STUDY_DATA_H__
 #define __ANTARES_SOLVER_TS_GENERATOR_XCAST_STUDY_DATA_H__
 
+#include <array>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include <yuni/yuni.h>
 
 #include <antares/correlation/correlation.h>
@@ -86,6 +91,31 @@ public:
     */
     Data::Correlation::Mode mode;
 
+    /*!
+    ** \brief Factorisation of the correlation matrix of a month, once made suitable for
+    **   the marginal laws of the processes
+    **
+    ** It only depends on the study data : it is computed at the first use and shared by
+    ** all the series and all the refreshes.
+    */
+    struct MonthlyFactorisation
+    {
+        std::mutex mutex;
+        bool ready = false;
+        //! Lower triangular factor (Triangle_courant)
+        std::vector<std::vector<float>> triangle;
+        //! Positive definite matrix actually factorised (Carre_reference)
+        std::vector<std::vector<float>> square;
+        //! Shrink coefficient returned by MatrixDPMake
+        float shrink = 1.f;
+        //! Number of coefficients levelled to +/-1
+        uint levellingCount = 0;
+    };
+    using Factorisations = std::array<MonthlyFactorisation, 12>;
+
+    //! Factorisations for each real month (shared by the workers of a same block)
+    std::shared_ptr<Factorisations> factorisations = std::make_shared<Factorisations>();
+
 private:
     //! Delete
     //! Rebuild data from our own area list
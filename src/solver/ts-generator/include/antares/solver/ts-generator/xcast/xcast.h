@@ -21,6 +21,11 @@
 #ifndef __ANTARES_SOLVER_TS_GENERATOR_XCAST_XCAST_H__
 #define __ANTARES_SOLVER_TS_GENERATOR_XCAST_XCAST_H__
 
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include <yuni/yuni.h>
 #include <yuni/core/noncopyable.h>
 
@@ -28,6 +33,7 @@
 #include <antares/study/fwd.h>
 #include <antares/study/progression/progression.h>
 #include <antares/writer/i_writer.h>
+#include "antares/solver/ts-generator/archive.h"
 #include "antares/solver/ts-generator/xcast/studydata.h"
 
 using namespace Antares::Solver;
@@ -70,7 +76,7 @@ public:
     /*!
     ** \brief Default constructor
     */
-    XCast(Data::Study& study, Data::TimeSeriesType ts, IResultWriter& writer);
+    XCast(Data::Study& study, Data::TimeSeriesType ts, TimeSeriesArchive& archive);
     /*!
     ** \brief Destructor
     */
@@ -97,6 +103,8 @@ public:
 
     //! The current year
     uint year;
+    //! The number of threads the generation may use
+    unsigned int nbThreads = 1;
     //! The time-series type
     const Data::TimeSeriesType timeSeriesType;
 
@@ -111,6 +119,51 @@ private:
     template<class PredicateT>
     bool runWithPredicate(PredicateT& predicate, Progression::Task& progression);
 
+    /*!
+    ** \brief Generate the series [firstSeries, endSeries) of all processes
+    */
+    template<class PredicateT>
+    void generateSeries(PredicateT& predicate,
+                        uint firstSeries,
+                        uint endSeries,
+                        Progression::Task& progression);
+
+    /*!
+    ** \brief Generate all series with one worker per independent block of processes
+    **   and per chunk of series (v2 seeding)
+    */
+    template<class PredicateT>
+    void generateBlocksInParallel(PredicateT& predicate, Progression::Task& progression);
+
+    /*!
+    ** \brief Group the processes which are correlated, directly or not
+    **
+    ** \return The indices of the processes of each block, in increasing order
+    */
+    std::vector<std::vector<uint>> independentBlocks() const;
+
+    /*!
+    ** \brief Prepare this generator to generate a block of processes of \p source,
+    **   with its own random stream
+    */
+    void initializeWorker(const XCast& source,
+                          const std::vector<uint>& processes,
+                          const std::string& streamName,
+                          std::shared_ptr<StudyData::Factorisations> factorisations);
+
+    /*!
+    ** \brief Check that the correlation matrices of all months are positive definite
+    **
+    ** A matrix which is not is shrunk once (off-diagonal coefficients * 0.999).
+    ** The 12 months are checked in parallel.
+    **
+    ** \return False if a matrix is still not positive definite
+    */
+    bool validateCorrelationMatrices();
+
+    //! The seed of the generator of a given type of time-series
+    uint seedOf(Data::TimeSeriesType ts) const;
+
     /*!
     ** \brief Export all time-series for each process into the output folder
     */
@@ -163,11 +216,26 @@ private:
     */
     bool generateValuesForTheCurrentDay();
 
+    /*!
+    ** \brief Build the correlation matrix of the current month, suitable for the marginal
+    **   laws of the processes, and factorise it (Triangle_courant, Carre_reference)
+    **
+    ** \param[out] shrink The shrink coefficient returned by MatrixDPMake
+    */
+    bool makeMonthlyFactorisation(float& shrink);
+
     template<class PredicateT>
     void applyTransferFunction(PredicateT& predicate);
 
-    //! Tirage de deux variables normales centrees et reduites
-    void normal(float& x, float& y);
+    /*!
+    ** \brief Draw `count` pairs of independent standard normal variables into WIEN
+    **
+    ** The pair k is stored into WIEN[k] and WIEN[count - 1 - k], in increasing order of k.
+    ** All the points of the polar method are drawn first, then transformed in a single
+    ** pass : the random numbers consumed and the results are the same as drawing the
+    ** pairs one by one.
+    */
+    void normals(uint count);
 
 private:
     //! The number of time-series
@@ -178,6 +246,8 @@ private:
 
     //! The correlation matrix for the current month
     const Matrix<float>* pCorrMonth;
+    //! The current real month
+    uint pRealMonth = 0;
 
     bool pNeverInitialized = true;
     uint Nombre_points_intermediaire;
@@ -225,6 +295,11 @@ private:
     std::vector<float> WIEN;
     std::vector<float> BROW;
 
+    // Points accepted by the polar method, before their transformation (see normals())
+    std::vector<double> pPolarX;
+    std::vector<double> pPolarY;
+    std::vector<double> pPolarS;
+
     std::vector<float> BASI; // used only if all processes are Normal
     std::vector<float> ALPH; // used only if all processes are Normal
     std::vector<float> BETA; // used only if all processes are Normal
@@ -247,7 +322,14 @@ private:
     //! Name of the current timeseries
     Yuni::CString<32, false> pTSName;
 
-    IResultWriter& pWriter;
+    //! Own random stream, when generating a block of processes (see initializeWorker())
+    MersenneTwister pRandomStream;
+
+    //! Factorisations shared by the workers of each block, by first process of the block
+    std::map<uint, std::shared_ptr<StudyData::Factorisations>> pBlockFactorisations;
+
+    //! Archive of the generated time-series
+    TimeSeriesArchive& pArchive;
 }; // class XCast
 
 } // namespace XCast
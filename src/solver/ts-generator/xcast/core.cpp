@@ -19,6 +19,7 @@
 ** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
 */
 #include <cmath>
+#include <mutex>
 
 #include <yuni/yuni.h>
 
@@ -35,6 +36,104 @@ using namespace Yuni;
 
 namespace Antares::TSGenerator::XCast
 {
+bool XCast::makeMonthlyFactorisation(float& shrink)
+{
+    const uint processCount = (uint)pData.localareas.size();
+    float x;
+
+    if (All_normal)
+    {
+        // assessement of a correlation matrix suitable for the month
+        for (uint s = 0; s != processCount; ++s)
+        {
+            for (uint t = 0; t < s; ++t)
+            {
+                x = T[s] * T[t] * STDE[s] * STDE[t];
+                if (Utils::isZero(x))
+                {
+                    CORR[s][t] = 0.f;
+                }
+                else
+                {
+                    x = 1.f - ALPH[s] * ALPH[t];
+                    x /= BETA[s];
+                    x /= BETA[t];
+                    CORR[s][t] = (*pCorrMonth)[s][t] * x;
+                    if (CORR[s][t] > 1.f)
+                    {
+                        CORR[s][t] = 1.f;
+                        ++pLevellingCount;
+                    }
+                    else
+                    {
+                        if (CORR[s][t] < -1.f)
+                        {
+                            CORR[s][t] = -1.f;
+                            ++pLevellingCount;
+                        }
+                    }
+                }
+            }
+
+            // plus loin Mtrx_dp_make  a besoin de savoir que la diagonale vaut 1
+            CORR[s][s] = 1.f;
+        }
+    }
+    else
+    {
+        // on calcule une ebauche de matrice utilisable pour tout le mois dans le cas ou
+        // accuracy =0
+        for (uint s = 0; s != processCount; ++s)
+        {
+            for (uint t = 0; t < s; ++t)
+            {
+                x = T[s] * T[t] * STDE[s] * STDE[t];
+                float z = D_COPIE[t] * STDE[s];
+                if (Utils::isZero(x))
+                {
+                    CORR[s][t] = 0.f;
+                }
+                else
+                {
+                    x = D_COPIE[s] * STDE[t] / z;
+                    CORR[s][t] = (*pCorrMonth)[s][t] * (x + 1.f / x) / 2.f;
+                    if (CORR[s][t] > 1.f)
+                    {
+                        CORR[s][t] = 1.f;
+                        ++pLevellingCount;
+                    }
+                    else
+                    {
+                        if (CORR[s][t] < -1.f)
+                        {
+                            CORR[s][t] = -1.f;
+                            ++pLevellingCount;
+                        }
+                    }
+                }
+            }
+
+            // plus loin Mtrx_dp_make  a besoin de savoir que la diagonale vaut 1
+            CORR[s][s] = 1.f;
+        }
+    }
+
+    // calcul et factorisation de la matrice  du mois
+    shrink = MatrixDPMake<float>(Triangle_courant,
+                                 CORR,
+                                 Carre_reference,
+                                 pCorrMonth->entry,
+                                 processCount,
+                                 pQCHOLTotal.data());
+    if (shrink == -1.f)
+    {
+        // sortie impossible  car on a v�rifi� que C est d.p
+        logs.error() << "TS " << pTSName << " generator: invalid correlation matrix";
+        return false;
+    }
+    return true;
+}
+
 bool XCast::generateValuesForTheCurrentDay()
 {
     enum
@@ -91,33 +190,9 @@ bool XCast::generateValuesForTheCurrentDay()
     }
 
     // si les parametres ont change on reinitialise certaines variables intermediaires
+    // (les matrices de correlation ont deja ete verifiees, cf validateCorrelationMatrices())
     if (pNewMonth)
     {
-        if (Cholesky<float>(Triangle_courant, pCorrMonth->entry, processCount, pQCHOLTotal.data()))
-        {
-            // C n'est pas sdp, mais peut-etre proche de sdp
-            // on tente un abattement de 0.999
-            for (uint i = 0; i != processCount; ++i)
-            {
-                // on ne traite qu'en dessous de la diagonale et celle-ci n'a pas change (=1
-                // partout)
-                for (uint j = 0; j < i; ++j)
-                {
-                    pCorrMonth->entry[i][j] *= 0.999f;
-                }
-            }
-
-            if (Cholesky<float>(Triangle_courant,
-                                pCorrMonth->entry,
-                                processCount,
-                                pQCHOLTotal.data()))
-            {
-                // la matrice C n'est pas admissible, on abandonne
-                logs.error() << "TS " << pTSName << " generator: invalid correlation matrix";
-                return false;
-            }
-        }
-
         for (uint s = 0; s != processCount; ++s)
         {
             MAXI[s] = maximum(A[s], B[s], G[s], D[s], L[s]);
@@ -147,96 +222,33 @@ bool XCast::generateValuesForTheCurrentDay()
                 BASI[s] = (1.f - ALPH[s]) * ESPE[s];
             }
         }
-        if (All_normal)
+
+        // la factorisation ne depend que du mois : elle n'est calculee qu'une seule fois
+        auto& factorisation = (*pData.factorisations)[pRealMonth];
         {
-            // assessement of a correlation matrix suitable for the month
-            for (uint s = 0; s != processCount; ++s)
+            std::lock_guard lock(factorisation.mutex);
+            if (factorisation.ready)
             {
-                for (uint t = 0; t < s; ++t)
-                {
-                    x = T[s] * T[t] * STDE[s] * STDE[t];
-                    if (Utils::isZero(x))
-                    {
-                        CORR[s][t] = 0.f;
-                    }
-                    else
-                    {
-                        x = 1.f - ALPH[s] * ALPH[t];
-                        x /= BETA[s];
-                        x /= BETA[t];
-                        CORR[s][t] = (*pCorrMonth)[s][t] * x;
-                        if (CORR[s][t] > 1.f)
-                        {
-                            CORR[s][t] = 1.f;
-                            ++pLevellingCount;
-                        }
-                        else
-                        {
-                            if (CORR[s][t] < -1.f)
-                            {
-                                CORR[s][t] = -1.f;
-                                ++pLevellingCount;
-                            }
-                        }
-                    }
-                }
-
-                // plus loin Mtrx_dp_make  a besoin de savoir que la diagonale vaut 1
-                CORR[s][s] = 1.f;
+                Triangle_courant = factorisation.triangle;
+                Carre_reference = factorisation.square;
+                shrink = factorisation.shrink;
+                pLevellingCount += factorisation.levellingCount;
             }
-        }
-        else
-        {
-            // on calcule une ebauche de matrice utilisable pour tout le mois dans le cas ou
-            // accuracy =0
-            for (uint s = 0; s != processCount; ++s)
+            else
             {
-                for (uint t = 0; t < s; ++t)
+                const uint levellingCount = pLevellingCount;
+                if (!makeMonthlyFactorisation(shrink))
                 {
-                    x = T[s] * T[t] * STDE[s] * STDE[t];
-                    float z = D_COPIE[t] * STDE[s];
-                    if (Utils::isZero(x))
-                    {
-                        CORR[s][t] = 0.f;
-                    }
-                    else
-                    {
-                        x = D_COPIE[s] * STDE[t] / z;
-                        CORR[s][t] = (*pCorrMonth)[s][t] * (x + 1.f / x) / 2.f;
-                        if (CORR[s][t] > 1.f)
-                        {
-                            CORR[s][t] = 1.f;
-                            ++pLevellingCount;
-                        }
-                        else
-                        {
-                            if (CORR[s][t] < -1.f)
-                            {
-                                CORR[s][t] = -1.f;
-                                ++pLevellingCount;
-                            }
-                        }
-                    }
+                    return false;
                 }
-
-                // plus loin Mtrx_dp_make  a besoin de savoir que la diagonale vaut 1
-                CORR[s][s] = 1.f;
+                factorisation.triangle = Triangle_courant;
+                factorisation.square = Carre_reference;
+                factorisation.shrink = shrink;
+                factorisation.levellingCount = pLevellingCount - levellingCount;
+                factorisation.ready = true;
             }
         }
 
-        // calcul et factorisation de la matrice  du mois
-        shrink = MatrixDPMake<float>(Triangle_courant,
-                                     CORR,
-                                     Carre_reference,
-                                     pCorrMonth->entry,
-                                     processCount,
-                                     pQCHOLTotal.data());
-        if (shrink == -1.f)
-        {
-            // sortie impossible  car on a v�rifi� que C est d.p
-            logs.error() << "TS " << pTSName << " generator: invalid correlation matrix";
-            return false;
-        }
         // sert pour le decompte final des matrices ndp quand accuracy=0
         Compteur_ndp = (shrink < 1.f) ? 100 : 0;
 
@@ -368,10 +380,7 @@ bool XCast::generateValuesForTheCurrentDay()
                 {
                     ++j;
                 }
-                for (uint k = 0; k < j; ++k)
-                {
-                    normal(WIEN[k], WIEN[j - (1 + k)]);
-                }
+                normals(j);
 
                 // correlated brownian motions
                 for (uint s = 0; s != processCount; ++s)
@@ -479,10 +488,7 @@ bool XCast::generateValuesForTheCurrentDay()
                 {
                     ++j;
                 }
-                for (uint k = 0; k < j; ++k)
-                {
-                    normal(WIEN[k], WIEN[j - (1 + k)]);
-                }
+                normals(j);
 
                 // calcul des mouvements browniens correles
                 for (uint s = 0; s != processCount; ++s)
@@ -28,25 +28,40 @@ namespace TSGenerator
 {
 namespace XCast
 {
-void XCast::normal(float& x, float& y)
+void XCast::normals(uint count)
 {
     assert(random);
+    assert(count <= WIEN.size() && count <= pPolarS.size());
 
-    double z;
-    double xd;
-    double yd;
-
-    do
+    // Points uniformly drawn in the unit disc
+    for (uint k = 0; k != count; ++k)
     {
-        xd = 2. * random->next() - 1.;
-        yd = 2. * random->next() - 1.;
-        z = (xd * xd) + (yd * yd);
-    } while (z > 1.);
+        double xd;
+        double yd;
+        double z;
+        do
+        {
+            xd = 2. * random->next() - 1.;
+            yd = 2. * random->next() - 1.;
+            z = (xd * xd) + (yd * yd);
+        } while (z > 1.);
+
+        pPolarX[k] = xd;
+        pPolarY[k] = yd;
+        pPolarS[k] = z;
+    }
 
-    const double u = sqrt(-2. * log(z) / z);
+    for (uint k = 0; k != count; ++k)
+    {
+        pPolarS[k] = sqrt(-2. * log(pPolarS[k]) / pPolarS[k]);
+    }
 
-    x = float(xd * u);
-    y = float(yd * u);
+    // Same order as the historical pairwise draws : later pairs overwrite earlier ones
+    for (uint k = 0; k != count; ++k)
+    {
+        WIEN[k] = float(pPolarX[k] * pPolarS[k]);
+        WIEN[count - (1 + k)] = float(pPolarY[k] * pPolarS[k]);
+    }
 }
 
 } // namespace XCast
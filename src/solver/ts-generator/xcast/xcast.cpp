@@ -21,13 +21,21 @@
 
 #include "antares/solver/ts-generator/xcast/xcast.h"
 
+#include <algorithm>
+#include <array>
 #include <limits>
+#include <numeric>
 #include <sstream>
 #include <string>
 
 #include <antares/antares/fatal-error.h>
 #include <antares/logs/logs.h>
+#include <antares/mersenne-twister/substream.h>
 #include <antares/study/study.h>
+#include <antares/utils/utils.h>
+#include "antares/solver/misc/cholesky.h"
+#include "antares/solver/ts-generator/parallel.h"
+#include "antares/solver/ts-generator/xcast/constants.h"
 #include "antares/solver/ts-generator/xcast/predicate.hxx"
 
 namespace fs = std::filesystem;
@@ -45,10 +53,41 @@ enum
     mu = Data::XCast::dataCoeffMu,
 };
 
-XCast::XCast(Data::Study& study, Data::TimeSeriesType ts, IResultWriter& writer):
+namespace
+{
+/*!
+** \brief Check that a correlation matrix is positive definite, shrinking it once if not
+*/
+bool MakePositiveDefinite(Matrix<float>& correlation)
+{
+    const uint size = correlation.width;
+    std::vector<std::vector<float>> factor(size, std::vector<float>(size));
+    std::vector<float> temp(size);
+
+    if (Cholesky<float>(factor, correlation.entry, size, temp.data()))
+    {
+        // C n'est pas sdp, mais peut-etre proche de sdp
+        // on tente un abattement de 0.999
+        for (uint i = 0; i != size; ++i)
+        {
+            // on ne traite qu'en dessous de la diagonale et celle-ci n'a pas change (=1
+            // partout)
+            for (uint j = 0; j < i; ++j)
+            {
+                correlation.entry[i][j] *= 0.999f;
+            }
+        }
+
+        return !Cholesky<float>(factor, correlation.entry, size, temp.data());
+    }
+    return true;
+}
+} // namespace
+
+XCast::XCast(Data::Study& study, Data::TimeSeriesType ts, TimeSeriesArchive& archive):
     study(study),
     timeSeriesType(ts),
-    pWriter(writer)
+    pArchive(archive)
 {
 }
 
@@ -68,17 +107,13 @@ void XCast::exportTimeSeriesToTheOutput(Progression::Task& progression, Predicat
                     << " time-series into the output (year:" << year << ')';
 
         fs::path output = "ts-generator";
-        output /= fs::path(predicate.timeSeriesName()) / std::string("mc-" + year);
+        output /= fs::path(predicate.timeSeriesName()) / ("mc-" + std::to_string(year));
 
         study.areas.each(
           [this, &progression, &predicate, &output](Data::Area& area)
           {
-              std::string areaId = area.id + "txt";
-              fs::path filename = output / areaId;
-              std::string buffer;
-              predicate.matrix(area).saveToBuffer(buffer);
-
-              pWriter.addEntryFromBuffer(filename, buffer);
+              fs::path filename = output / (area.id.to<std::string>() + ".txt");
+              pArchive.add(filename, predicate.matrix(area), 6);
 
               ++progression;
           });
@@ -207,6 +242,9 @@ void XCast::allocateTemporaryData()
     TREN.resize(p);
     WIEN.resize(p + 1);
     BROW.resize(p);
+    pPolarX.resize(p + 1);
+    pPolarY.resize(p + 1);
+    pPolarS.resize(p + 1);
 
     BASI.resize(p);
     ALPH.resize(p);
@@ -246,69 +284,14 @@ void XCast::allocateTemporaryData()
 }
 
 template<class PredicateT>
-bool XCast::runWithPredicate(PredicateT& predicate, Progression::Task& progression)
+void XCast::generateSeries(PredicateT& predicate,
+                           uint firstSeries,
+                           uint endSeries,
+                           Progression::Task& progression)
 {
-    pTSName = predicate.timeSeriesName();
-
-    {
-        logs.info();
-        logs.info() << "Generating the " << predicate.timeSeriesName() << " time-series";
-    }
-    for (uint s = 0; s != pData.localareas.size(); ++s)
-    {
-        if (not predicate.preproDataIsReader(*pData.localareas[s]))
-        {
-            logs.warning()
-              << "The timeseries will not be regenerated. All data related to the ts-generator for "
-              << "'" << predicate.timeSeriesName() << "' have been released.";
-            return false;
-        }
-    }
-
-    if (pNeverInitialized)
-    {
-        loadFromStudy(predicate.correlation(study), predicate);
-
-        allocateTemporaryData();
-
-        for (uint s = 0; s != pData.localareas.size(); ++s)
-        {
-            auto& area = *(pData.localareas[s]);
-
-            auto& xcast = predicate.xcastData(area);
-
-            pUseConversion[s] = (xcast.useConversion && xcast.conversion.width >= 3);
-        }
-
-        pAccuracyOnCorrelation = ((study.parameters.timeSeriesAccuracyOnCorrelation
-                                   & timeSeriesType)
-                                  != 0);
-    }
-
     const uint processCount = (uint)pData.localareas.size();
 
-    if (study.areas.size() > pData.localareas.size())
-    {
-        progression += (nbTimeseries_ * DAYS_PER_YEAR)
-                       * ((uint)study.areas.size() - (uint)pData.localareas.size());
-    }
-
-    if (processCount == 0)
-    {
-        if (study.parameters.timeSeriesToArchive & timeSeriesType)
-        {
-            exportTimeSeriesToTheOutput(progression, predicate);
-        }
-        return true;
-    }
-
-    updateMissingCoefficients(predicate);
-
-    pComputedPointCount = 0;
-    pNDPMatrixCount = 0;
-    pLevellingCount = 0;
-
-    for (uint tsIndex = 0; tsIndex != nbTimeseries_; ++tsIndex)
+    for (uint tsIndex = firstSeries; tsIndex != endSeries; ++tsIndex)
     {
         uint hourInTheYear = 0;
 
@@ -319,6 +302,7 @@ bool XCast::runWithPredicate(PredicateT& predicate, Progression::Task& progressi
             pNewMonth = true;
 
             pCorrMonth = &pData.correlation[realmonth];
+            pRealMonth = realmonth;
 
             for (uint s = 0; s != processCount; ++s)
             {
@@ -468,6 +452,282 @@ bool XCast::runWithPredicate(PredicateT& predicate, Progression::Task& progressi
             }
         }
     }
+}
+
+std::vector<std::vector<uint>> XCast::independentBlocks() const
+{
+    // Connected components of the graph linking the processes with a non-zero
+    // correlation, for at least one month
+    const uint processCount = (uint)pData.localareas.size();
+    std::vector<uint> component(processCount);
+    std::iota(component.begin(), component.end(), 0u);
+
+    auto root = [&component](uint s)
+    {
+        while (component[s] != s)
+        {
+            s = component[s] = component[component[s]];
+        }
+        return s;
+    };
+
+    for (const auto& correlation: pData.correlation)
+    {
+        if (correlation.width != processCount || correlation.height != processCount)
+        {
+            continue;
+        }
+        for (uint s = 1; s < processCount; ++s)
+        {
+            for (uint t = 0; t < s; ++t)
+            {
+                if (!Utils::isZero(correlation[s][t]))
+                {
+                    uint rs = root(s);
+                    uint rt = root(t);
+                    // The smallest index is the representative, to keep the order of the blocks
+                    component[std::max(rs, rt)] = std::min(rs, rt);
+                }
+            }
+        }
+    }
+
+    std::vector<std::vector<uint>> blocks;
+    std::vector<uint> blockOfRoot(processCount, 0);
+    for (uint s = 0; s != processCount; ++s)
+    {
+        uint r = root(s);
+        if (r == s)
+        {
+            blockOfRoot[s] = (uint)blocks.size();
+            blocks.emplace_back();
+        }
+        blocks[blockOfRoot[r]].push_back(s);
+    }
+    return blocks;
+}
+
+void XCast::initializeWorker(const XCast& source,
+                             const std::vector<uint>& processes,
+                             const std::string& streamName,
+                             std::shared_ptr<StudyData::Factorisations> factorisations)
+{
+    year = source.year;
+    nbTimeseries_ = source.nbTimeseries_;
+    pTSName = source.pTSName;
+    pAccuracyOnCorrelation = source.pAccuracyOnCorrelation;
+    pComputedPointCount = 0;
+    pNDPMatrixCount = 0;
+    pLevellingCount = 0;
+
+    pData.mode = source.pData.mode;
+    for (uint s: processes)
+    {
+        pData.localareas.push_back(source.pData.localareas[s]);
+    }
+
+    const uint count = (uint)processes.size();
+    for (uint realmonth = 0; realmonth != 12; ++realmonth)
+    {
+        const auto& from = source.pData.correlation[realmonth];
+        auto& to = pData.correlation[realmonth];
+        if (from.width == 0)
+        {
+            continue;
+        }
+        to.resize(count, count);
+        for (uint x = 0; x != count; ++x)
+        {
+            for (uint y = 0; y != count; ++y)
+            {
+                to[x][y] = from[processes[x]][processes[y]];
+            }
+        }
+    }
+
+    // The matrices of the source have already been validated, and so are their
+    // principal sub-matrices
+    pData.factorisations = std::move(factorisations);
+
+    allocateTemporaryData();
+    for (uint i = 0; i != count; ++i)
+    {
+        pUseConversion[i] = source.pUseConversion[processes[i]];
+    }
+
+    pRandomStream = MakeSubstream(seedOf(source.timeSeriesType), streamName, year);
+    random = &pRandomStream;
+}
+
+bool XCast::validateCorrelationMatrices()
+{
+    const uint processCount = (uint)pData.localareas.size();
+    std::array<bool, 12> valid;
+    valid.fill(true);
+
+    generateInParallel(nbThreads,
+                       12,
+                       [this, processCount, &valid](std::size_t realmonth)
+                       {
+                           auto& correlation = pData.correlation[realmonth];
+                           if (processCount != 0 && correlation.width == processCount)
+                           {
+                               valid[realmonth] = MakePositiveDefinite(correlation);
+                           }
+                       });
+
+    if (std::find(valid.begin(), valid.end(), false) != valid.end())
+    {
+        // la matrice C n'est pas admissible, on abandonne
+        logs.error() << "TS " << pTSName << " generator: invalid correlation matrix";
+        return false;
+    }
+    return true;
+}
+
+uint XCast::seedOf(Data::TimeSeriesType ts) const
+{
+    switch (ts)
+    {
+    case Data::timeSeriesLoad:
+        return study.parameters.seed[Data::seedTsGenLoad];
+    case Data::timeSeriesSolar:
+        return study.parameters.seed[Data::seedTsGenSolar];
+    case Data::timeSeriesWind:
+        return study.parameters.seed[Data::seedTsGenWind];
+    default:
+        throw FatalError("xcast: Invalid time series type.");
+    }
+}
+
+template<class PredicateT>
+void XCast::generateBlocksInParallel(PredicateT& predicate, Progression::Task& progression)
+{
+    // The workers write into disjoint columns : the matrices must not be shared anymore
+    for (auto* area: pData.localareas)
+    {
+        predicate.matrix(*area).detach();
+    }
+
+    // One worker per independent block of processes and per chunk of series, each one
+    // with its own random stream : the results do not depend on the number of threads
+    std::vector<std::unique_ptr<XCast>> workers;
+    std::vector<std::pair<uint, uint>> seriesRanges;
+    for (const auto& block: independentBlocks())
+    {
+        const std::string blockName = std::string(predicate.timeSeriesName()) + '/'
+                                      + pData.localareas[block.front()]->id.c_str();
+        auto& factorisations = pBlockFactorisations[block.front()];
+        if (!factorisations)
+        {
+            factorisations = std::make_shared<StudyData::Factorisations>();
+        }
+        for (uint first = 0, chunk = 0; first < nbTimeseries_; first += SERIES_PER_CHUNK, ++chunk)
+        {
+            auto worker = std::make_unique<XCast>(study, timeSeriesType, pArchive);
+            worker->initializeWorker(*this,
+                                     block,
+                                     blockName + '/' + std::to_string(chunk),
+                                     factorisations);
+            workers.push_back(std::move(worker));
+            seriesRanges.emplace_back(first, std::min(first + SERIES_PER_CHUNK, nbTimeseries_));
+        }
+    }
+
+    generateInParallel(nbThreads,
+                       workers.size(),
+                       [&workers, &seriesRanges, &predicate, &progression](std::size_t i)
+                       {
+                           auto [first, end] = seriesRanges[i];
+                           workers[i]->generateSeries(predicate, first, end, progression);
+                       });
+
+    for (const auto& worker: workers)
+    {
+        pComputedPointCount += worker->pComputedPointCount;
+        pNDPMatrixCount += worker->pNDPMatrixCount;
+        pLevellingCount += worker->pLevellingCount;
+    }
+}
+
+template<class PredicateT>
+bool XCast::runWithPredicate(PredicateT& predicate, Progression::Task& progression)
+{
+    pTSName = predicate.timeSeriesName();
+
+    {
+        logs.info();
+        logs.info() << "Generating the " << predicate.timeSeriesName() << " time-series";
+    }
+    for (uint s = 0; s != pData.localareas.size(); ++s)
+    {
+        if (not predicate.preproDataIsReader(*pData.localareas[s]))
+        {
+            logs.warning()
+              << "The timeseries will not be regenerated. All data related to the ts-generator for "
+              << "'" << predicate.timeSeriesName() << "' have been released.";
+            return false;
+        }
+    }
+
+    if (pNeverInitialized)
+    {
+        loadFromStudy(predicate.correlation(study), predicate);
+
+        allocateTemporaryData();
+
+        for (uint s = 0; s != pData.localareas.size(); ++s)
+        {
+            auto& area = *(pData.localareas[s]);
+
+            auto& xcast = predicate.xcastData(area);
+
+            pUseConversion[s] = (xcast.useConversion && xcast.conversion.width >= 3);
+        }
+
+        pAccuracyOnCorrelation = ((study.parameters.timeSeriesAccuracyOnCorrelation
+                                   & timeSeriesType)
+                                  != 0);
+
+        if (!validateCorrelationMatrices())
+        {
+            throw FatalError("xcast: Failed to generate values.");
+        }
+    }
+
+    const uint processCount = (uint)pData.localareas.size();
+
+    if (study.areas.size() > pData.localareas.size())
+    {
+        progression += (nbTimeseries_ * DAYS_PER_YEAR)
+                       * ((uint)study.areas.size() - (uint)pData.localareas.size());
+    }
+
+    if (processCount == 0)
+    {
+        if (study.parameters.timeSeriesToArchive & timeSeriesType)
+        {
+            exportTimeSeriesToTheOutput(progression, predicate);
+        }
+        return true;
+    }
+
+    updateMissingCoefficients(predicate);
+
+    pComputedPointCount = 0;
+    pNDPMatrixCount = 0;
+    pLevellingCount = 0;
+
+    using TsGenSeeding = Data::Parameters::Compatibility::TsGenSeeding;
+    if (study.parameters.compatibility.tsGenSeeding == TsGenSeeding::V1)
+    {
+        generateSeries(predicate, 0, nbTimeseries_, progression);
+    }
+    else
+    {
+        generateBlocksInParallel(predicate, progression);
+        pNeverInitialized = false;
+    }
 
     {
         uint y = ((pAccuracyOnCorrelation) ? pComputedPointCount : (nbTimeseries_ * 365));
@@ -193,7 +193,7 @@ public:
         //
         (void)::memcpy(pValuesForTheCurrentYear[numSpace].hour,
                        pArea->load.series.getColumn(year),
-                       sizeof(double) * pArea->load.series.timeSeries.height);
+                       sizeof(double) * pArea->load.series.numberOfTimesteps());
 
         // Next variable
         NextType::yearBegin(year, numSpace);
@@ -192,7 +192,7 @@ public:
             // The current solar time-series
             (void)::memcpy(pValuesForTheCurrentYear[numSpace].hour,
                            pArea->solar.series.getColumn(year),
-                           sizeof(double) * pArea->solar.series.timeSeries.height);
+                           sizeof(double) * pArea->solar.series.numberOfTimesteps());
         }
 
         // Next variable
@@ -191,7 +191,7 @@ public:
             // The current wind time-series
             (void)::memcpy(pValuesForTheCurrentYear[numSpace].hour,
                            pArea->wind.series.getColumn(year),
-                           sizeof(double) * pArea->wind.series.timeSeries.height);
+                           sizeof(double) * pArea->wind.series.numberOfTimesteps());
         }
 
         // Next variable
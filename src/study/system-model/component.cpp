@@ -42,15 +42,16 @@ static void checkComponentDataValidity(const ComponentData& data)
         throw std::invalid_argument("A component can't have an empty scenario_group_id");
     }
     // Check that parameters values are coherent with the model
-    if (data.model->Parameters().size() != data.parameter_values.size())
+    const auto nbParameters = data.parameter_values.size() + data.parameter_data_series.size();
+    if (data.model->Parameters().size() != nbParameters)
     {
         throw std::invalid_argument(
-          "The component \"" + data.id + "\" has " + std::to_string(data.parameter_values.size())
+          "The component \"" + data.id + "\" has " + std::to_string(nbParameters)
           + " parameter(s), but its model has " + std::to_string(data.model->Parameters().size()));
     }
     for (const auto param: data.model->Parameters() | std::views::keys)
     {
-        if (!data.parameter_values.contains(param))
+        if (!data.parameter_values.contains(param) && !data.parameter_data_series.contains(param))
         {
             throw std::invalid_argument("The component \"" + data.id
                                         + "\" has no value for parameter '" + param + "'");
@@ -102,6 +103,21 @@ ComponentBuilder& ComponentBuilder::withParameterValues(
     return *this;
 }
 
+/**
+ * \brief Sets the parameters of the component whose values are read from a data series, for the
+ * scenario and the timesteps of the problem. Together with the parameter values, they should
+ * include all of the model's parameters.
+ *
+ * \param parameter_data_series The map of data series ids to set, by parameter.
+ * \return Reference to the ComponentBuilder object.
+ */
+ComponentBuilder& ComponentBuilder::withParameterDataSeries(
+  std::map<std::string, std::string> parameter_data_series)
+{
+    data_.parameter_data_series = std::move(parameter_data_series);
+    return *this;
+}
+
 /**
  * \brief Sets the ID of the scenario group to which the component belongs.
  *
@@ -37,6 +37,8 @@ public:
     std::string id;
     const Model* model = nullptr;
     std::map<std::string, double> parameter_values;
+    // Parameters whose values are read from a data series, by id of the data series
+    std::map<std::string, std::string> parameter_data_series;
     std::string scenario_group_id;
 
     void reset()
@@ -44,6 +46,7 @@ public:
         id.clear();
         model = nullptr;
         parameter_values.clear();
+        parameter_data_series.clear();
         scenario_group_id.clear();
     }
 };
@@ -82,6 +85,11 @@ public:
         return data_.parameter_values.at(parameter_id);
     }
 
+    const std::map<std::string, std::string>& getParameterDataSeries() const
+    {
+        return data_.parameter_data_series;
+    }
+
     std::string getScenarioGroupId() const
     {
         return data_.scenario_group_id;
@@ -100,6 +108,8 @@ public:
     ComponentBuilder& withId(std::string_view id);
     ComponentBuilder& withModel(const Model* model);
     ComponentBuilder& withParameterValues(std::map<std::string, double> parameter_values);
+    ComponentBuilder& withParameterDataSeries(
+      std::map<std::string, std::string> parameter_data_series);
     ComponentBuilder& withScenarioGroupId(const std::string& scenario_group_id);
     Component build();
 
@@ -224,3 +224,41 @@ BOOST_AUTO_TEST_CASE(medium_expression)
     Visitors::CompareVisitor cmp;
     BOOST_CHECK(cmp.dispatch(expr.node, div));
 }
+
+BOOST_AUTO_TEST_CASE(cached_expression_is_resolved_for_each_model)
+{
+    YmlModel::Model withParameter{.id = "model0",
+                                  .description = "",
+                                  .parameters = {{"x", false, false}},
+                                  .variables = {},
+                                  .ports = {},
+                                  .port_field_definitions = {},
+                                  .constraints = {},
+                                  .objective = ""};
+    YmlModel::Model withVariable{.id = "model1",
+                                 .description = "",
+                                 .parameters = {},
+                                 .variables = {{"x", "0", "1", YmlModel::ValueType::CONTINUOUS}},
+                                 .ports = {},
+                                 .port_field_definitions = {},
+                                 .constraints = {},
+                                 .objective = ""};
+
+    ModelConverter::ExpressionCache cache;
+    auto first = cache.convert("2 * x", withParameter);
+    auto second = cache.convert("2 * x", withVariable);
+    BOOST_CHECK(cache.convert("", withVariable).node == nullptr);
+
+    Registry<Nodes::Node> registry;
+    auto* l2 = registry.create<Nodes::LiteralNode>(2);
+    auto* withParameterExpected = registry.create<Nodes::MultiplicationNode>(
+      l2,
+      registry.create<Nodes::ParameterNode>("x"));
+    auto* withVariableExpected = registry.create<Nodes::MultiplicationNode>(
+      l2,
+      registry.create<Nodes::VariableNode>("x"));
+
+    Visitors::CompareVisitor cmp;
+    BOOST_CHECK(cmp.dispatch(first.node, withParameterExpected));
+    BOOST_CHECK(cmp.dispatch(second.node, withVariableExpected));
+}
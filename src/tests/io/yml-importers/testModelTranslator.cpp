@@ -141,6 +141,27 @@ BOOST_FIXTURE_TEST_CASE(model_parameters_properly_translated, Fixture)
     BOOST_CHECK(!parameter2.isScenarioDependent());
 }
 
+// Test models sharing the same expressions
+BOOST_FIXTURE_TEST_CASE(same_bound_in_two_models___same_nodes, Fixture)
+{
+    YmlModel::Model model1{.id = "model1",
+                           .description = "description",
+                           .parameters = {{"pmax", true, false}},
+                           .variables = {{"var1", "0", "2 * pmax", YmlModel::ValueType::FLOAT}},
+                           .ports = {},
+                           .port_field_definitions = {},
+                           .constraints = {},
+                           .objective = ""};
+    YmlModel::Model model2 = model1;
+    model2.id = "model2";
+    library.models = {model1, model2};
+    SystemModel::Library lib = ModelConverter::convert(library);
+    const auto* bound1 = lib.Models().at("model1").Variables().at("var1").UpperBound().RootNode();
+    const auto* bound2 = lib.Models().at("model2").Variables().at("var1").UpperBound().RootNode();
+    BOOST_CHECK(bound1);
+    BOOST_CHECK_EQUAL(bound1, bound2);
+}
+
 // Test library with models and variables
 BOOST_FIXTURE_TEST_CASE(model_variables_properly_translated, Fixture)
 {
@@ -21,6 +21,8 @@
 
 #define WIN32_LEAN_AND_MEAN
 
+#include <yaml-cpp/exceptions.h>
+
 #include <boost/test/unit_test.hpp>
 
 #include <antares/io/inputs/yml-system/converter.h>
@@ -182,3 +184,95 @@ BOOST_AUTO_TEST_CASE(component_two_parameters)
     BOOST_CHECK_EQUAL(param2.type, "constant");
     BOOST_CHECK_EQUAL(param2.value, 100);
 }
+
+BOOST_AUTO_TEST_CASE(unknown_keys_are_ignored)
+{
+    YmlSystem::Parser parser;
+    const auto system = R"(
+        metadata: {author: someone, tags: [a, b]}
+        system:
+            id: base_system
+            connections:
+                - component1: N
+                  component2: G
+            components:
+                - id: N
+                  model: std.node
+                  scenario-group: group-234
+                  position: {x: 1, y: [2, 3]}
+                  parameters:
+                    - id: cost
+                      type: constant
+                      value: 30
+                      unit: {name: euro}
+    )"s;
+    YmlSystem::System systemObj = parser.parse(system);
+    BOOST_CHECK_EQUAL(systemObj.id, "base_system");
+    BOOST_REQUIRE_EQUAL(systemObj.components.size(), 1);
+    BOOST_REQUIRE_EQUAL(systemObj.components[0].parameters.size(), 1);
+    BOOST_CHECK_EQUAL(systemObj.components[0].parameters[0].value, 30);
+}
+
+BOOST_AUTO_TEST_CASE(aliases_are_resolved)
+{
+    YmlSystem::Parser parser;
+    const auto system = R"(
+        system:
+            id: base_system
+            components:
+                - id: N
+                  model: &node std.node
+                  scenario-group: group-234
+                  parameters: &params
+                    - id: cost
+                      type: constant
+                      value: 1.5e2
+                - id: N2
+                  model: *node
+                  scenario-group: group-234
+                  parameters: *params
+    )"s;
+    YmlSystem::System systemObj = parser.parse(system);
+    BOOST_REQUIRE_EQUAL(systemObj.components.size(), 2);
+    BOOST_CHECK_EQUAL(systemObj.components[1].model, "std.node");
+    BOOST_REQUIRE_EQUAL(systemObj.components[1].parameters.size(), 1);
+    BOOST_CHECK_EQUAL(systemObj.components[1].parameters[0].value, 150);
+}
+
+BOOST_AUTO_TEST_CASE(missing_component_model_throws)
+{
+    YmlSystem::Parser parser;
+    const auto system = R"(
+        system:
+            id: base_system
+            components:
+                - id: N
+                  scenario-group: group-234
+    )"s;
+    BOOST_CHECK_THROW(parser.parse(system), YAML::Exception);
+}
+
+BOOST_AUTO_TEST_CASE(parameter_value_not_a_number_throws)
+{
+    YmlSystem::Parser parser;
+    const auto system = R"(
+        system:
+            id: base_system
+            components:
+                - id: N
+                  model: std.node
+                  scenario-group: group-234
+                  parameters:
+                    - id: cost
+                      type: constant
+                      value: thirty
+    )"s;
+    BOOST_CHECK_THROW(parser.parse(system), YAML::Exception);
+}
+
+BOOST_AUTO_TEST_CASE(missing_system_throws)
+{
+    YmlSystem::Parser parser;
+    BOOST_CHECK_THROW(parser.parse("other: 1"s), YAML::Exception);
+    BOOST_CHECK_THROW(parser.parse(""s), YAML::Exception);
+}
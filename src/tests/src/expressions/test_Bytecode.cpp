@@ -0,0 +1,189 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/expressions/Registry.hxx>
+#include <antares/expressions/bytecode/Compiler.h>
+#include <antares/expressions/bytecode/Evaluator.h>
+#include <antares/expressions/nodes/ExpressionsNodes.h>
+#include <antares/expressions/visitors/EvalVisitor.h>
+
+using namespace Antares::Expressions;
+using namespace Antares::Expressions::Bytecode;
+using namespace Antares::Expressions::Nodes;
+using namespace Antares::Expressions::Visitors;
+
+BOOST_AUTO_TEST_SUITE(_Bytecode_)
+
+BOOST_FIXTURE_TEST_CASE(constant_expression___same_value_as_eval_visitor, Registry<Node>)
+{
+    // (p1 + 2.5) * -p2 / 4 - (1.5 + p1 + p2)
+    Node* root = create<SubtractionNode>(
+      create<DivisionNode>(
+        create<MultiplicationNode>(create<SumNode>(create<ParameterNode>("p1"),
+                                                   create<LiteralNode>(2.5)),
+                                   create<NegationNode>(create<ParameterNode>("p2"))),
+        create<LiteralNode>(4)),
+      create<SumNode>(create<LiteralNode>(1.5),
+                      create<ParameterNode>("p1"),
+                      create<ParameterNode>("p2")));
+    std::map<std::string, double> parameters{{"p1", 3.}, {"p2", -7.}};
+
+    auto program = compile(root);
+    BOOST_CHECK(program.variables.empty());
+    BOOST_CHECK_EQUAL(program.parameters.size(), 2);
+
+    Evaluator evaluator(bindParameters(program.parameters, parameters));
+    EvalVisitor evalVisitor(EvaluationContext(parameters, {}));
+    BOOST_CHECK_EQUAL(evaluator.run(program.offset), evalVisitor.dispatch(root));
+}
+
+BOOST_FIXTURE_TEST_CASE(literals_only___folded_into_one_constant, Registry<Node>)
+{
+    Node* root = create<MultiplicationNode>(create<SumNode>(create<LiteralNode>(1),
+                                                            create<LiteralNode>(2)),
+                                            create<NegationNode>(create<LiteralNode>(4)));
+
+    auto program = compile(root);
+    BOOST_REQUIRE_EQUAL(program.offset.instructions.size(), 1);
+    BOOST_CHECK(program.offset.instructions[0].op == OpCode::CONSTANT);
+
+    Evaluator evaluator({});
+    BOOST_CHECK_EQUAL(evaluator.run(program.offset), -12.);
+}
+
+BOOST_FIXTURE_TEST_CASE(linear_expression___offset_and_coefficients, Registry<Node>)
+{
+    // 2 * x + p * (y - x) / 4 - 3 + p
+    Node* root = create<SumNode>(
+      create<MultiplicationNode>(create<LiteralNode>(2), create<VariableNode>("x")),
+      create<DivisionNode>(
+        create<MultiplicationNode>(create<ParameterNode>("p"),
+                                   create<SubtractionNode>(create<VariableNode>("y"),
+                                                           create<VariableNode>("x"))),
+        create<LiteralNode>(4)),
+      create<NegationNode>(create<LiteralNode>(3)),
+      create<ParameterNode>("p"));
+
+    auto program = compile(root);
+    BOOST_REQUIRE_EQUAL(program.variables.size(), 2);
+    BOOST_CHECK_EQUAL(program.variables[0], "x");
+    BOOST_CHECK_EQUAL(program.variables[1], "y");
+    BOOST_REQUIRE_EQUAL(program.coefficients.size(), 2);
+
+    std::map<std::string, double> parameters{{"p", 8.}};
+    Evaluator evaluator(bindParameters(program.parameters, parameters));
+    BOOST_CHECK_EQUAL(evaluator.run(program.offset), 5.);
+    BOOST_CHECK_EQUAL(evaluator.run(program.coefficients[0]), 0.);
+    BOOST_CHECK_EQUAL(evaluator.run(program.coefficients[1]), 2.);
+}
+
+BOOST_FIXTURE_TEST_CASE(time_dependent_parameter___evaluated_over_a_range, Registry<Node>)
+{
+    // 2 * p - q
+    Node* root = create<SubtractionNode>(create<MultiplicationNode>(create<LiteralNode>(2),
+                                                                    create<ParameterNode>("p")),
+                                         create<ParameterNode>("q"));
+    auto program = compile(root);
+    BOOST_REQUIRE_EQUAL(program.parameters.size(), 2);
+
+    const std::vector<double> p{1., 2., 3., 4., 5.};
+    const double q = 0.5;
+    Evaluator evaluator({{p.data(), true}, {&q, false}});
+
+    std::vector<double> values(3);
+    evaluator.run(program.offset, 1, values);
+    BOOST_CHECK_EQUAL(values[0], 3.5);
+    BOOST_CHECK_EQUAL(values[1], 5.5);
+    BOOST_CHECK_EQUAL(values[2], 7.5);
+}
+
+BOOST_FIXTURE_TEST_CASE(non_linear_expression___not_compiled, Registry<Node>)
+{
+    Node* root = create<MultiplicationNode>(create<VariableNode>("x"),
+                                            create<VariableNode>("y"));
+    BOOST_CHECK_THROW(compile(root), std::invalid_argument);
+}
+
+BOOST_FIXTURE_TEST_CASE(comparison___not_compiled, Registry<Node>)
+{
+    Node* root = create<EqualNode>(create<VariableNode>("x"), create<LiteralNode>(1));
+    BOOST_CHECK_THROW(compile(root), std::invalid_argument);
+}
+
+BOOST_FIXTURE_TEST_CASE(division_by_zero___throws_at_evaluation, Registry<Node>)
+{
+    Node* root = create<DivisionNode>(create<LiteralNode>(1), create<ParameterNode>("p"));
+    auto program = compile(root);
+
+    const std::vector<double> p{1., 0.};
+    Evaluator evaluator({{p.data(), true}});
+    std::vector<double> values(2);
+    BOOST_CHECK_THROW(evaluator.run(program.offset, 0, values), EvalVisitorDivisionException);
+}
+
+BOOST_FIXTURE_TEST_CASE(zero_divided_by_zero___throws_as_eval_visitor, Registry<Node>)
+{
+    Node* literals = create<DivisionNode>(create<LiteralNode>(0), create<LiteralNode>(0));
+    EvalVisitor evalVisitor;
+    BOOST_CHECK_THROW(evalVisitor.dispatch(literals), EvalVisitorDivisionException);
+
+    Evaluator evaluator({});
+    BOOST_CHECK_THROW(evaluator.run(compile(literals).offset), EvalVisitorDivisionException);
+
+    // The offset of x / 0 is 0 / 0
+    Node* variable = create<DivisionNode>(create<VariableNode>("x"), create<LiteralNode>(0));
+    BOOST_CHECK_THROW(evaluator.run(compile(variable).offset), EvalVisitorDivisionException);
+
+    // A product by 0 keeps the division
+    Node* product = create<MultiplicationNode>(create<VariableNode>("x"), literals);
+    BOOST_CHECK_THROW(evaluator.run(compile(product).offset), EvalVisitorDivisionException);
+}
+
+BOOST_FIXTURE_TEST_CASE(constraint___difference_of_its_sides, Registry<Node>)
+{
+    // 2 * x + p <= y - 3
+    Node* root = create<LessThanOrEqualNode>(
+      create<SumNode>(create<MultiplicationNode>(create<LiteralNode>(2),
+                                                 create<VariableNode>("x")),
+                      create<ParameterNode>("p")),
+      create<SubtractionNode>(create<VariableNode>("y"), create<LiteralNode>(3)));
+
+    auto constraint = compileConstraint(root);
+    BOOST_CHECK(constraint.comparison == Comparison::LESS_THAN_OR_EQUAL);
+    const auto& program = constraint.difference;
+    BOOST_REQUIRE_EQUAL(program.variables.size(), 2);
+
+    std::map<std::string, double> parameters{{"p", 4.}};
+    Evaluator evaluator(bindParameters(program.parameters, parameters));
+    BOOST_CHECK_EQUAL(evaluator.run(program.offset), 7.);
+    BOOST_CHECK_EQUAL(evaluator.run(program.coefficients[0]), 2.);
+    BOOST_CHECK_EQUAL(evaluator.run(program.coefficients[1]), -1.);
+
+    BOOST_CHECK_THROW(compileConstraint(create<VariableNode>("x")), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
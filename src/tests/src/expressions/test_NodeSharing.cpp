@@ -0,0 +1,161 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/expressions/NodeInterner.h>
+#include <antares/expressions/nodes/ExpressionsNodes.h>
+#include <antares/expressions/visitors/CloneVisitor.h>
+#include <antares/expressions/visitors/CompareVisitor.h>
+#include <antares/expressions/visitors/LinearityVisitor.h>
+#include <antares/expressions/visitors/PortFieldSubstitutionVisitor.h>
+
+using namespace Antares::Expressions;
+using namespace Antares::Expressions::Nodes;
+using namespace Antares::Expressions::Visitors;
+
+namespace
+{
+struct SharingRegistryFixture
+{
+    Registry<Node> registry = makeSharingRegistry();
+};
+
+// 3 * x + y, built from scratch each time
+Node* build(Registry<Node>& registry)
+{
+    auto* product = registry.create<MultiplicationNode>(registry.create<LiteralNode>(3.),
+                                                        registry.create<VariableNode>("x"));
+    return registry.create<SumNode>(product, registry.create<ParameterNode>("y"));
+}
+
+// Counts the calls to visit, shared nodes included
+class CountingCloneVisitor: public CloneVisitor
+{
+public:
+    using CloneVisitor::CloneVisitor;
+
+    unsigned literals = 0;
+
+private:
+    Node* visit(const LiteralNode* node) override
+    {
+        literals++;
+        return CloneVisitor::visit(node);
+    }
+};
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(_NodeSharing_)
+
+BOOST_FIXTURE_TEST_CASE(identical_expressions___built_once, SharingRegistryFixture)
+{
+    Node* first = build(registry);
+    const auto size = registry.size();
+    Node* second = build(registry);
+    BOOST_CHECK_EQUAL(first, second);
+    BOOST_CHECK_EQUAL(registry.size(), size);
+    BOOST_CHECK_EQUAL(size, 5);
+}
+
+BOOST_FIXTURE_TEST_CASE(different_values___not_shared, SharingRegistryFixture)
+{
+    BOOST_CHECK_NE(registry.create<LiteralNode>(0.), registry.create<LiteralNode>(-0.));
+    BOOST_CHECK_NE(registry.create<VariableNode>("x"),
+                   registry.create<VariableNode>("x", TimeIndex::CONSTANT_IN_TIME_AND_SCENARIO));
+    BOOST_CHECK_NE(static_cast<Node*>(registry.create<VariableNode>("x")),
+                   static_cast<Node*>(registry.create<ParameterNode>("x")));
+
+    Node* x = registry.create<VariableNode>("x");
+    Node* y = registry.create<VariableNode>("y");
+    BOOST_CHECK_NE(static_cast<Node*>(registry.create<SubtractionNode>(x, y)),
+                   static_cast<Node*>(registry.create<SubtractionNode>(y, x)));
+    BOOST_CHECK_NE(static_cast<Node*>(registry.create<SubtractionNode>(x, y)),
+                   static_cast<Node*>(registry.create<DivisionNode>(x, y)));
+    BOOST_CHECK_EQUAL(registry.create<PortFieldNode>("port", "field"),
+                      registry.create<PortFieldNode>("port", "field"));
+    BOOST_CHECK_NE(registry.create<PortFieldNode>("port", "field"),
+                   registry.create<PortFieldNode>("port", "other"));
+}
+
+BOOST_FIXTURE_TEST_CASE(default_registry___nodes_not_shared, Registry<Node>)
+{
+    BOOST_CHECK_NE(build(*this), build(*this));
+    BOOST_CHECK_EQUAL(size(), 10);
+}
+
+BOOST_FIXTURE_TEST_CASE(clone_of_shared_subtree___visited_once_and_still_shared, Registry<Node>)
+{
+    Node* shared = create<MultiplicationNode>(create<LiteralNode>(3.), create<VariableNode>("x"));
+    Node* root = create<SumNode>(shared, shared, create<NegationNode>(shared));
+
+    CountingCloneVisitor cloneVisitor(*this);
+    auto* cloned = dynamic_cast<SumNode*>(cloneVisitor.dispatch(root));
+    BOOST_REQUIRE(cloned);
+    BOOST_CHECK_EQUAL(cloneVisitor.literals, 1);
+    BOOST_CHECK_NE(cloned->getOperands()[0], shared);
+    BOOST_CHECK_EQUAL(cloned->getOperands()[0], cloned->getOperands()[1]);
+    BOOST_CHECK_EQUAL(dynamic_cast<NegationNode*>(cloned->getOperands()[2])->child(),
+                      cloned->getOperands()[0]);
+    BOOST_CHECK(CompareVisitor().dispatch(root, cloned));
+
+    // Results are not kept from one traversal to the next
+    cloneVisitor.dispatch(root);
+    BOOST_CHECK_EQUAL(cloneVisitor.literals, 2);
+}
+
+BOOST_FIXTURE_TEST_CASE(deep_shared_dag___visited_in_linear_time, SharingRegistryFixture)
+{
+    // 2^200 paths from the root to the leaf, 201 distinct nodes
+    Node* node = registry.create<VariableNode>("x");
+    for (int i = 0; i < 200; i++)
+    {
+        node = registry.create<SumNode>(node, node);
+    }
+    BOOST_CHECK_EQUAL(registry.size(), 201);
+    BOOST_CHECK(LinearityVisitor().dispatch(node) == LinearStatus::LINEAR);
+}
+
+BOOST_FIXTURE_TEST_CASE(model_substituted_for_identical_components___shared,
+                        SharingRegistryFixture)
+{
+    Registry<Node> model;
+    Node* expression = model.create<SubtractionNode>(model.create<VariableNode>("p"),
+                                                     model.create<PortFieldNode>("port", "flow"));
+
+    Node* flow = registry.create<VariableNode>("flow");
+    PortFieldSubstitutionContext ctx;
+    ctx.portfield.emplace(std::piecewise_construct,
+                          std::forward_as_tuple("port", "flow"),
+                          std::forward_as_tuple(flow));
+
+    PortFieldSubstitutionVisitor first(registry, ctx);
+    PortFieldSubstitutionVisitor second(registry, ctx);
+    Node* substituted = first.dispatch(expression);
+    BOOST_CHECK_EQUAL(substituted, second.dispatch(expression));
+    BOOST_CHECK_EQUAL(dynamic_cast<SubtractionNode*>(substituted)->right(), flow);
+    BOOST_CHECK_EQUAL(registry.size(), 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -352,3 +352,73 @@ BOOST_AUTO_TEST_CASE(global_JIT_ON_jit_off___matrix_cleared)
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+// ================================
+// ===  Binary buffers          ===
+// ================================
+BOOST_AUTO_TEST_SUITE(binary_buffer)
+
+BOOST_AUTO_TEST_CASE(save_then_load___same_coeffs_same_dims_same_precision)
+{
+    Matrix_easy_to_fill<double, double> mtx(2, 3, {1.25, 0, -3, 4e-7, 5, 1e12});
+    std::string buffer;
+    mtx.saveToBinaryBuffer(buffer, 2);
+
+    Matrix<double, double> loaded;
+    uint precision = 0;
+    BOOST_REQUIRE(loaded.loadFromBinaryBuffer(buffer, &precision));
+    BOOST_CHECK_EQUAL(precision, 2);
+    BOOST_REQUIRE_EQUAL(loaded.width, mtx.width);
+    BOOST_REQUIRE_EQUAL(loaded.height, mtx.height);
+    for (uint x = 0; x < mtx.width; ++x)
+    {
+        for (uint y = 0; y < mtx.height; ++y)
+        {
+            BOOST_CHECK_EQUAL(loaded[x][y], mtx[x][y]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(loaded_matrix_saved_into_text___same_text_as_original)
+{
+    Matrix_easy_to_fill<double, double> mtx(2, 2, {1.25, 0, -3, 4.5});
+    std::string binary;
+    mtx.saveToBinaryBuffer(binary, 1);
+
+    Matrix_easy_to_fill<double, double> loaded;
+    uint precision = 0;
+    BOOST_REQUIRE(loaded.loadFromBinaryBuffer(binary, &precision));
+
+    std::string expected;
+    std::string actual;
+    mtx.saveToBuffer(expected, 1);
+    loaded.saveToBuffer(actual, precision);
+    BOOST_CHECK_EQUAL(actual, expected);
+}
+
+BOOST_AUTO_TEST_CASE(truncated_or_foreign_buffer___not_loaded)
+{
+    Matrix_easy_to_fill<double, double> mtx(2, 2, {1, 2, 3, 4});
+    std::string buffer;
+    mtx.saveToBinaryBuffer(buffer);
+
+    Matrix<double, double> loaded;
+    BOOST_CHECK(!loaded.loadFromBinaryBuffer(buffer.substr(0, buffer.size() - 1)));
+    BOOST_CHECK(!loaded.loadFromBinaryBuffer("1\t2\n3\t4\n"));
+
+    Matrix<float, float> otherType;
+    BOOST_CHECK(!otherType.loadFromBinaryBuffer(buffer));
+}
+
+BOOST_AUTO_TEST_CASE(dimensions_whose_size_overflows___not_loaded)
+{
+    // 2^31 x 2^31 doubles : the size in bytes wraps around to 0, the size of an empty matrix
+    const uint32_t header[4] = {1u << 31, 1u << 31, 0, sizeof(double)};
+    std::string buffer("ANTSMTX1");
+    buffer.append(reinterpret_cast<const char*>(header), sizeof(header));
+
+    Matrix<double, double> loaded;
+    BOOST_CHECK(!loaded.loadFromBinaryBuffer(buffer));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -20,6 +20,9 @@
 */
 #define BOOST_TEST_MODULE "test inifile IO"
 
+#include <filesystem>
+#include <fstream>
+
 #include <boost/test/unit_test.hpp>
 
 #include "antares/inifile/inifile.h"
@@ -194,6 +197,68 @@ BOOST_FIXTURE_TEST_CASE(checking_created_properties_content, ReadFromStreamFixtu
     BOOST_CHECK_EQUAL(property->value, "value 2");
 }
 
+BOOST_FIXTURE_TEST_CASE(duplicated_keys___the_first_one_is_found, ReadFromStreamFixture)
+{
+    ini_content += "[section 1]\n";
+    ini_content += "Key 1 = value 1\n";
+    ini_content += "key 1 = value 2\n";
+    std::istringstream input_stream(ini_content);
+
+    BOOST_CHECK(my_inifile.readStream(input_stream));
+
+    section = my_inifile.find("section 1");
+    BOOST_CHECK_EQUAL(section->size(), 2);
+    property = section->find("key 1");
+    BOOST_CHECK(property);
+    BOOST_CHECK_EQUAL(property->value, "value 1");
+    BOOST_CHECK(!section->find("Key 1")); // keys are stored in lower case
+}
+
+BOOST_FIXTURE_TEST_CASE(windows_line_endings_are_ignored, ReadFromStreamFixture)
+{
+    ini_content += "[section 1]\r\n";
+    ini_content += "key 1 = value 1\r\n";
+    ini_content += "\r\n";
+    ini_content += "; comment\r\n";
+
+    BOOST_CHECK(my_inifile.readString(ini_content));
+
+    section = my_inifile.find("section 1");
+    BOOST_CHECK(section);
+    property = section->find("key 1");
+    BOOST_CHECK(property);
+    BOOST_CHECK_EQUAL(property->value, "value 1");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(loading_several_files)
+
+BOOST_AUTO_TEST_CASE(files_are_returned_in_the_given_order)
+{
+    auto folder = std::filesystem::temp_directory_path();
+    std::vector<std::filesystem::path> filenames;
+    for (int i = 0; i < 20; ++i)
+    {
+        filenames.push_back(folder / ("test-inifile-" + std::to_string(i) + ".ini"));
+        std::ofstream(filenames.back()) << "[section " << i << "]\nkey = " << i << '\n';
+    }
+    filenames.push_back(folder / "test-inifile-does-not-exist.ini");
+
+    auto inis = Antares::IniFile::OpenAll(filenames, 4, false);
+
+    BOOST_REQUIRE_EQUAL(inis.size(), filenames.size());
+    for (int i = 0; i < 20; ++i)
+    {
+        BOOST_REQUIRE(inis[i]);
+        auto* section = inis[i]->find("section " + std::to_string(i));
+        BOOST_REQUIRE(section);
+        BOOST_CHECK_EQUAL(section->read<int>("key", -1), i);
+        std::filesystem::remove(filenames[i]);
+    }
+    BOOST_CHECK(!inis.back());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 struct SavingToStreamFixture
@@ -0,0 +1,162 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE test archive
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "antares/io/archive.h"
+
+extern "C"
+{
+#include <mz.h>
+#include <mz_strm.h>
+#include <mz_zip.h>
+#include <mz_zip_rw.h>
+}
+
+namespace fs = std::filesystem;
+
+namespace
+{
+void addEntry(void* writer, const std::string& name, std::string content)
+{
+    mz_zip_file info = {};
+    info.filename = name.c_str();
+    info.compression_method = MZ_COMPRESS_METHOD_DEFLATE;
+    BOOST_REQUIRE(mz_zip_writer_add_buffer(writer,
+                                           content.data(),
+                                           static_cast<int32_t>(content.size()),
+                                           &info)
+                  == MZ_OK);
+}
+
+struct ArchiveFixture
+{
+    ArchiveFixture()
+    {
+        fs::create_directories(folder);
+
+        void* writer = mz_zip_writer_create();
+        BOOST_REQUIRE(mz_zip_writer_open_file(writer, archive.string().c_str(), 0, 0) == MZ_OK);
+        addEntry(writer, "my-study/study.antares", "[antares]\nversion = 880\n");
+        addEntry(writer, "my-study/input/load/series/load_fr.txt", "1\t2\n3\t4\n");
+        for (int i = 0; i < 50; ++i)
+        {
+            addEntry(writer,
+                     "my-study/input/other/file-" + std::to_string(i) + ".txt",
+                     std::string(1000 + i, 'a' + i % 26));
+        }
+        mz_zip_writer_close(writer);
+        mz_zip_writer_delete(&writer);
+    }
+
+    ~ArchiveFixture()
+    {
+        Antares::IO::unmountArchives();
+        fs::remove_all(folder);
+    }
+
+    fs::path folder = fs::temp_directory_path() / "test-archive";
+    fs::path archive = folder / "study.zip";
+    fs::path mountPoint = folder / "study";
+};
+} // namespace
+
+BOOST_FIXTURE_TEST_CASE(study_folder_of_the_archive_is_its_root, ArchiveFixture)
+{
+    Antares::IO::ZipArchive zip(archive);
+
+    BOOST_CHECK(zip.containsFile("study.antares"));
+    BOOST_CHECK(zip.containsFile("input/load/series/load_fr.txt"));
+    BOOST_CHECK(zip.contains("input/load"));
+    BOOST_CHECK(!zip.containsFile("input/load"));
+    BOOST_CHECK(!zip.contains("my-study/study.antares"));
+    BOOST_CHECK_EQUAL(zip.fileSize("input/load/series/load_fr.txt"), 8);
+
+    std::string content;
+    BOOST_CHECK(zip.read("input/load/series/load_fr.txt", content));
+    BOOST_CHECK_EQUAL(content, "1\t2\n3\t4\n");
+}
+
+BOOST_FIXTURE_TEST_CASE(mounted_archive_is_read_in_place, ArchiveFixture)
+{
+    Antares::IO::mountArchive(archive, mountPoint);
+    BOOST_CHECK(fs::is_directory(mountPoint));
+
+    BOOST_CHECK(Antares::IO::exists(mountPoint / "study.antares"));
+    BOOST_CHECK(Antares::IO::exists(mountPoint / "input" / "load"));
+    BOOST_CHECK(
+      Antares::IO::isArchivedFile(mountPoint / "input" / "load" / "series" / "load_fr.txt"));
+    BOOST_CHECK(!Antares::IO::exists(mountPoint / "input" / "hydro"));
+
+    std::string content;
+    BOOST_CHECK(Antares::IO::readFileContent(mountPoint / "study.antares", content));
+    BOOST_CHECK_EQUAL(content, "[antares]\nversion = 880\n");
+}
+
+BOOST_FIXTURE_TEST_CASE(files_missing_from_the_archive_are_read_from_disk, ArchiveFixture)
+{
+    Antares::IO::mountArchive(archive, mountPoint);
+    std::ofstream(mountPoint / "on-disk.txt") << "disk";
+
+    BOOST_CHECK(Antares::IO::exists(mountPoint / "on-disk.txt"));
+    BOOST_CHECK(!Antares::IO::isArchivedFile(mountPoint / "on-disk.txt"));
+
+    std::string content;
+    BOOST_CHECK(Antares::IO::readFileContent(mountPoint / "on-disk.txt", content));
+    BOOST_CHECK_EQUAL(content, "disk");
+}
+
+BOOST_FIXTURE_TEST_CASE(entries_can_be_read_concurrently, ArchiveFixture)
+{
+    Antares::IO::mountArchive(archive, mountPoint);
+
+    std::vector<int> failures(4, 0);
+    {
+        std::vector<std::jthread> threads;
+        for (int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back(
+              [&, t]
+              {
+                  for (int i = 0; i < 50; ++i)
+                  {
+                      std::string content;
+                      auto path = mountPoint / "input" / "other"
+                                  / ("file-" + std::to_string(i) + ".txt");
+                      if (!Antares::IO::readFileContent(path, content)
+                          || content != std::string(1000 + i, 'a' + i % 26))
+                      {
+                          ++failures[t];
+                      }
+                  }
+              });
+        }
+    }
+    BOOST_CHECK_EQUAL(std::count(failures.begin(), failures.end(), 0), 4);
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE test load profile
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "antares/io/load-profile.h"
+
+using namespace Antares::Statistics;
+using namespace std::chrono_literals;
+
+namespace
+{
+std::vector<std::string> linesOf(const std::string& text)
+{
+    std::vector<std::string> lines;
+    std::istringstream stream(text);
+    for (std::string line; std::getline(stream, line);)
+    {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+bool hasLineStartingWith(const std::string& report, const std::string& prefix)
+{
+    for (const auto& line: linesOf(report))
+    {
+        if (line.starts_with(prefix))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(files_are_grouped_by_folder_of_the_study)
+{
+    LoadProfileReset("/study");
+    LoadProfileAddFile("/study/input/thermal/prepro/fr/gas/modulation.txt", 10, 1ms, 1ms);
+    LoadProfileAddFile("/study/input/thermal/prepro/de/coal/modulation.txt", 10, 1ms, 1ms);
+    LoadProfileAddFile("/study/input/bindingconstraints/bc_lt.txt", 10, 1ms, 1ms);
+    LoadProfileAddFile("/study/study.antares", 10, 1ms, 1ms);
+
+    auto report = LoadProfileReport();
+    BOOST_CHECK(hasLineStartingWith(report, "input/thermal/prepro "));
+    BOOST_CHECK(hasLineStartingWith(report, "input/bindingconstraints "));
+    BOOST_CHECK(hasLineStartingWith(report, ". "));
+    BOOST_CHECK(!hasLineStartingWith(report, "input/thermal/prepro/fr"));
+}
+
+BOOST_AUTO_TEST_CASE(slowest_files_come_first)
+{
+    LoadProfileReset("/study");
+    LoadProfileAddFile("/study/input/fast.txt", 10, 1ms, 1ms);
+    LoadProfileAddFile("/study/input/slow.txt", 10, 10ms, 50ms);
+    LoadProfileAddFile("/study/input/medium.txt", 10, 5ms, 5ms);
+    { LoadPhase phase("areas"); }
+
+    auto lines = linesOf(LoadProfileReport(2));
+    auto header = std::find(lines.begin(), lines.end(), "Slowest files");
+    BOOST_REQUIRE(header != lines.end());
+    BOOST_REQUIRE_EQUAL(std::distance(header, lines.end()), 4); // title, columns, 2 files
+    BOOST_CHECK(header[2].ends_with("/study/input/slow.txt"));
+    BOOST_CHECK(header[3].ends_with("/study/input/medium.txt"));
+    BOOST_CHECK(hasLineStartingWith(LoadProfileReport(), "areas "));
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE test mersenne twister
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "antares/mersenne-twister/mersenne-twister.h"
+
+using namespace Antares;
+
+namespace
+{
+std::vector<double> drawOneByOne(MersenneTwister& random, std::size_t count)
+{
+    std::vector<double> values(count);
+    for (auto& value: values)
+    {
+        value = random.next();
+    }
+    return values;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(generate_gives_the_same_numbers_as_next)
+{
+    MersenneTwister reference;
+    reference.reset(1234);
+    MersenneTwister bulk;
+    bulk.reset(1234);
+
+    // Sizes chosen to start and end in the middle of a block of the state vector
+    for (std::size_t count: {1, 100, 623, 624, 625, 3000})
+    {
+        std::vector<double> values(count);
+        bulk.generate(values.data(), count);
+        BOOST_CHECK(values == drawOneByOne(reference, count));
+    }
+    BOOST_CHECK_EQUAL(bulk.next(), reference.next());
+}
+
+BOOST_AUTO_TEST_CASE(discard_skips_the_same_numbers_as_next)
+{
+    MersenneTwister reference;
+    reference.reset(42);
+    MersenneTwister skipping;
+    skipping.reset(42);
+
+    for (std::size_t count: {0, 7, 624, 2000})
+    {
+        drawOneByOne(reference, count);
+        skipping.discard(count);
+        BOOST_CHECK_EQUAL(skipping.next(), reference.next());
+    }
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE test random substreams
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "antares/mersenne-twister/substream.h"
+
+using namespace Antares;
+
+namespace
+{
+std::vector<double> draw(MersenneTwister& random, unsigned int count)
+{
+    std::vector<double> values(count);
+    for (auto& value: values)
+    {
+        value = random.next();
+    }
+    return values;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(reset_from_array_matches_the_reference_implementation)
+{
+    // First outputs of mt19937ar.c, initialized with init_by_array({0x123, 0x234, 0x345, 0x456})
+    const uint32_t key[] = {0x123, 0x234, 0x345, 0x456};
+    MersenneTwister random;
+    random.reset(key, 4);
+
+    BOOST_CHECK_EQUAL(std::lround(random.next() * 4294967295.0), 1067595299);
+    BOOST_CHECK_EQUAL(std::lround(random.next() * 4294967295.0), 955945823);
+    BOOST_CHECK_EQUAL(std::lround(random.next() * 4294967295.0), 477289528);
+}
+
+BOOST_AUTO_TEST_CASE(same_key_gives_same_stream)
+{
+    auto first = MakeSubstream(42, "area/cluster", 3);
+    auto second = MakeSubstream(42, "area/cluster", 3);
+    BOOST_CHECK(draw(first, 1000) == draw(second, 1000));
+}
+
+BOOST_AUTO_TEST_CASE(any_change_in_the_key_gives_another_stream)
+{
+    auto reference = MakeSubstream(42, "area/cluster", 3);
+    const auto expected = draw(reference, 16);
+
+    auto otherSeed = MakeSubstream(43, "area/cluster", 3);
+    auto otherName = MakeSubstream(42, "area/clustes", 3);
+    auto otherIndex = MakeSubstream(42, "area/cluster", 4);
+    // The length of the name is part of the key : trailing zero bytes still make a difference
+    auto paddedName = MakeSubstream(42, std::string_view("area/cluster\0", 13), 3);
+
+    BOOST_CHECK(draw(otherSeed, 16) != expected);
+    BOOST_CHECK(draw(otherName, 16) != expected);
+    BOOST_CHECK(draw(otherIndex, 16) != expected);
+    BOOST_CHECK(draw(paddedName, 16) != expected);
+}
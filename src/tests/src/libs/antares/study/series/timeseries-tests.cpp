@@ -22,11 +22,13 @@
 
 #define WIN32_LEAN_AND_MEAN
 
+#include <filesystem>
 #include <memory>
 #include <vector>
 
 #include <boost/test/unit_test.hpp>
 
+#include <antares/array/matrix-content-pool.h>
 #include <antares/series/series.h>
 #include <antares/solver/simulation/timeseries-numbers.h>
 
@@ -255,4 +257,105 @@ BOOST_FIXTURE_TEST_CASE(checkSizeKO_4TS, FixtureMultipleTS)
     BOOST_CHECK(tsnum.checkSeriesNumberOfColumnsConsistency());
 }
 
+// SHARED CONTENT
+BOOST_AUTO_TEST_CASE(identicalSeriesShareTheirColumns)
+{
+    TimeSeriesNumbers tsnum;
+    TimeSeries a(tsnum), b(tsnum), c(tsnum);
+    a.reset(2, HOURS_PER_YEAR);
+    b.reset(2, HOURS_PER_YEAR);
+    c.reset(2, HOURS_PER_YEAR);
+    c.fill(1.);
+
+    Antares::MatrixContentPool pool;
+    BOOST_CHECK(!pool.deduplicate(a.timeSeries));
+    BOOST_CHECK(pool.deduplicate(b.timeSeries));
+    BOOST_CHECK(!pool.deduplicate(c.timeSeries));
+
+    BOOST_CHECK_EQUAL(pool.report().matrices, 3);
+    BOOST_CHECK_EQUAL(pool.report().shared, 1);
+    BOOST_CHECK_EQUAL(pool.report().bytesSaved, 2 * HOURS_PER_YEAR * sizeof(double));
+    BOOST_CHECK(a.timeSeries.entry[0] == b.timeSeries.entry[0]);
+    BOOST_CHECK(a.timeSeries.entry[0] != c.timeSeries.entry[0]);
+}
+
+BOOST_AUTO_TEST_CASE(sharedSeriesAreCopiedOnWrite)
+{
+    TimeSeriesNumbers tsnum;
+    TimeSeries a(tsnum), b(tsnum);
+    a.reset(2, HOURS_PER_YEAR);
+    b.reset(2, HOURS_PER_YEAR);
+
+    Antares::MatrixContentPool pool;
+    pool.deduplicate(a.timeSeries);
+    pool.deduplicate(b.timeSeries);
+    BOOST_CHECK(b.timeSeries.hasSharedColumns());
+
+    b[1][12] = 42.;
+    BOOST_CHECK(!b.timeSeries.hasSharedColumns());
+    BOOST_CHECK_EQUAL(b.timeSeries[1][12], 42.);
+    BOOST_CHECK_EQUAL(a.timeSeries[1][12], 0.);
+
+    a.averageTimeseries();
+    BOOST_CHECK_EQUAL(a.numberOfColumns(), 1);
+    BOOST_CHECK_EQUAL(b.numberOfColumns(), 2);
+}
+
+// ON DEMAND LOADING
+BOOST_FIXTURE_TEST_CASE(getColumnLoadedOnDemand, Fixture)
+{
+    ts.resize(4, HOURS_PER_YEAR);
+    fillTsnum();
+    fillColumn(2);
+    fillColumnReverse(3);
+
+    auto cache = std::make_shared<ColumnCache>(std::filesystem::temp_directory_path()
+                                                 / "antares-timeseries-tests.bin",
+                                               1024 * 1024);
+    ts.loadOnDemand(cache);
+
+    BOOST_CHECK(ts.isLoadedOnDemand());
+    BOOST_CHECK_EQUAL(ts.timeSeries.width, 0);
+    BOOST_CHECK_EQUAL(ts.numberOfColumns(), 4);
+    BOOST_CHECK_EQUAL(ts.numberOfTimesteps(), HOURS_PER_YEAR);
+    BOOST_CHECK_EQUAL(ts.getColumn(2)[38], 38);
+    BOOST_CHECK_EQUAL(ts.getCoefficient(3, 20), HOURS_PER_YEAR - 20);
+    BOOST_CHECK_EQUAL(ts.getCoefficient(2, 4567), 4567);
+
+    const auto stats = cache->statistics();
+    BOOST_CHECK_EQUAL(stats.misses, 2);
+    BOOST_CHECK_EQUAL(stats.hits, 1);
+
+    ts.reset(1, HOURS_PER_YEAR);
+    BOOST_CHECK(!ts.isLoadedOnDemand());
+}
+
+BOOST_AUTO_TEST_CASE(columnCacheEvictsUnpinnedColumnsOnly)
+{
+    Matrix<double> m(3, 10);
+    for (uint x = 0; x != m.width; ++x)
+    {
+        m.fillColumn(x, x + 1.);
+    }
+
+    // Budget of a single column
+    ColumnCache cache(std::filesystem::temp_directory_path() / "antares-column-cache-tests.bin",
+                      sizeof(double) * m.height);
+    const auto block = cache.store(m);
+
+    const double* first = cache.get(block, 0);
+    const double* second = cache.get(block, 1);
+    // Both columns are pinned, nothing can be evicted
+    BOOST_CHECK_EQUAL(cache.statistics().evictions, 0);
+    BOOST_CHECK_EQUAL(first[5], 1.);
+    BOOST_CHECK_EQUAL(second[5], 2.);
+
+    cache.unpinAll();
+    BOOST_CHECK_EQUAL(cache.statistics().evictions, 1);
+
+    BOOST_CHECK_EQUAL(cache.get(block, 2)[9], 3.);
+    BOOST_CHECK_EQUAL(cache.statistics().evictions, 2);
+    BOOST_CHECK_EQUAL(cache.statistics().peakBytes, 2 * sizeof(double) * m.height);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -21,6 +21,8 @@
 
 #define BOOST_TEST_MODULE study
 #define WIN32_LEAN_AND_MEAN
+#include <thread>
+
 #include <boost/test/unit_test.hpp>
 
 #include "antares/study/study.h"
@@ -356,4 +358,25 @@ BOOST_FIXTURE_TEST_CASE(cpu_count, OneAreaStudy)
     BOOST_CHECK_EQUAL(study->getNumberOfCoresPerMode(10, 120), 0);
 }
 
+BOOST_FIXTURE_TEST_CASE(cores_left_to_the_parallel_years, OneAreaStudy)
+{
+    study->parameters.nbCores.ncMode = ncMax;
+    const unsigned nbCores = study->getNumberOfConfiguredCores();
+    BOOST_CHECK_EQUAL(nbCores, std::thread::hardware_concurrency());
+
+    study->maxNbYearsInParallel = 1;
+    BOOST_CHECK_EQUAL(study->getNumberOfCoresPerParallelYear(), nbCores);
+
+    study->maxNbYearsInParallel = nbCores;
+    BOOST_CHECK_EQUAL(study->getNumberOfCoresPerParallelYear(), 1);
+
+    // More years than cores
+    study->maxNbYearsInParallel = 2 * nbCores;
+    BOOST_CHECK_EQUAL(study->getNumberOfCoresPerParallelYear(), 1);
+
+    study->parameters.nbCores.ncMode = ncMin;
+    study->maxNbYearsInParallel = 1;
+    BOOST_CHECK_EQUAL(study->getNumberOfCoresPerParallelYear(), 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // version
@@ -160,6 +160,83 @@ BOOST_FIXTURE_TEST_CASE(read_several_lib_file, FixtureLoadFile)
     BOOST_CHECK(!checkLibIdInVector("id not in vector"));
 }
 
+BOOST_FIXTURE_TEST_CASE(read_library_from_cache, FixtureLoadFile)
+{
+    std::ofstream libStream(libraryDirPath / "simple.yml");
+    libStream << R"(
+        library:
+            id: lib_id
+            description: lib_description
+            port-types:
+                - id: flow
+                  description: A port which transfers power flow
+                  fields:
+                    - id: flow
+            models:
+                - id: generator
+                  parameters:
+                    - id: p_max
+                      time-dependent: false
+                      scenario-dependent: false
+                    - id: cost
+                      time-dependent: true
+                      scenario-dependent: false
+                  variables:
+                    - id: generation
+                      lower-bound: 0
+                      upper-bound: 2 * p_max
+                  constraints:
+                    - id: max
+                      expression: generation <= p_max + p_max
+                  objective: cost * generation
+                - id: other_generator
+                  parameters:
+                    - id: p_max
+                      time-dependent: false
+                      scenario-dependent: false
+                  variables:
+                    - id: generation
+                      lower-bound: 0
+                      upper-bound: 2 * p_max
+    )";
+    libStream.close();
+
+    auto checkLibrary = [](const Antares::Study::SystemModel::Library& library)
+    {
+        BOOST_CHECK_EQUAL(library.Id(), "lib_id");
+        BOOST_CHECK_EQUAL(library.PortTypes().at("flow").Fields().size(), 1);
+        const auto& model = library.Models().at("generator");
+        BOOST_CHECK(!model.Parameters().at("p_max").isTimeDependent());
+        BOOST_CHECK(model.Parameters().at("cost").isTimeDependent());
+        const auto& variable = model.Variables().at("generation");
+        BOOST_CHECK_EQUAL(variable.UpperBound().Value(), "2 * p_max");
+        BOOST_CHECK(variable.UpperBound().RootNode());
+        const auto& constraint = model.getConstraints().at("max").expression();
+        BOOST_CHECK_EQUAL(constraint.RootNode()->name(), "LessThanOrEqualNode");
+        BOOST_CHECK(constraint.timeIndex()
+                    == Antares::Expressions::Visitors::TimeIndex::VARYING_IN_TIME_AND_SCENARIO);
+        BOOST_CHECK(model.Objective().linearStatus()
+                    == Antares::Expressions::Visitors::LinearStatus::LINEAR);
+        // The expressions of a library share their identical nodes
+        const auto& other = library.Models().at("other_generator").Variables().at("generation");
+        BOOST_CHECK_EQUAL(other.UpperBound().RootNode(), variable.UpperBound().RootNode());
+    };
+
+    auto libraries = Antares::Solver::LoadFiles::loadLibraries(studyPath, true);
+    const auto cacheFile = studyPath / "cache" / "model-libraries" / "simple.yml.bin";
+    BOOST_REQUIRE(fs::exists(cacheFile));
+    checkLibrary(libraries[0]);
+
+    libraries = Antares::Solver::LoadFiles::loadLibraries(studyPath, true);
+    checkLibrary(libraries[0]);
+
+    // A corrupted cache is replaced
+    std::ofstream(cacheFile, std::ios::binary) << "ANTSMLIB";
+    libraries = Antares::Solver::LoadFiles::loadLibraries(studyPath, true);
+    checkLibrary(libraries[0]);
+    BOOST_CHECK_GT(fs::file_size(cacheFile), 8);
+}
+
 BOOST_FIXTURE_TEST_CASE(read_system_file, FixtureLoadFile)
 {
     std::ofstream libStream(libraryDirPath / "simple.yml");
@@ -37,6 +37,12 @@ BOOST_AUTO_TEST_CASE(read_parameters)
         solver-logs: false
         solver-parameters: PRESOLVE 1
         no-output: true
+        nb-threads: 4
+        window-length: 24
+        window-overlap: 6
+        nb-scenarios: 10
+        nb-parallel-scenarios: 3
+        library-cache: true
     )";
     paramStream.close();
 
@@ -45,6 +51,12 @@ BOOST_AUTO_TEST_CASE(read_parameters)
     BOOST_CHECK_EQUAL(params.solverLogs, false);
     BOOST_CHECK_EQUAL(params.solverParameters, "PRESOLVE 1");
     BOOST_CHECK_EQUAL(params.noOutput, true);
+    BOOST_CHECK_EQUAL(params.nbThreads, 4);
+    BOOST_CHECK_EQUAL(params.windowLength, 24);
+    BOOST_CHECK_EQUAL(params.windowOverlap, 6);
+    BOOST_CHECK_EQUAL(params.nbScenarios, 10);
+    BOOST_CHECK_EQUAL(params.nbParallelScenarios, 3);
+    BOOST_CHECK_EQUAL(params.libraryCache, true);
 }
 
 BOOST_AUTO_TEST_CASE(read_parameters_out_of_order)
@@ -64,6 +76,10 @@ BOOST_AUTO_TEST_CASE(read_parameters_out_of_order)
     BOOST_CHECK_EQUAL(params.solverLogs, false);
     BOOST_CHECK_EQUAL(params.solverParameters, "PRESOLVE 1");
     BOOST_CHECK_EQUAL(params.noOutput, true);
+    BOOST_CHECK_EQUAL(params.nbThreads, 1);
+    BOOST_CHECK_EQUAL(params.windowLength, 0);
+    BOOST_CHECK_EQUAL(params.nbScenarios, 1);
+    BOOST_CHECK_EQUAL(params.libraryCache, false);
 }
 
 BOOST_AUTO_TEST_CASE(parameters_missing)
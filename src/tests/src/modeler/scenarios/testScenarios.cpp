@@ -0,0 +1,158 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE modeler scenarios
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <functional>
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/expressions/nodes/ExpressionsNodes.h>
+#include <antares/optimisation/linear-problem-data-impl/linearProblemData.h>
+#include <antares/optimisation/linear-problem-data-impl/timeSeriesSet.h>
+#include <antares/solver/modeler/scenarios/scenarios.h>
+#include <antares/study/system-model/model.h>
+#include <antares/study/system-model/system.h>
+
+using namespace Antares::Expressions;
+using namespace Antares::Expressions::Nodes;
+using namespace Antares::Optimisation::LinearProblemApi;
+using namespace Antares::Optimisation::LinearProblemDataImpl;
+using namespace Antares::Solver;
+using namespace Antares::Study::SystemModel;
+
+namespace
+{
+constexpr auto varying = Visitors::TimeIndex::VARYING_IN_TIME_AND_SCENARIO;
+
+Expression expression(const std::function<Node*(Registry<Node>&)>& create)
+{
+    Registry<Node> nodes;
+    Node* root = create(nodes);
+    return Expression("expression", NodeRegistry(root, std::move(nodes)));
+}
+
+// A generation at least equal to the demand, whose cost is the generation
+Model generatorModel()
+{
+    auto demand = [](Registry<Node>& nodes)
+    { return nodes.create<ParameterNode>("demand", varying); };
+    auto maximum = [](Registry<Node>& nodes) { return nodes.create<LiteralNode>(1000); };
+    auto generation = [](Registry<Node>& nodes)
+    { return nodes.create<VariableNode>("generation", varying); };
+
+    std::vector<Variable> variables;
+    variables.emplace_back("generation",
+                           expression(demand),
+                           expression(maximum),
+                           ValueType::FLOAT,
+                           TimeDependent::YES,
+                           ScenarioDependent::YES);
+    ModelBuilder builder;
+    return builder.withId("generator")
+      .withParameters({Parameter("demand", TimeDependent::YES, ScenarioDependent::YES)})
+      .withVariables(std::move(variables))
+      .withObjective(expression(generation))
+      .build();
+}
+
+// A single generator, whose demand is read from the data series "load"
+System generatorSystem(const Model& model)
+{
+    ComponentBuilder componentBuilder;
+    std::vector<Component> components = {componentBuilder.withId("generator")
+                                           .withModel(&model)
+                                           .withParameterDataSeries({{"demand", "load"}})
+                                           .withScenarioGroupId("group")
+                                           .build()};
+    SystemBuilder systemBuilder;
+    return systemBuilder.withId("system").withComponents(components).build();
+}
+
+struct ScenariosFixture
+{
+    ScenariosFixture()
+    {
+        // Scenario s reads the series of rank s
+        auto load = std::make_unique<TimeSeriesSet>("load", 3);
+        load->add({1, 2, 3});
+        load->add({10, 20, 30});
+        load->add({100, 200, 300});
+        data.addDataSeries(std::move(load));
+        for (unsigned scenario = 0; scenario < 3; ++scenario)
+        {
+            data.addScenarioGroup("group", {scenario, scenario});
+        }
+
+        parameters.solver = "sirius";
+        parameters.firstTimeStep = 0;
+        parameters.lastTimeStep = 2;
+        parameters.nbScenarios = 3;
+    }
+
+    Model model = generatorModel();
+    System system = generatorSystem(model);
+    LinearProblemData data;
+    ModelerParameters parameters;
+};
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(modeler_scenarios, ScenariosFixture)
+
+BOOST_AUTO_TEST_CASE(scenarios_with_different_data___different_objectives)
+{
+    const auto results = solveScenarios(system, parameters, data);
+
+    BOOST_REQUIRE_EQUAL(results.size(), 3);
+    const double expected[] = {1 + 2 + 3, 10 + 20 + 30, 100 + 200 + 300};
+    for (unsigned scenario = 0; scenario < 3; ++scenario)
+    {
+        BOOST_CHECK(results[scenario].status == MipStatus::OPTIMAL);
+        BOOST_CHECK_CLOSE(results[scenario].objectiveValue, expected[scenario], 1e-9);
+        BOOST_CHECK_CLOSE(results[scenario].values.at("generator.generation_1"),
+                          expected[scenario] / 3,
+                          1e-9);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(scenarios_solved_in_parallel___same_results)
+{
+    const auto sequential = solveScenarios(system, parameters, data);
+    parameters.nbParallelScenarios = 3;
+    const auto parallel = solveScenarios(system, parameters, data);
+
+    BOOST_REQUIRE_EQUAL(parallel.size(), sequential.size());
+    for (unsigned scenario = 0; scenario < sequential.size(); ++scenario)
+    {
+        BOOST_CHECK(parallel[scenario].status == sequential[scenario].status);
+        BOOST_CHECK_EQUAL(parallel[scenario].objectiveValue, sequential[scenario].objectiveValue);
+        BOOST_CHECK(parallel[scenario].values == sequential[scenario].values);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(scenario_out_of_the_scenario_group___exception_raised)
+{
+    parameters.nbScenarios = 4;
+    BOOST_CHECK_THROW(solveScenarios(system, parameters, data), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -38,3 +38,35 @@ BOOST_AUTO_TEST_CASE(ask_to_a_simple_linearProblemData_data_it_contains___answer
     const unsigned hour = 3;
     BOOST_CHECK_EQUAL(linearProblemData.getData(dataSetName, groupName, year, hour), 40.);
 }
+
+BOOST_AUTO_TEST_CASE(handle_on_a_data_set___series_of_the_scenario_over_time)
+{
+    LinearProblemData linearProblemData;
+    linearProblemData.addScenarioGroup("group 1", {2, 1});
+    auto timeSeriesSet = std::make_unique<TimeSeriesSet>("my-TS-set", 3);
+    timeSeriesSet->add({1., 2., 3.});
+    timeSeriesSet->add({10., 20., 30.});
+    linearProblemData.addDataSeries(std::move(timeSeriesSet));
+
+    auto handle = linearProblemData.getHandle("my-TS-set", "group 1");
+
+    auto series = handle.series(2);
+    std::vector<double> expected = {10., 20., 30.};
+    BOOST_CHECK_EQUAL_COLLECTIONS(series.begin(), series.end(), expected.begin(), expected.end());
+    BOOST_CHECK_EQUAL(handle.get(2, 1), linearProblemData.getData("my-TS-set", "group 1", 2, 1));
+    BOOST_CHECK_THROW(handle.series(0), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(handle_on_a_rank_out_of_the_data_set___exception_raised)
+{
+    LinearProblemData linearProblemData;
+    linearProblemData.addScenarioGroup("group 1", {0, 1});
+    auto timeSeriesSet = std::make_unique<TimeSeriesSet>("my-TS-set", 3);
+    timeSeriesSet->add({1., 2., 3.});
+    linearProblemData.addDataSeries(std::move(timeSeriesSet));
+
+    std::string expected_err_msg = "TS set 'my-TS-set' : rank 1 exceeds TS set's width";
+    BOOST_CHECK_EXCEPTION(linearProblemData.getHandle("my-TS-set", "group 1"),
+                          TimeSeriesSet::RankTooBig,
+                          checkMessage(expected_err_msg));
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define WIN32_LEAN_AND_MEAN
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <files-system.h>
+#include <unit_test_utils.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/optimisation/linear-problem-data-impl/mappedTimeSeriesSet.h>
+#include <antares/optimisation/linear-problem-data-impl/timeSeriesSet.h>
+
+using namespace Antares::Optimisation::LinearProblemDataImpl;
+
+namespace
+{
+// Binary matrix of doubles, as written by Matrix::saveToBinaryBuffer
+void writeBinaryMatrix(const std::filesystem::path& path,
+                       uint32_t width,
+                       uint32_t height,
+                       const std::vector<double>& values)
+{
+    std::ofstream file(path, std::ios::binary);
+    const uint32_t header[4] = {width, height, 6, sizeof(double)};
+    file.write("ANTSMTX1", 8);
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double));
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(mapped_TS_set___values_read_in_the_file)
+{
+    auto dir = CREATE_TMP_DIR_BASED_ON_TEST_NAME();
+    auto path = dir / "series.bin";
+    writeBinaryMatrix(path, 2, 3, {1., 2., 3., 10., 20., 30.});
+
+    MappedTimeSeriesSet timeSeriesSet("my-TS-set", path);
+
+    BOOST_CHECK_EQUAL(timeSeriesSet.height(), 3);
+    BOOST_CHECK_EQUAL(timeSeriesSet.values().size(), 6);
+    BOOST_CHECK_EQUAL(timeSeriesSet.getData(0, 2), 3.);
+    BOOST_CHECK_EQUAL(timeSeriesSet.getData(1, 0), 10.);
+}
+
+BOOST_AUTO_TEST_CASE(ask_a_mapped_TS_set_for_an_out_of_range_TS_rank___exception_raised)
+{
+    auto dir = CREATE_TMP_DIR_BASED_ON_TEST_NAME();
+    auto path = dir / "series.bin";
+    writeBinaryMatrix(path, 1, 3, {1., 2., 3.});
+
+    MappedTimeSeriesSet timeSeriesSet("my-TS-set", path);
+
+    std::string expected_err_msg = "TS set 'my-TS-set' : rank 1 exceeds TS set's width";
+    BOOST_CHECK_EXCEPTION(timeSeriesSet.getData(1, 0),
+                          TimeSeriesSet::RankTooBig,
+                          checkMessage(expected_err_msg));
+}
+
+BOOST_AUTO_TEST_CASE(mapping_a_truncated_file___exception_raised)
+{
+    auto dir = CREATE_TMP_DIR_BASED_ON_TEST_NAME();
+    auto path = dir / "series.bin";
+    writeBinaryMatrix(path, 2, 3, {1., 2., 3.});
+
+    BOOST_CHECK_THROW(MappedTimeSeriesSet("my-TS-set", path), MappedTimeSeriesSet::InvalidFile);
+}
+
+BOOST_AUTO_TEST_CASE(mapping_a_file_whose_dimensions_overflow___exception_raised)
+{
+    auto dir = CREATE_TMP_DIR_BASED_ON_TEST_NAME();
+    auto path = dir / "series.bin";
+    // The size of 2^31 x 2^31 doubles wraps around to 0, the size of the values written
+    writeBinaryMatrix(path, 1u << 31, 1u << 31, {});
+
+    BOOST_CHECK_THROW(MappedTimeSeriesSet("my-TS-set", path), MappedTimeSeriesSet::InvalidFile);
+}
+
+BOOST_AUTO_TEST_CASE(mapping_a_text_file___exception_raised)
+{
+    auto dir = CREATE_TMP_DIR_BASED_ON_TEST_NAME();
+    auto path = dir / "series.txt";
+    std::ofstream(path) << "1\t2\t3\n";
+
+    BOOST_CHECK_THROW(MappedTimeSeriesSet("my-TS-set", path), MappedTimeSeriesSet::InvalidFile);
+}
+
+BOOST_AUTO_TEST_CASE(mapping_a_missing_file___exception_raised)
+{
+    auto dir = CREATE_TMP_DIR_BASED_ON_TEST_NAME();
+    auto path = dir / "series.bin";
+
+    BOOST_CHECK_THROW(MappedTimeSeriesSet("my-TS-set", path), std::runtime_error);
+}
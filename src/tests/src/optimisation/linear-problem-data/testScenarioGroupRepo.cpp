@@ -18,14 +18,25 @@ BOOST_AUTO_TEST_CASE(ask_repo_a_question_it_can_answer___repo_answers_correctly)
     BOOST_CHECK_EQUAL(scenarioGroupRepo.getDataRank("some group", scenario), dataRank);
 }
 
-BOOST_AUTO_TEST_CASE(add_to_repo_a_group_it_already_contains___exception_raised)
+BOOST_AUTO_TEST_CASE(add_several_scenarios_to_a_group___each_scenario_has_its_rank)
+{
+    ScenarioGroupRepository scenarioGroupRepo;
+    scenarioGroupRepo.addPairScenarioRankToGroup("some group", {0, 2});
+    scenarioGroupRepo.addPairScenarioRankToGroup("some group", {1, 0});
+
+    BOOST_CHECK_EQUAL(scenarioGroupRepo.getDataRank("some group", 0), 2);
+    BOOST_CHECK_EQUAL(scenarioGroupRepo.getDataRank("some group", 1), 0);
+    BOOST_CHECK_EQUAL(scenarioGroupRepo.getGroup("some group").size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(add_to_a_group_a_scenario_it_already_contains___exception_raised)
 {
     ScenarioGroupRepository scenarioGroupRepo;
     scenarioGroupRepo.addPairScenarioRankToGroup("some group", {0, 0});
 
-    std::string expectedErrMsg = "Scenario group 'some group' already exists in group repo.";
-    BOOST_CHECK_EXCEPTION(scenarioGroupRepo.addPairScenarioRankToGroup("some group", {1, 1}),
-                          ScenarioGroupRepository::AlreadyExists,
+    std::string expectedErrMsg = "In scenario group 'some group', scenario '0' already exists.";
+    BOOST_CHECK_EXCEPTION(scenarioGroupRepo.addPairScenarioRankToGroup("some group", {0, 1}),
+                          ScenarioGroupRepository::ScenarioAlreadyExists,
                           checkMessage(expectedErrMsg));
 }
 
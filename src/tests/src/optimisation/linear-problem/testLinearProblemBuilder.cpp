@@ -35,6 +35,55 @@ using namespace Antares::Optimisation::LinearProblemApi;
 using namespace Antares::Optimisation::LinearProblemDataImpl;
 using namespace Antares::Optimisation::LinearProblemMpsolverImpl;
 
+namespace
+{
+// Uses variables of its own and of OneVarFiller
+class LinkFiller: public LinearProblemFiller
+{
+public:
+    void addVariables(ILinearProblem& pb, ILinearProblemData&, FillContext&) override
+    {
+        own = pb.addNumVariable(0, 5, "x-by-LinkFiller", 3);
+    }
+
+    void addConstraints(ILinearProblem& pb, ILinearProblemData&, FillContext&) override
+    {
+        problem = &pb;
+        link = pb.addConstraint(0, 1, "link-by-LinkFiller");
+        pb.setCoefficients({link}, {pb.getVariable("var-by-OneVarFiller")}, {2.});
+        link->setCoefficient(own[1], 3.);
+        own[2]->setUb(4);
+    }
+
+    void addObjective(ILinearProblem& pb, ILinearProblemData&, FillContext&) override
+    {
+        pb.setObjectiveCoefficients(own, {1., 2., 3.});
+    }
+
+    std::vector<IMipVariable*> own;
+    IMipConstraint* link = nullptr;
+    // Problem given to the filler, a buffer when built in parallel
+    ILinearProblem* problem = nullptr;
+};
+
+class FailingFiller: public LinearProblemFiller
+{
+public:
+    void addVariables(ILinearProblem&, ILinearProblemData&, FillContext&) override
+    {
+    }
+
+    void addConstraints(ILinearProblem&, ILinearProblemData&, FillContext&) override
+    {
+        throw std::runtime_error("failing filler");
+    }
+
+    void addObjective(ILinearProblem&, ILinearProblemData&, FillContext&) override
+    {
+    }
+};
+} // namespace
+
 struct Fixture
 {
     Fixture()
@@ -138,4 +187,69 @@ BOOST_FIXTURE_TEST_CASE(FillerWithContext, Fixture)
     BOOST_CHECK_EQUAL(var2->getLb(), varFiller->timeseries[3][2]);
 }
 
+BOOST_FIXTURE_TEST_CASE(fillers_built_in_parallel___same_problem_as_serial_build, Fixture)
+{
+    auto oneVarFiller = std::make_unique<OneVarFiller>();
+    auto linkFiller = std::make_unique<LinkFiller>();
+    auto oneConstrFiller = std::make_unique<OneConstraintFiller>();
+    auto twoVarsTwoConstrFiller = std::make_unique<TwoVarsTwoConstraintsFiller>();
+    fillers = {linkFiller.get(),
+               oneVarFiller.get(),
+               oneConstrFiller.get(),
+               twoVarsTwoConstrFiller.get()};
+
+    LinearProblemBuilder lpBuilder(fillers, 4);
+    lpBuilder.build(*pb, LP_Data, ctx);
+
+    BOOST_CHECK_EQUAL(pb->variableCount(), 6);
+    BOOST_CHECK_EQUAL(pb->constraintCount(), 4);
+
+    auto* link = pb->getConstraint("link-by-LinkFiller");
+    auto* x1 = pb->getVariable("x-by-LinkFiller_1");
+    auto* x2 = pb->getVariable("x-by-LinkFiller_2");
+    BOOST_CHECK_EQUAL(link->getCoefficient(pb->getVariable("var-by-OneVarFiller")), 2.);
+    BOOST_CHECK_EQUAL(link->getCoefficient(x1), 3.);
+    BOOST_CHECK_EQUAL(x2->getUb(), 4.);
+    BOOST_CHECK_EQUAL(pb->getObjectiveCoefficient(x2), 3.);
+    BOOST_CHECK_EQUAL(pb->getObjectiveCoefficient(pb->getVariable("var-by-OneVarFiller")), 1.);
+
+    // The variables of the fillers refer to the ones of the problem
+    BOOST_CHECK_EQUAL(linkFiller->own[1]->getName(), x1->getName());
+    BOOST_CHECK_EQUAL(linkFiller->own[2]->getUb(), 4.);
+}
+
+BOOST_FIXTURE_TEST_CASE(fillers_built_in_parallel___later_changes_of_filler_reach_problem, Fixture)
+{
+    auto oneVarFiller = std::make_unique<OneVarFiller>();
+    auto linkFiller = std::make_unique<LinkFiller>();
+    fillers = {linkFiller.get(), oneVarFiller.get()};
+
+    LinearProblemBuilder lpBuilder(fillers, 2);
+    lpBuilder.build(*pb, LP_Data, ctx);
+
+    auto* link = pb->getConstraint("link-by-LinkFiller");
+    linkFiller->link->setCoefficient(linkFiller->own[0], 5.);
+    BOOST_CHECK_EQUAL(link->getCoefficient(pb->getVariable("x-by-LinkFiller_0")), 5.);
+
+    linkFiller->problem->setCoefficients({linkFiller->link}, {linkFiller->own[2]}, {6.});
+    BOOST_CHECK_EQUAL(link->getCoefficient(pb->getVariable("x-by-LinkFiller_2")), 6.);
+
+    linkFiller->problem->setObjectiveCoefficient(linkFiller->own[1], 7.);
+    BOOST_CHECK_EQUAL(pb->getObjectiveCoefficient(pb->getVariable("x-by-LinkFiller_1")), 7.);
+
+    linkFiller->link->setUb(8.);
+    BOOST_CHECK_EQUAL(link->getUb(), 8.);
+    BOOST_CHECK_EQUAL(link->getCoefficient(pb->getVariable("x-by-LinkFiller_1")), 3.);
+}
+
+BOOST_FIXTURE_TEST_CASE(filler_failing_in_parallel_build___error_is_raised, Fixture)
+{
+    auto oneVarFiller = std::make_unique<OneVarFiller>();
+    auto failingFiller = std::make_unique<FailingFiller>();
+    fillers = {oneVarFiller.get(), failingFiller.get()};
+
+    LinearProblemBuilder lpBuilder(fillers, 2);
+    BOOST_CHECK_THROW(lpBuilder.build(*pb, LP_Data, ctx), std::runtime_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -192,6 +192,44 @@ BOOST_FIXTURE_TEST_CASE(get_coef_of_null_var_in_constaint_leads_to_bad_cast, Fix
     BOOST_CHECK_THROW(constraint->getCoefficient(nullptr), std::bad_cast);
 }
 
+BOOST_FIXTURE_TEST_CASE(give_coeffs_to_block_of_constraints___one_var_per_constraint,
+                        FixtureEmptyProblem)
+{
+    auto vars = pb->addNumVariable(0, 1, "var", 3);
+    auto constraints = pb->addConstraint(0, 1, "constraint", 3);
+    pb->setCoefficients(constraints, vars, {1., 2., 3.});
+
+    for (unsigned i = 0; i < 3; i++)
+    {
+        for (unsigned j = 0; j < 3; j++)
+        {
+            BOOST_CHECK_EQUAL(constraints[i]->getCoefficient(vars[j]), i == j ? i + 1. : 0.);
+        }
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(give_coeff_to_block_of_constraints___single_var_shared, FixtureEmptyProblem)
+{
+    auto* var = pb->addNumVariable(0, 1, "var");
+    auto constraints = pb->addConstraint(0, 1, "constraint", 3);
+    pb->setCoefficients(constraints, {var}, {4.});
+
+    for (auto* constraint: constraints)
+    {
+        BOOST_CHECK_EQUAL(constraint->getCoefficient(var), 4.);
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(give_coeffs_to_block_with_wrong_size_leads_to_exception,
+                        FixtureEmptyProblem)
+{
+    auto vars = pb->addNumVariable(0, 1, "var", 2);
+    auto constraints = pb->addConstraint(0, 1, "constraint", 3);
+    BOOST_CHECK_THROW(pb->setCoefficients(constraints, vars, {1.}), std::invalid_argument);
+    BOOST_CHECK_THROW(pb->setCoefficients(constraints, {vars[0]}, {1., 2.}),
+                      std::invalid_argument);
+}
+
 bool expectedMessage(const std::exception& ex)
 {
     BOOST_CHECK_EQUAL(ex.what(), std::string("Element name already exists in linear problem"));
@@ -310,6 +348,19 @@ BOOST_FIXTURE_TEST_CASE(give_cost_to_null_variable_leads_to_bad_cast, FixtureEmp
     BOOST_CHECK_THROW(pb->setObjectiveCoefficient(nullptr, 0), std::bad_cast);
 }
 
+BOOST_FIXTURE_TEST_CASE(give_costs_to_range_of_variables___check_costs_exist, FixtureEmptyProblem)
+{
+    auto vars = pb->addNumVariable(0, 1, "var", 3);
+    pb->setObjectiveCoefficients(vars, {5.});
+    for (auto* var: vars)
+    {
+        BOOST_CHECK_EQUAL(pb->getObjectiveCoefficient(var), 5.);
+    }
+
+    pb->setObjectiveCoefficients(vars, {1., 2., 3.});
+    BOOST_CHECK_EQUAL(pb->getObjectiveCoefficient(vars[2]), 3.);
+}
+
 BOOST_FIXTURE_TEST_CASE(solve_infeasible_problem_leads_to_error_status, FixtureInfeasibleProblem)
 {
     auto* solution = pb->solve(true);
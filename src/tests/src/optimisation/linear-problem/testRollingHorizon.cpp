@@ -0,0 +1,176 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define WIN32_LEAN_AND_MEAN
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/optimisation/linear-problem-api/rollingHorizon.h>
+#include <antares/optimisation/linear-problem-data-impl/linearProblemData.h>
+#include <antares/optimisation/linear-problem-mpsolver-impl/linearProblem.h>
+
+using namespace Antares::Optimisation::LinearProblemApi;
+using namespace Antares::Optimisation::LinearProblemDataImpl;
+using namespace Antares::Optimisation::LinearProblemMpsolverImpl;
+
+namespace
+{
+// x[t] <= t, stock equal to the previous window's x at the beginning of the window.
+// Objective : maximize stock + sum of x[t]
+class WindowFiller: public LinearProblemFiller
+{
+public:
+    void addVariables(ILinearProblem& pb, ILinearProblemData&, FillContext& ctx) override
+    {
+        ++builds;
+        x = pb.addNumVariable(0, 0, "x", ctx.getNumberOfTimestep());
+        stock = pb.addNumVariable(0, 0, "stock");
+        setBounds(ctx);
+    }
+
+    void addConstraints(ILinearProblem&, ILinearProblemData&, FillContext&) override
+    {
+    }
+
+    void addObjective(ILinearProblem& pb, ILinearProblemData&, FillContext&) override
+    {
+        pb.setObjectiveCoefficients(x, {-1.});
+        pb.setObjectiveCoefficient(stock, -1.);
+    }
+
+    void update(ILinearProblem&, ILinearProblemData&, FillContext& ctx) override
+    {
+        ++updates;
+        setBounds(ctx);
+    }
+
+    void carryOver(ILinearProblem&, const IMipSolution& solution, unsigned offset) override
+    {
+        offsets.push_back(offset);
+        const double level = solution.getOptimalValue(x[offset]);
+        stock->setBounds(level, level);
+    }
+
+    unsigned builds = 0;
+    unsigned updates = 0;
+    std::vector<unsigned> offsets;
+
+private:
+    void setBounds(const FillContext& ctx)
+    {
+        for (unsigned i = 0; i < x.size(); ++i)
+        {
+            x[i]->setUb(ctx.getFirstTimeStep() + i);
+        }
+    }
+
+    std::vector<IMipVariable*> x;
+    IMipVariable* stock = nullptr;
+};
+
+std::vector<std::pair<unsigned, unsigned>> bounds(const std::vector<FillContext>& windows)
+{
+    std::vector<std::pair<unsigned, unsigned>> result;
+    for (const auto& window: windows)
+    {
+        result.emplace_back(window.getFirstTimeStep(), window.getLastTimeStep());
+    }
+    return result;
+}
+} // namespace
+
+struct RollingHorizonFixture
+{
+    RollingHorizonFixture():
+        builder(fillers),
+        pb(false, "sirius")
+    {
+        fillers = {&filler};
+    }
+
+    WindowFiller filler;
+    std::vector<LinearProblemFiller*> fillers;
+    LinearProblemBuilder builder;
+    LinearProblemData data;
+    OrtoolsLinearProblem pb;
+};
+
+BOOST_FIXTURE_TEST_SUITE(tests_on_rolling_horizon, RollingHorizonFixture)
+
+BOOST_AUTO_TEST_CASE(overlapping_windows___last_one_ends_with_the_horizon)
+{
+    RollingHorizon rollingHorizon(builder, 4, 1);
+    auto windows = bounds(rollingHorizon.windows({0, 9}));
+
+    std::vector<std::pair<unsigned, unsigned>> expected = {{0, 3}, {3, 6}, {6, 9}};
+    BOOST_CHECK(windows == expected);
+}
+
+BOOST_AUTO_TEST_CASE(windows_not_fitting_the_horizon___last_one_is_moved_back)
+{
+    RollingHorizon rollingHorizon(builder, 4, 0);
+    auto windows = bounds(rollingHorizon.windows({2, 11}));
+
+    std::vector<std::pair<unsigned, unsigned>> expected = {{2, 5}, {6, 9}, {8, 11}};
+    BOOST_CHECK(windows == expected);
+}
+
+BOOST_AUTO_TEST_CASE(window_longer_than_horizon___one_window)
+{
+    RollingHorizon rollingHorizon(builder, 10, 2);
+    auto windows = bounds(rollingHorizon.windows({0, 5}));
+
+    std::vector<std::pair<unsigned, unsigned>> expected = {{0, 5}};
+    BOOST_CHECK(windows == expected);
+}
+
+BOOST_AUTO_TEST_CASE(overlap_not_smaller_than_window___exception_raised)
+{
+    BOOST_CHECK_THROW(RollingHorizon(builder, 3, 3), std::invalid_argument);
+    BOOST_CHECK_THROW(RollingHorizon(builder, 0, 0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(run___problem_built_once_and_states_carried_over)
+{
+    RollingHorizon rollingHorizon(builder, 3, 1);
+    unsigned solved = 0;
+    auto statistics = rollingHorizon.run(pb,
+                                         data,
+                                         {0, 6},
+                                         false,
+                                         [&solved](const WindowStatistics&, const IMipSolution&)
+                                         { ++solved; });
+
+    BOOST_CHECK_EQUAL(filler.builds, 1);
+    BOOST_CHECK_EQUAL(filler.updates, 2);
+    BOOST_CHECK_EQUAL(pb.variableCount(), 4);
+    BOOST_REQUIRE_EQUAL(statistics.size(), 3);
+    BOOST_CHECK_EQUAL(solved, 3);
+    BOOST_CHECK((filler.offsets == std::vector<unsigned>{2, 2}));
+
+    // Windows [0, 2], [2, 4] and [4, 6]
+    BOOST_CHECK_EQUAL(statistics[0].committedTimeSteps, 2);
+    BOOST_CHECK_EQUAL(statistics[2].committedTimeSteps, 3);
+    BOOST_CHECK_EQUAL(statistics[0].objectiveValue, -3);
+    BOOST_CHECK_EQUAL(statistics[1].objectiveValue, -(2 + 2 + 3 + 4));
+    BOOST_CHECK_EQUAL(statistics[2].objectiveValue, -(4 + 4 + 5 + 6));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -24,6 +24,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "antares/expressions/nodes/ExpressionsNodes.h"
+#include "antares/expressions/visitors/EvalVisitor.h"
 #include "antares/expressions/visitors/TimeIndex.h"
 #include "antares/optimisation/linear-problem-api/linearProblemBuilder.h"
 #include "antares/optimisation/linear-problem-data-impl/linearProblemData.h"
@@ -65,6 +66,10 @@ struct LinearProblemBuildingFixture
     Registry<Node> nodes;
     vector<Component> components;
     unique_ptr<ILinearProblem> pb;
+    vector<unique_ptr<ComponentFiller>> fillers;
+    vector<LinearProblemFiller*> fillers_ptr;
+    unique_ptr<LinearProblemBuilder> builder;
+    unsigned nbThreads = 1;
 
     void createModel(string modelId,
                      vector<string> parameterIds,
@@ -128,6 +133,11 @@ struct LinearProblemBuildingFixture
         FillContext time_scenario_ctx = {0, 0};
         buildLinearProblem(time_scenario_ctx);
     }
+
+    void setParameterValue(const string& componentId, const string& parameterId, double value)
+    {
+        builder->setParameterValue(*pb, componentId, parameterId, value);
+    }
 };
 
 void LinearProblemBuildingFixture::createModel(string modelId,
@@ -192,8 +202,8 @@ void LinearProblemBuildingFixture::createComponent(const string& modelId,
 
 void LinearProblemBuildingFixture::buildLinearProblem(FillContext& time_scenario_ctx)
 {
-    vector<unique_ptr<ComponentFiller>> fillers;
-    vector<LinearProblemFiller*> fillers_ptr;
+    fillers.clear();
+    fillers_ptr.clear();
     for (auto& component: components)
     {
         auto cf = make_unique<ComponentFiller>(component);
@@ -206,10 +216,10 @@ void LinearProblemBuildingFixture::buildLinearProblem(FillContext& time_scenario
     pb = make_unique<Antares::Optimisation::LinearProblemMpsolverImpl::OrtoolsLinearProblem>(
       false,
       "sirius");
-    LinearProblemBuilder linear_problem_builder(fillers_ptr);
+    builder = make_unique<LinearProblemBuilder>(fillers_ptr, nbThreads);
     LinearProblemData dummy_data;
 
-    linear_problem_builder.build(*pb, dummy_data, time_scenario_ctx);
+    builder->build(*pb, dummy_data, time_scenario_ctx);
 }
 
 BOOST_FIXTURE_TEST_SUITE(_ComponentFiller_addVariables_, LinearProblemBuildingFixture)
@@ -280,6 +290,19 @@ BOOST_AUTO_TEST_CASE(var_with_wrong_variable_ub__exception_is_raised)
     BOOST_CHECK_THROW(buildLinearProblem(), out_of_range);
 }
 
+BOOST_AUTO_TEST_CASE(var_with_zero_divided_by_zero_ub__exception_is_raised)
+{
+    createModel("my-model",
+                {},
+                {{"variable",
+                  ValueType::FLOAT,
+                  literal(0),
+                  nodes.create<DivisionNode>(literal(0), literal(0))}},
+                {});
+    createComponent("my-model", "my-component");
+    BOOST_CHECK_THROW(buildLinearProblem(), Visitors::EvalVisitorDivisionException);
+}
+
 BOOST_AUTO_TEST_CASE(two_variables_given_to_different_fillers__LP_contains_the_two_variables)
 {
     createModelWithOneFloatVar("m1", {}, "var1", literal(-1), literal(6), {});
@@ -679,3 +702,96 @@ BOOST_AUTO_TEST_CASE(offset_in_objective__throws_exception)
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_FIXTURE_TEST_SUITE(_ComponentFiller_setParameterValue_, LinearProblemBuildingFixture)
+
+BOOST_AUTO_TEST_CASE(param_in_var_bounds__only_the_bounds_of_this_component_are_updated)
+{
+    VariableData var1Data = {"var1", ValueType::FLOAT, parameter("pmin"), literal(10), false};
+    VariableData var2Data = {"var2", ValueType::FLOAT, literal(-1), literal(2), false};
+    createModel("model", {"pmin"}, {var1Data, var2Data}, {});
+    createComponent("model", "A", {{"pmin", -3}});
+    createComponent("model", "B", {{"pmin", -4}});
+    buildLinearProblem();
+
+    setParameterValue("A", "pmin", 5);
+
+    BOOST_CHECK_EQUAL(pb->variableCount(), 4);
+    BOOST_CHECK_EQUAL(pb->getVariable("A.var1")->getLb(), 5);
+    BOOST_CHECK_EQUAL(pb->getVariable("A.var1")->getUb(), 10);
+    BOOST_CHECK_EQUAL(pb->getVariable("A.var2")->getLb(), -1);
+    BOOST_CHECK_EQUAL(pb->getVariable("B.var1")->getLb(), -4);
+}
+
+BOOST_AUTO_TEST_CASE(param_in_time_dependent_ct__bounds_and_coefficients_are_updated)
+{
+    // coef * var1 <= rhs
+    auto var_node = variable("var1",
+                             Antares::Expressions::Visitors::TimeIndex::VARYING_IN_TIME_ONLY);
+    auto ct_node = nodes.create<LessThanOrEqualNode>(multiply(parameter("coef"), var_node),
+                                                     parameter("rhs"));
+    createModel("model",
+                {"coef", "rhs"},
+                {{"var1", ValueType::FLOAT, literal(-5), literal(10), true, false}},
+                {{"ct1", ct_node}});
+    createComponent("model", "componentA", {{"coef", 2}, {"rhs", 3}});
+    FillContext ctx{0, 9};
+    buildLinearProblem(ctx);
+
+    setParameterValue("componentA", "rhs", 7);
+    setParameterValue("componentA", "coef", 0);
+
+    BOOST_CHECK_EQUAL(pb->constraintCount(), 10);
+    for (unsigned i = 0; i < ctx.getNumberOfTimestep(); i++)
+    {
+        auto* ct = pb->getConstraint("componentA.ct1_" + to_string(i));
+        BOOST_REQUIRE(ct);
+        BOOST_CHECK_EQUAL(ct->getLb(), -pb->infinity());
+        BOOST_CHECK_EQUAL(ct->getUb(), 7);
+        BOOST_CHECK_EQUAL(ct->getCoefficient(pb->getVariable("componentA.var1_" + to_string(i))),
+                          0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(problem_built_in_parallel__objective_updated_and_solved_again)
+{
+    // cost * x, with x in [lb, 10]
+    auto objective = multiply(parameter("cost"), variable("x"));
+    createModelWithOneFloatVar("model",
+                               {"cost", "lb"},
+                               "x",
+                               parameter("lb"),
+                               literal(10),
+                               {},
+                               objective);
+    createComponent("model", "componentA", {{"cost", 1}, {"lb", 2}});
+    createComponent("model", "componentB", {{"cost", 1}, {"lb", 0}});
+    nbThreads = 2;
+    buildLinearProblem();
+    using Antares::Optimisation::LinearProblemMpsolverImpl::OrtoolsLinearProblem;
+    dynamic_cast<OrtoolsLinearProblem&>(*pb).setWarmStart(true);
+    BOOST_CHECK_EQUAL(pb->solve(false)->getObjectiveValue(), 2);
+
+    setParameterValue("componentA", "cost", -1);
+    setParameterValue("componentB", "lb", 4);
+
+    BOOST_CHECK_EQUAL(pb->getObjectiveCoefficient(pb->getVariable("componentA.x")), -1);
+    BOOST_CHECK_EQUAL(pb->getVariable("componentB.x")->getLb(), 4);
+    BOOST_CHECK_EQUAL(pb->solve(false)->getObjectiveValue(), -10 + 4);
+}
+
+BOOST_AUTO_TEST_CASE(unknown_component_or_parameter__exception_is_raised)
+{
+    createModelWithOneFloatVar("model", {"lb"}, "x", parameter("lb"), literal(10), {});
+    createComponent("model", "componentA", {{"lb", 2}});
+    buildLinearProblem();
+
+    BOOST_CHECK_EXCEPTION(setParameterValue("componentB", "lb", 1),
+                          invalid_argument,
+                          checkMessage("Component 'componentB' not found in the problem"));
+    BOOST_CHECK_EXCEPTION(setParameterValue("componentA", "ub", 1),
+                          invalid_argument,
+                          checkMessage("Parameter 'ub' not found in component 'componentA'"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,161 @@
+#define BOOST_TEST_MODULE hydro daily allocation
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "antares/solver/hydro/daily/h2o_j_donnees_mensuelles.h"
+#include "antares/solver/hydro/daily/h2o_j_fonctions.h"
+
+namespace
+{
+struct Solution
+{
+    bool specialised = false;
+    char valid = NON;
+    double cost = 0.;
+    std::vector<double> turbine;
+};
+
+struct MonthlyDataDeleter
+{
+    void operator()(DONNEES_MENSUELLES* data) const
+    {
+        H2O_J_Free(data);
+        delete data;
+    }
+};
+
+using MonthlyData = std::unique_ptr<DONNEES_MENSUELLES, MonthlyDataDeleter>;
+
+int problemIndex(const DONNEES_MENSUELLES& data)
+{
+    const auto& problems = data.ProblemeHydraulique;
+    for (int i = 0; i < problems.NombreDeProblemes; i++)
+    {
+        if (problems.NbJoursDUnProbleme[i] == data.NombreDeJoursDuMois)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+struct Fixture
+{
+    Fixture()
+    {
+        data.reset(H2O_J_Instanciation());
+        H2O_J_AjouterBruitAuCout(*data);
+    }
+
+    void randomMonth(int days, double minRatio, double targetRatio, double energyRatio)
+    {
+        std::uniform_real_distribution<double> uniform(0., 1.);
+        data->NombreDeJoursDuMois = days;
+        double sumOfMax = 0.;
+        for (int d = 0; d < days; d++)
+        {
+            data->TurbineMax[d] = 1000. * uniform(generator);
+            data->TurbineMin[d] = minRatio * data->TurbineMax[d] * uniform(generator);
+            data->TurbineCible[d] = targetRatio * data->TurbineMax[d] * uniform(generator);
+            sumOfMax += data->TurbineMax[d];
+        }
+        data->TurbineDuMois = energyRatio * sumOfMax;
+    }
+
+    Solution solve(bool specialised)
+    {
+        const int num = problemIndex(*data);
+        BOOST_REQUIRE(num >= 0);
+
+        auto& problems = data->ProblemeHydraulique;
+        data->ResultatsValides = NON;
+        H2O_J_InitialiserLeSecondMembre(data.get(), num);
+        H2O_J_InitialiserLesBornesdesVariables(data.get(), num);
+
+        Solution solution;
+        if (specialised)
+        {
+            solution.specialised = H2O_J_ResoudreLeProblemeSpecialise(data.get(), num);
+        }
+        else
+        {
+            H2O_J_ResoudreLeProblemeLineaire(data.get(), num);
+        }
+
+        solution.valid = data->ResultatsValides;
+        const auto& fixed = problems.ProblemeLineairePartieFixe[num];
+        const auto& X = problems.ProblemeLineairePartieVariable[num].X;
+        for (int var = 0; var < fixed.NombreDeVariables; var++)
+        {
+            solution.cost += fixed.CoutLineaire[var] * X[var];
+        }
+        solution.turbine.assign(data->Turbine.begin(),
+                                data->Turbine.begin() + data->NombreDeJoursDuMois);
+        return solution;
+    }
+
+    void checkAgainstSimplex()
+    {
+        auto expected = solve(false);
+        auto actual = solve(true);
+        BOOST_REQUIRE(actual.specialised);
+        BOOST_REQUIRE_EQUAL(expected.valid, OUI);
+        BOOST_CHECK_EQUAL(actual.valid, OUI);
+        BOOST_CHECK_CLOSE(actual.cost, expected.cost, 1e-4);
+        for (unsigned d = 0; d < actual.turbine.size(); d++)
+        {
+            BOOST_CHECK_SMALL(actual.turbine[d] - expected.turbine[d], 1e-4);
+        }
+    }
+
+    MonthlyData data;
+    std::mt19937 generator{42};
+};
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(hydro_daily_allocation, Fixture)
+
+BOOST_AUTO_TEST_CASE(energy_between_sum_of_min_and_sum_of_max__same_solution_as_simplex)
+{
+    for (int days: {28, 29, 30, 31})
+    {
+        for (int i = 0; i < 20; i++)
+        {
+            randomMonth(days, 0.2, 0.4, 0.6);
+            checkAgainstSimplex();
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(energy_above_sum_of_max__same_solution_as_simplex)
+{
+    for (int i = 0; i < 20; i++)
+    {
+        randomMonth(31, 0.2, 0.4, 1.5);
+        checkAgainstSimplex();
+    }
+}
+
+BOOST_AUTO_TEST_CASE(targets_above_max__same_solution_as_simplex)
+{
+    for (int i = 0; i < 20; i++)
+    {
+        randomMonth(30, 0.2, 1.5, 0.9);
+        checkAgainstSimplex();
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sum_of_min_above_energy__falls_back_to_simplex)
+{
+    randomMonth(31, 1., 0., 0.);
+    data->TurbineDuMois = -1.;
+    BOOST_CHECK(!solve(true).specialised);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
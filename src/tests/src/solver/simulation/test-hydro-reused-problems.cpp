@@ -0,0 +1,150 @@
+#define BOOST_TEST_MODULE hydro reused problems
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <random>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "antares/solver/hydro/daily2/h2o2_j_donnees_mensuelles.h"
+#include "antares/solver/hydro/daily2/h2o2_j_fonctions.h"
+#include "antares/study/parameters.h"
+
+using namespace Antares;
+
+namespace
+{
+struct MonthInputs
+{
+    int days = 0;
+    double turbineDuMois = 0.;
+    double initialLevel = 0.;
+    std::vector<double> turbineMax;
+    std::vector<double> turbineMin;
+    std::vector<double> turbineCible;
+    std::vector<double> niveauBas;
+    std::vector<double> apports;
+};
+
+struct Fixture
+{
+    MonthInputs randomMonth(int days)
+    {
+        std::uniform_real_distribution<double> uniform(0., 1.);
+        MonthInputs month;
+        month.days = days;
+        month.initialLevel = 0.3 + 0.4 * uniform(generator);
+        for (int d = 0; d < days; d++)
+        {
+            month.turbineMax.push_back(0.05 * uniform(generator));
+            month.turbineMin.push_back(0.2 * month.turbineMax.back() * uniform(generator));
+            month.turbineCible.push_back(month.turbineMax.back() * uniform(generator));
+            month.niveauBas.push_back(0.2 * uniform(generator));
+            month.apports.push_back(0.03 * uniform(generator));
+            month.turbineDuMois += month.turbineCible.back();
+        }
+        return month;
+    }
+
+    // Turbining the energy of the month empties the reservoir below its lower level : the month
+    // is solved differently whether waste or violations cost more
+    static MonthInputs lowReservoirMonth(int days)
+    {
+        MonthInputs month;
+        month.days = days;
+        month.initialLevel = 0.3;
+        month.turbineMax.assign(days, 0.05);
+        month.turbineMin.assign(days, 0.);
+        month.turbineCible.assign(days, 0.02);
+        month.niveauBas.assign(days, 0.28);
+        month.apports.assign(days, 0.001);
+        month.turbineDuMois = 0.02 * days;
+        return month;
+    }
+
+    static void solve(DONNEES_MENSUELLES_ETENDUES& problem, const MonthInputs& month)
+    {
+        problem.NombreDeJoursDuMois = month.days;
+        problem.TurbineDuMois = month.turbineDuMois;
+        problem.NiveauInitialDuMois = month.initialLevel;
+        problem.reservoirCapacity = 1.;
+        for (int d = 0; d < month.days; d++)
+        {
+            problem.TurbineMax[d] = month.turbineMax[d];
+            problem.TurbineMin[d] = month.turbineMin[d];
+            problem.TurbineCible[d] = month.turbineCible[d];
+            problem.niveauBas[d] = month.niveauBas[d];
+            problem.apports[d] = month.apports[d];
+        }
+        H2O2_J_OptimiserUnMois(problem);
+    }
+
+    // Solve the month with the problem solved the previous months, and with a problem built for
+    // it only, given the same costs
+    void checkAgainstNewProblem(const Hydro_problem_costs& costs, const MonthInputs& month)
+    {
+        H2O2_J_apply_costs(costs, reused);
+        solve(reused, month);
+
+        auto fresh = H2O2_J_Instanciation();
+        for (int i = 0; i < fresh.ProblemeHydrauliqueEtendu.NombreDeProblemes; i++)
+        {
+            fresh.ProblemeHydrauliqueEtendu.ProblemeLineaireEtenduPartieFixe[i].CoutLineaire
+              = reused.ProblemeHydrauliqueEtendu.ProblemeLineaireEtenduPartieFixe[i].CoutLineaire;
+        }
+        solve(fresh, month);
+
+        BOOST_REQUIRE_EQUAL(fresh.ResultatsValides, OUI);
+        BOOST_CHECK_EQUAL(reused.ResultatsValides, OUI);
+        BOOST_CHECK_CLOSE(reused.CoutSolution, fresh.CoutSolution, 1e-6);
+        for (int d = 0; d < month.days; d++)
+        {
+            BOOST_CHECK_SMALL(reused.Turbine[d] - fresh.Turbine[d], 1e-6);
+            BOOST_CHECK_SMALL(reused.niveauxFinJours[d] - fresh.niveauxFinJours[d], 1e-6);
+        }
+        BOOST_CHECK_SMALL(reused.waste - fresh.waste, 1e-6);
+        H2O2_J_Free(fresh);
+    }
+
+    ~Fixture()
+    {
+        H2O2_J_Free(reused);
+    }
+
+    DONNEES_MENSUELLES_ETENDUES reused = H2O2_J_Instanciation();
+    std::mt19937 generator{42};
+};
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(hydro_reused_problems, Fixture)
+
+BOOST_AUTO_TEST_CASE(daily_with_reservoir__months_in_a_row__same_solution_as_new_problem)
+{
+    Data::Parameters parameters;
+    parameters.hydroHeuristicPolicy.hhPolicy = Data::hhpAccommodateRuleCurves;
+    Hydro_problem_costs costs(parameters);
+    for (int days: {31, 28, 31, 30, 31})
+    {
+        checkAgainstNewProblem(costs, randomMonth(days));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(daily_with_reservoir__costs_changed_between_months__new_costs_are_used)
+{
+    Data::Parameters parameters;
+    parameters.hydroHeuristicPolicy.hhPolicy = Data::hhpAccommodateRuleCurves;
+    Hydro_problem_costs accommodate(parameters);
+    parameters.hydroHeuristicPolicy.hhPolicy = Data::hhpMaximizeGeneration;
+    Hydro_problem_costs maximize(parameters);
+
+    const auto month = lowReservoirMonth(31);
+    checkAgainstNewProblem(accommodate, month);
+    const double accommodateWaste = reused.waste;
+    checkAgainstNewProblem(maximize, month);
+    BOOST_CHECK_GT(accommodateWaste, reused.waste + 0.1);
+    checkAgainstNewProblem(accommodate, month);
+    BOOST_CHECK_CLOSE(reused.waste, accommodateWaste, 1e-6);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
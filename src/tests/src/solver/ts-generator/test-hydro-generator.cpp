@@ -0,0 +1,194 @@
+#define BOOST_TEST_MODULE hydro time - series generator
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/mersenne-twister/mersenne-twister.h>
+#include <antares/study/study.h>
+#include <antares/writer/i_writer.h>
+#include "antares/solver/ts-generator/generator.h"
+
+using namespace Antares::Data;
+using namespace Antares::TSGenerator;
+
+namespace
+{
+constexpr double EXPECTED_ENERGY = 1000.;
+constexpr double STD_DEVIATION = 0.5;
+constexpr unsigned SEED = 42;
+
+struct HydroSeries
+{
+    Matrix<> ror;
+    Matrix<> storage;
+};
+
+void checkEqual(const Matrix<>& lhs, const Matrix<>& rhs)
+{
+    BOOST_REQUIRE_EQUAL(lhs.width, rhs.width);
+    BOOST_REQUIRE_EQUAL(lhs.height, rhs.height);
+    for (uint x = 0; x != lhs.width; ++x)
+    {
+        BOOST_CHECK_EQUAL_COLLECTIONS(lhs[x], lhs[x] + lhs.height, rhs[x], rhs[x] + rhs.height);
+    }
+}
+
+struct HydroFixture
+{
+    HydroFixture()
+    {
+        auto& parameters = study->parameters;
+        parameters.reset();
+        // 3 chunks of series, the last one being incomplete
+        parameters.nbTimeSeriesHydro = 25;
+        parameters.timeSeriesToGenerate = timeSeriesHydro;
+        parameters.timeSeriesToArchive = 0;
+        parameters.seed[seedTsGenHydro] = SEED;
+        study->calendar.reset({parameters.dayOfThe1stJanuary,
+                               parameters.firstWeekday,
+                               parameters.firstMonthInYear,
+                               false});
+
+        for (const char* name: {"area 1", "area 2"})
+        {
+            auto& prepro = *study->areaAdd(name)->hydro.prepro;
+            prepro.intermonthlyCorrelation = 0.5;
+            for (uint month = 0; month != MONTHS_PER_YEAR; ++month)
+            {
+                prepro.data[PreproHydro::expectation][month] = std::log(EXPECTED_ENERGY);
+                prepro.data[PreproHydro::stdDeviation][month] = STD_DEVIATION;
+                prepro.data[PreproHydro::minimumEnergy][month] = 0.;
+                prepro.data[PreproHydro::maximumEnergy][month] = 1e9;
+                prepro.data[PreproHydro::powerOverWater][month] = 0.5;
+            }
+        }
+
+        auto& correlation = study->preproHydroCorrelation.annual;
+        correlation.resize(2, 2);
+        correlation.fillUnit();
+        correlation[0][1] = correlation[1][0] = 0.5;
+
+        ResizeGeneratedTimeSeries(study->areas, parameters);
+    }
+
+    // Without any correlation, and with all the inflows stored, the monthly storage of each
+    // series is the monthly energy drawn for it
+    void removeCorrelationsAndRunOfRiver()
+    {
+        auto& correlation = study->preproHydroCorrelation.annual;
+        correlation[0][1] = correlation[1][0] = 0.;
+        study->areas.each(
+          [](Area& area)
+          {
+              auto& prepro = *area.hydro.prepro;
+              prepro.intermonthlyCorrelation = 0.;
+              for (uint month = 0; month != MONTHS_PER_YEAR; ++month)
+              {
+                  prepro.data[PreproHydro::powerOverWater][month] = 0.;
+              }
+          });
+    }
+
+    std::vector<HydroSeries> generate(TsGenSeeding seeding, unsigned int nbThreads)
+    {
+        study->parameters.compatibility.tsGenSeeding = seeding;
+        study->runtime.initializeRandomNumberGenerators(study->parameters);
+
+        Antares::Solver::NullResultWriter writer;
+        TimeSeriesArchive archive(writer, Parameters::ArchiveFormat::Text, 1);
+        BOOST_REQUIRE(GenerateTimeSeries<timeSeriesHydro>(*study, 0, archive, nbThreads));
+
+        std::vector<HydroSeries> series;
+        study->areas.each(
+          [&series](const Area& area)
+          {
+              series.push_back(
+                {area.hydro.series->ror.timeSeries, area.hydro.series->storage.timeSeries});
+          });
+        return series;
+    }
+
+    Study::Ptr study = std::make_shared<Study>();
+};
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(hydro_generator, HydroFixture)
+
+BOOST_AUTO_TEST_CASE(seeding_v2___same_series_whatever_the_thread_count)
+{
+    const auto sequential = generate(TsGenSeeding::V2, 1);
+    const auto parallel = generate(TsGenSeeding::V2, 4);
+
+    BOOST_REQUIRE_EQUAL(sequential.size(), parallel.size());
+    for (std::size_t area = 0; area != sequential.size(); ++area)
+    {
+        checkEqual(sequential[area].ror, parallel[area].ror);
+        checkEqual(sequential[area].storage, parallel[area].storage);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(seeding_v1___same_series_whatever_the_thread_count)
+{
+    const auto sequential = generate(TsGenSeeding::V1, 1);
+    const auto parallel = generate(TsGenSeeding::V1, 4);
+
+    BOOST_REQUIRE_EQUAL(sequential.size(), parallel.size());
+    for (std::size_t area = 0; area != sequential.size(); ++area)
+    {
+        checkEqual(sequential[area].ror, parallel[area].ror);
+        checkEqual(sequential[area].storage, parallel[area].storage);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(seeding_v1___normal_draws_in_the_historical_order)
+{
+    removeCorrelationsAndRunOfRiver();
+    const auto series = generate(TsGenSeeding::V1, 4);
+
+    // Historically, all the normal draws of a series, for every area and month, are made from the
+    // hydro stream before those of the next series
+    const uint nbAreas = study->areas.size();
+    const uint DIM = nbAreas * MONTHS_PER_YEAR;
+    MersenneTwister random;
+    random.reset(SEED);
+    std::vector<double> norm(DIM);
+    for (uint l = 0; l != study->parameters.nbTimeSeriesHydro; ++l)
+    {
+        for (uint s = 0; s != DIM / 2; ++s)
+        {
+            double x, y, z;
+            do
+            {
+                x = 2. * random.next() - 1.;
+                y = 2. * random.next() - 1.;
+                z = x * x + y * y;
+            } while (z > 1);
+
+            const double u = std::sqrt(-2. * std::log(z) / z);
+            norm[2 * s] = x * u;
+            norm[2 * s + 1] = y * u;
+        }
+
+        for (uint i = 0; i != DIM; ++i)
+        {
+            const auto& storage = series[i / MONTHS_PER_YEAR].storage[l];
+            const auto& month = study->calendar.months[i % MONTHS_PER_YEAR];
+            double monthlyStorage = 0.;
+            for (uint d = month.daysYear.first; d != month.daysYear.end; ++d)
+            {
+                monthlyStorage += storage[d];
+            }
+
+            // The daily storages are rounded, their sum is the rounded monthly energy
+            const double energy = std::exp(norm[i] * STD_DEVIATION + std::log(EXPECTED_ENERGY));
+            BOOST_CHECK_LE(std::abs(monthlyStorage - energy), 0.5);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,128 @@
+#define BOOST_TEST_MODULE xcast time - series generator
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <memory>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/study/study.h>
+#include <antares/writer/i_writer.h>
+#include "antares/solver/ts-generator/generator.h"
+
+using namespace Antares::Data;
+using namespace Antares::TSGenerator;
+
+namespace
+{
+void checkEqual(const Matrix<>& lhs, const Matrix<>& rhs)
+{
+    BOOST_REQUIRE_EQUAL(lhs.width, rhs.width);
+    BOOST_REQUIRE_EQUAL(lhs.height, rhs.height);
+    for (uint x = 0; x != lhs.width; ++x)
+    {
+        BOOST_CHECK_EQUAL_COLLECTIONS(lhs[x], lhs[x] + lhs.height, rhs[x], rhs[x] + rhs.height);
+    }
+}
+
+// The generated values are the process times the daily profile, times the capacity
+void generateFrom(Antares::Data::XCast& xcast, double capacity)
+{
+    xcast.capacity = capacity;
+    xcast.K.fill(1.f);
+}
+
+void correlateTheFirstTwoAreas(Correlation& correlation)
+{
+    correlation.mode(Correlation::modeAnnual);
+    correlation.annual.resize(3, 3);
+    correlation.annual.fillUnit();
+    correlation.annual[0][1] = correlation.annual[1][0] = 0.5;
+}
+
+// Three areas, the first two being correlated : two independent blocks of processes
+Study::Ptr makeStudy()
+{
+    auto study = std::make_shared<Study>();
+    auto& parameters = study->parameters;
+    parameters.reset();
+    // 3 chunks of series, the last one being incomplete
+    parameters.nbTimeSeriesLoad = 25;
+    parameters.nbTimeSeriesSolar = 25;
+    parameters.nbTimeSeriesWind = 25;
+    parameters.timeSeriesToGenerate = timeSeriesLoad | timeSeriesSolar | timeSeriesWind;
+    parameters.timeSeriesToArchive = 0;
+    parameters.compatibility.tsGenSeeding = TsGenSeeding::V2;
+    study->calendar.reset({parameters.dayOfThe1stJanuary,
+                           parameters.firstWeekday,
+                           parameters.firstMonthInYear,
+                           false});
+
+    for (const char* name: {"area 1", "area 2", "area 3"})
+    {
+        auto* area = study->areaAdd(name);
+        generateFrom(area->load.prepro->xcast, 1000.);
+        generateFrom(area->solar.prepro->xcast, 100.);
+        generateFrom(area->wind.prepro->xcast, 200.);
+    }
+
+    correlateTheFirstTwoAreas(study->preproLoadCorrelation);
+    correlateTheFirstTwoAreas(study->preproSolarCorrelation);
+    correlateTheFirstTwoAreas(study->preproWindCorrelation);
+
+    ResizeGeneratedTimeSeries(study->areas, parameters);
+    study->runtime.initializeRandomNumberGenerators(parameters);
+    return study;
+}
+
+// The generator releases its data once done : each generation needs its own study
+template<enum TimeSeriesType T, class SeriesT>
+std::vector<Matrix<>> generate(unsigned int nbThreads, SeriesT series)
+{
+    auto study = makeStudy();
+    Antares::Solver::NullResultWriter writer;
+    TimeSeriesArchive archive(writer, Parameters::ArchiveFormat::Text, 1);
+    BOOST_REQUIRE(GenerateTimeSeries<T>(*study, 0, archive, nbThreads));
+
+    std::vector<Matrix<>> generated;
+    study->areas.each([&generated, &series](const Area& area)
+                      { generated.push_back(series(area)); });
+    return generated;
+}
+
+template<enum TimeSeriesType T, class SeriesT>
+void checkSameSeriesWhateverTheThreadCount(SeriesT series)
+{
+    const auto sequential = generate<T>(1, series);
+    const auto parallel = generate<T>(4, series);
+
+    BOOST_REQUIRE_EQUAL(sequential.size(), parallel.size());
+    for (std::size_t area = 0; area != sequential.size(); ++area)
+    {
+        checkEqual(sequential[area], parallel[area]);
+    }
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(xcast_generator)
+
+BOOST_AUTO_TEST_CASE(load_with_seeding_v2___same_series_whatever_the_thread_count)
+{
+    checkSameSeriesWhateverTheThreadCount<timeSeriesLoad>(
+      [](const Area& area) { return area.load.series.timeSeries; });
+}
+
+BOOST_AUTO_TEST_CASE(solar_with_seeding_v2___same_series_whatever_the_thread_count)
+{
+    checkSameSeriesWhateverTheThreadCount<timeSeriesSolar>(
+      [](const Area& area) { return area.solar.series.timeSeries; });
+}
+
+BOOST_AUTO_TEST_CASE(wind_with_seeding_v2___same_series_whatever_the_thread_count)
+{
+    checkSameSeriesWhateverTheThreadCount<timeSeriesWind>(
+      [](const Area& area) { return area.wind.series.timeSeries; });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
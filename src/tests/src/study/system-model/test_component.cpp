@@ -69,6 +69,20 @@ BOOST_AUTO_TEST_CASE(nominal_build_with_parameters)
     BOOST_CHECK_EQUAL(component.getScenarioGroupId(), "scenario_group");
 }
 
+BOOST_AUTO_TEST_CASE(nominal_build_with_a_parameter_read_from_a_data_series)
+{
+    Model model = createModelWithParameters();
+    auto component = component_builder.withId("component")
+                       .withModel(&model)
+                       .withParameterValues({{"param1", 5}})
+                       .withParameterDataSeries({{"param2", "load"}})
+                       .withScenarioGroupId("scenario_group")
+                       .build();
+    BOOST_CHECK_EQUAL(component.getParameterValue("param1"), 5);
+    BOOST_CHECK_EQUAL(component.getParameterDataSeries().size(), 1);
+    BOOST_CHECK_EQUAL(component.getParameterDataSeries().at("param2"), "load");
+}
+
 BOOST_AUTO_TEST_CASE(nominal_build_without_parameters1)
 {
     Model model = createModelWithoutParameters();
@@ -214,6 +228,20 @@ BOOST_AUTO_TEST_CASE(fail_on_too_many_params1)
                             "The component \"component\" has 3 parameter(s), but its model has 2"));
 }
 
+BOOST_AUTO_TEST_CASE(fail_on_param_with_a_value_and_a_data_series)
+{
+    Model model = createModelWithParameters();
+    auto component = component_builder.withId("component")
+                       .withModel(&model)
+                       .withParameterValues({{"param1", 3}, {"param2", 3}})
+                       .withParameterDataSeries({{"param2", "load"}})
+                       .withScenarioGroupId("scenario_group");
+    BOOST_CHECK_EXCEPTION(component_builder.build(),
+                          std::invalid_argument,
+                          checkMessage(
+                            "The component \"component\" has 3 parameter(s), but its model has 2"));
+}
+
 BOOST_AUTO_TEST_CASE(fail_on_too_many_params2)
 {
     Model model = createModelWithoutParameters();
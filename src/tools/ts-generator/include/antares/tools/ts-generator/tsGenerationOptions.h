@@ -20,6 +20,9 @@ struct Settings
     bool allLinks = false;
     /// generate TS for a list "area.link;area2.link2;"
     std::string linksListToGen;
+
+    /// convert the binary archives of a simulation output back to text
+    std::string archivesToConvert;
 };
 
 bool parseOptions(int, const char*[], Settings&);
@@ -28,4 +31,5 @@ std::unique_ptr<Yuni::GetOpt::Parser> createTsGeneratorParser(Settings&);
 bool checkOptions(Settings& options);
 bool linkTSrequired(Settings& options);
 bool thermalTSrequired(Settings& options);
+bool archivesConversionRequired(Settings& options);
 } // namespace Antares::TSGenerator
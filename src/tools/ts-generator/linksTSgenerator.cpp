@@ -1,6 +1,8 @@
 
 #include "antares/tools/ts-generator/linksTSgenerator.h"
 
+#include <thread>
+
 #include "antares/utils/utils.h"
 
 namespace Antares::TSGenerator
@@ -59,8 +61,13 @@ bool readLinkGeneralProperty(StudyParamsForLinkTS& params,
             return false;
         }
         params.random.reset(seed);
+        params.seed = seed;
         return true;
     }
+    if (key == "tsgen-seeding")
+    {
+        return Data::StringToCompatibilityTsGenSeeding(params.seeding, value);
+    }
     return true;
 }
 
@@ -304,6 +311,7 @@ LinkPairs LinksTSgenerator::extractLinkNamesFromCmdLine(const LinkPairs& allLink
 StudyParamsForLinkTS LinksTSgenerator::readGeneralParamsForLinksTS()
 {
     StudyParamsForLinkTS to_return;
+    to_return.nbThreads = std::thread::hardware_concurrency();
     fs::path pathToGeneraldata = studyFolder_ / "settings" / "generaldata.ini";
     IniFile ini;
     ini.open(pathToGeneraldata); // gp : we should handle reading issues
@@ -311,7 +319,8 @@ StudyParamsForLinkTS LinksTSgenerator::readGeneralParamsForLinksTS()
     {
         // Skipping sections useless in the current context
         Yuni::String sectionName = section->name;
-        if (sectionName != "general" && sectionName != "seeds - Mersenne Twister")
+        if (sectionName != "general" && sectionName != "seeds - Mersenne Twister"
+            && sectionName != "compatibility")
         {
             continue;
         }
@@ -80,6 +80,11 @@ int main(int argc, const char* argv[])
 
     bool return_code{true};
 
+    if (archivesConversionRequired(settings))
+    {
+        return_code = TimeSeriesArchive::ConvertToText(settings.archivesToConvert);
+    }
+
     if (thermalTSrequired(settings))
     {
         // === Data for TS generation ===
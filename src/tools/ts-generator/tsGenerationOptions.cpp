@@ -26,6 +26,11 @@ std::unique_ptr<Yuni::GetOpt::Parser> createTsGeneratorParser(Settings& settings
                     "links",
                     "Generate TS capacities for a list of 2 area IDs, "
                     "usage: --links=\"areaID.area2ID;area3ID.area1ID\"");
+    parser->addFlag(settings.archivesToConvert,
+                    ' ',
+                    "convert-archives",
+                    "Convert the binary time-series archived in a simulation output into text, "
+                    "\nusage: --convert-archives=\"<output folder>\"");
 
     parser->remainingArguments(settings.studyFolder);
 
@@ -74,4 +79,9 @@ bool thermalTSrequired(Settings& options)
 {
     return options.allThermal || !options.thermalListToGen.empty();
 }
+
+bool archivesConversionRequired(Settings& options)
+{
+    return !options.archivesToConvert.empty();
+}
 } // namespace Antares::TSGenerator